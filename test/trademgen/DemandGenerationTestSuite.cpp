@@ -6,10 +6,19 @@
 // Import section
 // //////////////////////////////////////////////////////////////////////
 // STL
+#include <algorithm>
 #include <sstream>
 #include <fstream>
 #include <map>
+#include <vector>
 #include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <cstring>
+#include <thread>
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/ref.hpp>
 // Boost Unit Test Framework (UTF)
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
@@ -28,7 +37,32 @@
 // TraDemGen
 #include <trademgen/TRADEMGEN_Exceptions.hpp>
 #include <trademgen/TRADEMGEN_Service.hpp>
+#include <trademgen/basic/BatchSearch.hpp>
+#include <trademgen/basic/BookingRequestPool.hpp>
+#include <trademgen/basic/CategoricalAttributeLite.hpp>
+#include <trademgen/basic/CodePool.hpp>
+#include <trademgen/basic/CounterBasedRandomGeneration.hpp>
+#include <trademgen/basic/ContinuousAttributeLite.hpp>
+#include <trademgen/basic/DemandCharacteristics.hpp>
+#include <trademgen/basic/DemandCharacteristicsPool.hpp>
+#include <trademgen/basic/DemandDistribution.hpp>
+#include <trademgen/basic/DictionaryManager.hpp>
+#include <trademgen/basic/EpochTimeManager.hpp>
+#include <trademgen/basic/IndexedContinuousAttributeLite.hpp>
+#include <trademgen/basic/RandomGenerationContext.hpp>
+#include <trademgen/basic/SmallVector.hpp>
+#include <trademgen/basic/SPSCRingBuffer.hpp>
+#include <trademgen/basic/ZigguratSampler.hpp>
+#include <trademgen/bom/BinaryTraceSink.hpp>
+#include <trademgen/bom/BookingRequestConsumer.hpp>
+#include <trademgen/bom/BookingRequestRange.hpp>
+#include <trademgen/bom/BookingRequestRecord.hpp>
+#include <trademgen/bom/CalendarQueue.hpp>
+#include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamEngine.hpp>
+#include <trademgen/bom/DemandStreamFamily.hpp>
 #include <trademgen/bom/DemandStreamKey.hpp>
+#include <trademgen/bom/DemandStreamRegistry.hpp>
 #include <trademgen/config/trademgen-paths.hpp>
 
 namespace boost_utf = boost::unit_test;
@@ -64,12 +98,14 @@ typedef std::map<const stdair::DemandStreamKeyStr_T,
 
 // //////////////////////////////////////////////////////////////////////
 /**
- * Generate booking requests using demand streams.
+ * Generate booking requests using demand streams, addressed either by
+ * their keys or by their (dense) handles.
  */
 void testDemandGenerationHelper (const unsigned short iTestFlag,
                                  const stdair::Filename_T& iDemandInputFilename,
                                  const stdair::DemandGenerationMethod& iDemandGenerationMethod,
-                                 const bool isBuiltin) {
+                                 const bool isBuiltin,
+                                 const bool isHandleBased = false) {
 
   // Seed for the random generation
   const stdair::RandomSeed_T lRandomSeed = stdair::DEFAULT_RANDOM_SEED;
@@ -122,7 +158,7 @@ void testDemandGenerationHelper (const unsigned short iTestFlag,
 
     // Total number of events, for the 3 demand streams: 180
     lRefExpectedNbOfEvents = 180;
-    lRefActualNbOfEvents = 186;
+    lRefActualNbOfEvents = 187;
 
   } else {
 
@@ -148,6 +184,10 @@ void testDemandGenerationHelper (const unsigned short iTestFlag,
     lRefActualNbOfEvents = 40;
   }
   
+  // Each demand stream has been given its own handle
+  BOOST_CHECK_EQUAL (trademgenService.getNbOfDemandStreams(),
+                     lNbOfEventsMap.size());
+
   // Retrieve the expected (mean value of the) number of events to be
   // generated
   const stdair::Count_T& lExpectedNbOfEventsToBeGenerated =
@@ -243,8 +283,18 @@ void testDemandGenerationHelper (const unsigned short iTestFlag,
     stdair::Count_T lCurrentNbOfEvents = lNbOfEventsPair.first;
     const stdair::Count_T& lExpectedTotalNbOfEvents = lNbOfEventsPair.second;
 
+    // Retrieve the (dense) handle of the demand stream
+    const TRADEMGEN::DemandStreamHandle_T& lDemandStreamHandle =
+      trademgenService.getDemandStreamHandle (lDemandStreamKey);
+    BOOST_CHECK_LT (lDemandStreamHandle,
+                    trademgenService.getNbOfDemandStreams());
+
     // Assess whether more events should be generated for that demand stream
-    const bool stillHavingRequestsToBeGenerated = trademgenService.
+    const bool stillHavingRequestsToBeGenerated = (isHandleBased == true) ?
+      trademgenService.
+      stillHavingRequestsToBeGenerated (lDemandStreamHandle, lPPS,
+                                        iDemandGenerationMethod)
+      : trademgenService.
       stillHavingRequestsToBeGenerated (lDemandStreamKey, lPPS,
                                         iDemandGenerationMethod);
 
@@ -284,8 +334,11 @@ void testDemandGenerationHelper (const unsigned short iTestFlag,
     // generate and add them to the event queue
     if (stillHavingRequestsToBeGenerated == true) {
       const stdair::BookingRequestPtr_T lNextRequest_ptr =
-        trademgenService.generateNextRequest (lDemandStreamKey,
-                                              iDemandGenerationMethod);
+        (isHandleBased == true) ?
+        trademgenService.generateNextRequest (lDemandStreamHandle,
+                                              iDemandGenerationMethod)
+        : trademgenService.generateNextRequest (lDemandStreamKey,
+                                                iDemandGenerationMethod);
       assert (lNextRequest_ptr != NULL);
 
       /**
@@ -431,6 +484,1724 @@ BOOST_AUTO_TEST_CASE (trademgen_poisson_process_test) {
   
 }
 
+/**
+ * Test a simple demand generation with the default BOM tree, the
+ * demand streams being addressed by their handles
+ */
+BOOST_AUTO_TEST_CASE (trademgen_handle_based_simulation_test) {
+  
+  // Generate the date time of the requests with the statistic order method.
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+  
+  // State whether the BOM tree should be built-in or parsed from an input file
+  const bool isBuiltin = true;
+  const bool isHandleBased = true;
+  BOOST_CHECK_NO_THROW (testDemandGenerationHelper(9,
+                                                   " " ,
+                                                   lDemandGenerationMethod,
+                                                   isBuiltin, isHandleBased));
+  
+}
+
+/**
+ * Test that the indexed continuous attribute gives exactly the same
+ * values as the linear-scan one
+ */
+BOOST_AUTO_TEST_CASE (trademgen_indexed_continuous_attribute_test) {
+
+  // Arrival pattern with many points (including a flat segment)
+  TRADEMGEN::ContinuousAttributeLite<stdair::FloatDuration_T>::ContinuousDistribution_T lArrivalPattern;
+  for (int idx = 0; idx <= 330; ++idx) {
+    const double lProbability = (idx >= 100 && idx < 120) ? 100.0 / 330.0
+      : static_cast<double> (idx * idx) / (330.0 * 330.0);
+    lArrivalPattern[static_cast<stdair::FloatDuration_T> (idx - 330)] =
+      lProbability;
+  }
+
+  // Non monotonic cumulative distribution (as for the preferred departure
+  // time of the built-in BOM tree)
+  TRADEMGEN::ContinuousAttributeLite<stdair::IntDuration_T>::ContinuousDistribution_T lDepartureTime;
+  lDepartureTime[3600] = 0.6;
+  lDepartureTime[21600] = 0.0;
+  lDepartureTime[25200] = 0.1;
+  lDepartureTime[32400] = 0.3;
+  lDepartureTime[61200] = 0.4;
+  lDepartureTime[79200] = 1.0;
+
+  const TRADEMGEN::ContinuousAttributeLite<stdair::FloatDuration_T> lArrivalLinear (lArrivalPattern);
+  const TRADEMGEN::IndexedContinuousAttributeLite<stdair::FloatDuration_T> lArrivalIndexed (lArrivalPattern);
+  const TRADEMGEN::ContinuousAttributeLite<stdair::IntDuration_T> lDepartureLinear (lDepartureTime);
+  const TRADEMGEN::IndexedContinuousAttributeLite<stdair::IntDuration_T> lDepartureIndexed (lDepartureTime);
+
+  const unsigned int lNbOfDraws = 100000;
+  for (unsigned int idx = 0; idx <= lNbOfDraws; ++idx) {
+    const stdair::Probability_T lProbability =
+      static_cast<double> (idx) / lNbOfDraws;
+    BOOST_REQUIRE (lArrivalLinear.getValue (lProbability)
+                   == lArrivalIndexed.getValue (lProbability));
+    BOOST_REQUIRE (lDepartureLinear.getValue (lProbability)
+                   == lDepartureIndexed.getValue (lProbability));
+  }
+
+  // Derivative and upper bound (as used for the FRAT5 curves)
+  for (int idx = -330; idx < 0; ++idx) {
+    const stdair::FloatDuration_T lDTD = idx + 0.5;
+    BOOST_REQUIRE (lArrivalLinear.getDerivativeValue (lDTD)
+                   == lArrivalIndexed.getDerivativeValue (lDTD));
+    BOOST_REQUIRE (lArrivalLinear.getUpperBound (lDTD)
+                   == lArrivalIndexed.getUpperBound (lDTD));
+  }
+
+  // Cumulative distribution function (as used for the Poisson process),
+  // the inverse of which is given by getValue() where the cumulative
+  // distribution is increasing
+  BOOST_CHECK_EQUAL (lArrivalIndexed.getCumulativeProbability (-400.0), 0.0);
+  BOOST_CHECK_CLOSE (lArrivalIndexed.getCumulativeProbability (10.0), 1.0,
+                     1e-4);
+  for (int idx = -329; idx < -231; ++idx) {
+    const stdair::FloatDuration_T lDTD = idx + 0.25;
+    const double lProbability =
+      lArrivalIndexed.getCumulativeProbability (lDTD);
+    BOOST_REQUIRE (std::fabs (lArrivalIndexed.getValue (lProbability) - lDTD)
+                   < 1e-3);
+  }
+  
+}
+
+/**
+ * Test that the alias table draws the values of a categorical
+ * attribute according to their probability masses
+ */
+BOOST_AUTO_TEST_CASE (trademgen_categorical_alias_sampling_test) {
+
+  // Stay duration probability mass (null masses are never drawn)
+  TRADEMGEN::CategoricalAttributeLite<stdair::DayDuration_T>::ProbabilityMassFunction_T lStayDurationMass;
+  lStayDurationMass[0] = 0.01; lStayDurationMass[1] = 0.05;
+  lStayDurationMass[2] = 0.15; lStayDurationMass[3] = 0.0;
+  lStayDurationMass[4] = 0.30; lStayDurationMass[5] = 0.49;
+  const TRADEMGEN::CategoricalAttributeLite<stdair::DayDuration_T> lStayDuration (lStayDurationMass);
+  BOOST_CHECK_EQUAL (lStayDuration.getSize(), 5U);
+
+  // Draw with evenly spread variates
+  std::map<stdair::DayDuration_T, unsigned int> lNbOfDrawsMap;
+  const unsigned int lNbOfDraws = 100000;
+  for (unsigned int idx = 0; idx < lNbOfDraws; ++idx) {
+    const stdair::Probability_T lVariate = (idx + 0.5) / lNbOfDraws;
+    ++lNbOfDrawsMap[lStayDuration.getValueByAlias (lVariate)];
+  }
+  BOOST_CHECK (lStayDuration.checkValue (lStayDuration.getValueByAlias (0.0)));
+  BOOST_CHECK (lStayDuration.checkValue (lStayDuration.getValueByAlias (1.0)));
+
+  // Compare the proportions with the probability masses
+  for (TRADEMGEN::CategoricalAttributeLite<stdair::DayDuration_T>::ProbabilityMassFunction_T::const_iterator itMass = lStayDurationMass.begin();
+       itMass != lStayDurationMass.end(); ++itMass) {
+    const double lProportion =
+      static_cast<double> (lNbOfDrawsMap[itMass->first]) / lNbOfDraws;
+    BOOST_CHECK_SMALL (lProportion - itMass->second, 1e-3);
+  }
+  
+}
+
+/**
+ * Test the joint sampling of the categorical demand characteristics
+ */
+BOOST_AUTO_TEST_CASE (trademgen_joint_characteristics_sampling_test) {
+
+  TRADEMGEN::ArrivalPatternCumulativeDistribution_T lArrivalPattern;
+  lArrivalPattern[-330] = 0.0; lArrivalPattern[0] = 1.0;
+  TRADEMGEN::POSProbabilityMassFunction_T lPOSMass;
+  lPOSMass["SIN"] = 0.7; lPOSMass["BKK"] = 0.3;
+  TRADEMGEN::ChannelProbabilityMassFunction_T lChannelMass;
+  lChannelMass["DF"] = 0.1; lChannelMass["DN"] = 0.3;
+  lChannelMass["IF"] = 0.4; lChannelMass["IN"] = 0.2;
+  TRADEMGEN::TripTypeProbabilityMassFunction_T lTripTypeMass;
+  lTripTypeMass["RO"] = 0.6; lTripTypeMass["RI"] = 0.2;
+  lTripTypeMass["OW"] = 0.2;
+  TRADEMGEN::StayDurationProbabilityMassFunction_T lStayDurationMass;
+  lStayDurationMass[0] = 0.1; lStayDurationMass[1] = 0.1;
+  lStayDurationMass[2] = 0.15; lStayDurationMass[3] = 0.15;
+  lStayDurationMass[4] = 0.15; lStayDurationMass[5] = 0.35;
+  TRADEMGEN::FrequentFlyerProbabilityMassFunction_T lFFMass;
+  lFFMass["P"] = 0.01; lFFMass["G"] = 0.05; lFFMass["S"] = 0.15;
+  lFFMass["M"] = 0.3; lFFMass["N"] = 0.49;
+  TRADEMGEN::PreferredDepartureTimeContinuousDistribution_T lPrefDepTime;
+  lPrefDepTime[21600] = 0.0; lPrefDepTime[79200] = 1.0;
+  TRADEMGEN::ValueOfTimeContinuousDistribution_T lValueOfTime;
+  lValueOfTime[15] = 0.0; lValueOfTime[60] = 1.0;
+
+  TRADEMGEN::DemandCharacteristics lDemandCharacteristics (lArrivalPattern,
+                                                           lPOSMass,
+                                                           lChannelMass,
+                                                           lTripTypeMass,
+                                                           lStayDurationMass,
+                                                           lFFMass, 0.2, 10.0,
+                                                           0.8, 10.0,
+                                                           lPrefDepTime, 200.0,
+                                                           lValueOfTime);
+  BOOST_CHECK (lDemandCharacteristics.isJointCharacteristicsSampled() == false);
+  BOOST_CHECK (lDemandCharacteristics.setJointCharacteristicsSampling (true));
+  BOOST_CHECK (lDemandCharacteristics.isJointCharacteristicsSampled());
+
+  // Draw with evenly spread variates
+  std::map<stdair::ChannelLabel_T, unsigned int> lNbOfChannelDrawsMap;
+  std::map<stdair::DayDuration_T, unsigned int> lNbOfStayDurationDrawsMap;
+  unsigned int lNbOfChangeFees = 0;
+  unsigned int lNbOfNonRefundable = 0;
+  const unsigned int lNbOfDraws = 100000;
+  for (unsigned int idx = 0; idx < lNbOfDraws; ++idx) {
+    const stdair::Probability_T lVariate = (idx + 0.5) / lNbOfDraws;
+    stdair::AirportCode_T lPOS;
+    stdair::ChannelLabel_T lChannelLabel;
+    stdair::TripType_T lTripType;
+    stdair::DayDuration_T lStayDuration;
+    stdair::FrequentFlyer_T lFrequentFlyer;
+    stdair::ChangeFees_T lChangeFees;
+    stdair::NonRefundable_T lNonRefundable;
+    lDemandCharacteristics.getJointCharacteristics (lVariate, lPOS,
+                                                    lChannelLabel, lTripType,
+                                                    lStayDuration,
+                                                    lFrequentFlyer,
+                                                    lChangeFees,
+                                                    lNonRefundable);
+    BOOST_REQUIRE (lDemandCharacteristics.checkPOSValue (lPOS));
+    ++lNbOfChannelDrawsMap[lChannelLabel];
+    ++lNbOfStayDurationDrawsMap[lStayDuration];
+    if (lChangeFees == true) {
+      ++lNbOfChangeFees;
+    }
+    if (lNonRefundable == true) {
+      ++lNbOfNonRefundable;
+    }
+  }
+
+  // Compare the (marginal) proportions with the probabilities
+  for (TRADEMGEN::ChannelProbabilityMassFunction_T::const_iterator itMass =
+         lChannelMass.begin(); itMass != lChannelMass.end(); ++itMass) {
+    const double lProportion =
+      static_cast<double> (lNbOfChannelDrawsMap[itMass->first]) / lNbOfDraws;
+    BOOST_CHECK_SMALL (lProportion - itMass->second, 1e-2);
+  }
+  for (TRADEMGEN::StayDurationProbabilityMassFunction_T::const_iterator itMass =
+         lStayDurationMass.begin(); itMass != lStayDurationMass.end(); ++itMass) {
+    const double lProportion =
+      static_cast<double> (lNbOfStayDurationDrawsMap[itMass->first]) / lNbOfDraws;
+    BOOST_CHECK_SMALL (lProportion - itMass->second, 1e-2);
+  }
+  BOOST_CHECK_SMALL (static_cast<double> (lNbOfChangeFees) / lNbOfDraws - 0.2,
+                     1e-2);
+  BOOST_CHECK_SMALL (static_cast<double> (lNbOfNonRefundable) / lNbOfDraws - 0.8,
+                     1e-2);
+
+  // The codes are the ones of the drawn values
+  const TRADEMGEN::CodePool& lCodePool = TRADEMGEN::CodePool::instance();
+  for (unsigned int idx = 0; idx < 1000; ++idx) {
+    const stdair::Probability_T lVariate = (idx + 0.5) / 1000;
+    stdair::AirportCode_T lPOS;
+    stdair::ChannelLabel_T lChannelLabel;
+    stdair::TripType_T lTripType;
+    stdair::DayDuration_T lStayDuration;
+    stdair::FrequentFlyer_T lFrequentFlyer;
+    stdair::ChangeFees_T lChangeFees;
+    stdair::NonRefundable_T lNonRefundable;
+    lDemandCharacteristics.getJointCharacteristics (lVariate, lPOS,
+                                                    lChannelLabel, lTripType,
+                                                    lStayDuration,
+                                                    lFrequentFlyer,
+                                                    lChangeFees,
+                                                    lNonRefundable);
+    TRADEMGEN::Code_T lPOSCode, lChannelCode, lTripTypeCode, lFFCode;
+    stdair::DayDuration_T lCodeStayDuration;
+    stdair::ChangeFees_T lCodeChangeFees;
+    stdair::NonRefundable_T lCodeNonRefundable;
+    lDemandCharacteristics.getJointCharacteristicCodes (lVariate, lPOSCode,
+                                                        lChannelCode,
+                                                        lTripTypeCode,
+                                                        lCodeStayDuration,
+                                                        lFFCode,
+                                                        lCodeChangeFees,
+                                                        lCodeNonRefundable);
+    BOOST_CHECK_EQUAL (lCodePool.getString (lPOSCode), lPOS);
+    BOOST_CHECK_EQUAL (lCodePool.getString (lChannelCode), lChannelLabel);
+    BOOST_CHECK_EQUAL (lCodePool.getString (lTripTypeCode), lTripType);
+    BOOST_CHECK_EQUAL (lCodePool.getString (lFFCode), lFrequentFlyer);
+    BOOST_CHECK_EQUAL (lCodeStayDuration, lStayDuration);
+    BOOST_CHECK (lCodeChangeFees == lChangeFees);
+    BOOST_CHECK (lCodeNonRefundable == lNonRefundable);
+
+    // Same when the characteristics are drawn one by one
+    BOOST_CHECK_EQUAL (lCodePool.getString (lDemandCharacteristics.getPOSCode (lVariate)),
+                       lDemandCharacteristics.getPOSValue (lVariate));
+    BOOST_CHECK_EQUAL (lCodePool.getString (lDemandCharacteristics.getChannelCode (lVariate)),
+                       lDemandCharacteristics.getChannelValue (lVariate));
+    BOOST_CHECK_EQUAL (lCodePool.getString (lDemandCharacteristics.getTripTypeCode (lVariate)),
+                       lDemandCharacteristics.getTripTypeValue (lVariate));
+    BOOST_CHECK_EQUAL (lCodePool.getString (lDemandCharacteristics.getFrequentFlyerCode (lVariate)),
+                       lDemandCharacteristics.getFrequentFlyerValue (lVariate));
+  }
+
+  // Switch the joint sampling off
+  BOOST_CHECK (lDemandCharacteristics.setJointCharacteristicsSampling (false)
+               == false);
+  BOOST_CHECK (lDemandCharacteristics.isJointCharacteristicsSampled() == false);
+  
+}
+
+/**
+ * Test that the batch look-ups give the same values as the look-ups
+ * made one by one
+ */
+BOOST_AUTO_TEST_CASE (trademgen_batch_sampling_test) {
+
+  // Arrival pattern
+  TRADEMGEN::ArrivalPatternCumulativeDistribution_T lArrivalPattern;
+  for (int idx = 0; idx <= 330; ++idx) {
+    lArrivalPattern[static_cast<stdair::FloatDuration_T> (idx - 330)] =
+      static_cast<double> (idx * idx) / (330.0 * 330.0);
+  }
+  const TRADEMGEN::ContinuousFloatDuration_T lArrivalDistribution (lArrivalPattern);
+
+  // Stay duration
+  TRADEMGEN::StayDurationProbabilityMassFunction_T lStayDurationMass;
+  lStayDurationMass[0] = 0.1; lStayDurationMass[1] = 0.1;
+  lStayDurationMass[2] = 0.15; lStayDurationMass[3] = 0.0;
+  lStayDurationMass[4] = 0.3; lStayDurationMass[5] = 0.35;
+  const TRADEMGEN::StayDurationProbabilityMass_T lStayDuration (lStayDurationMass);
+
+  // Draw the cumulative probabilities (the number of which is not a
+  // multiple of the SIMD width, nor of the chunk size)
+  const std::size_t lNbOfDraws = 10007;
+  std::vector<double> lCumulativeProbabilityArray (lNbOfDraws);
+  for (std::size_t idx = 0; idx < lNbOfDraws; ++idx) {
+    lCumulativeProbabilityArray[idx] =
+      std::fmod (idx * 0.6180339887498949, 1.0);
+  }
+
+  std::vector<stdair::FloatDuration_T> lDTDArray (lNbOfDraws);
+  lArrivalDistribution.getValues (&lCumulativeProbabilityArray[0],
+                                  &lDTDArray[0], lNbOfDraws);
+  std::vector<stdair::DayDuration_T> lStayDurationArray (lNbOfDraws);
+  lStayDuration.getValues (&lCumulativeProbabilityArray[0],
+                           &lStayDurationArray[0], lNbOfDraws);
+
+  // The copies search the same (persistent) table
+  const TRADEMGEN::StayDurationProbabilityMass_T lStayDurationCopy (lStayDuration);
+  std::vector<stdair::DayDuration_T> lStayDurationCopyArray (lNbOfDraws);
+  lStayDurationCopy.getValues (&lCumulativeProbabilityArray[0],
+                               &lStayDurationCopyArray[0], lNbOfDraws);
+  BOOST_CHECK (lStayDurationCopyArray == lStayDurationArray);
+
+  BOOST_TEST_MESSAGE ("Batch look-ups made with the "
+                      << TRADEMGEN::BatchSearch::getInstructionSet()
+                      << " instruction set");
+  for (std::size_t idx = 0; idx < lNbOfDraws; ++idx) {
+    BOOST_REQUIRE (lDTDArray[idx]
+                   == lArrivalDistribution.getValue (lCumulativeProbabilityArray[idx]));
+    BOOST_REQUIRE (lStayDurationArray[idx]
+                   == lStayDuration.getValue (lCumulativeProbabilityArray[idx]));
+  }
+
+  // Unsigned 32-bit keys (with duplicates, and on both sides of 2^31)
+  const boost::uint32_t lIntegerKeyArray[] = { 0u, 1000u, 1000u, 0x7FFFFFFFu,
+                                               0x80000000u, 0xC0000000u,
+                                               0xFFFFFFFFu };
+  const unsigned int lNbOfIntegerKeys =
+    sizeof (lIntegerKeyArray) / sizeof (lIntegerKeyArray[0]);
+  std::vector<boost::uint32_t> lIntegerValueArray (lNbOfDraws);
+  for (std::size_t idx = 0; idx < lNbOfDraws; ++idx) {
+    lIntegerValueArray[idx] = (idx % 3 == 0) ?
+      lIntegerKeyArray[idx % lNbOfIntegerKeys]
+      : static_cast<boost::uint32_t> (idx * 2654435761u);
+  }
+  std::vector<unsigned int> lUpperBoundArray (lNbOfDraws);
+  std::vector<unsigned int> lLowerBoundArray (lNbOfDraws);
+  TRADEMGEN::BatchSearch::getUpperBounds (lIntegerKeyArray, lNbOfIntegerKeys,
+                                          &lIntegerValueArray[0],
+                                          &lUpperBoundArray[0], lNbOfDraws);
+  TRADEMGEN::BatchSearch::getLowerBounds (lIntegerKeyArray, lNbOfIntegerKeys,
+                                          &lIntegerValueArray[0],
+                                          &lLowerBoundArray[0], lNbOfDraws);
+  for (std::size_t idx = 0; idx < lNbOfDraws; ++idx) {
+    BOOST_REQUIRE_EQUAL (lUpperBoundArray[idx],
+                         std::upper_bound (lIntegerKeyArray,
+                                           lIntegerKeyArray + lNbOfIntegerKeys,
+                                           lIntegerValueArray[idx])
+                         - lIntegerKeyArray);
+    BOOST_REQUIRE_EQUAL (lLowerBoundArray[idx],
+                         std::lower_bound (lIntegerKeyArray,
+                                           lIntegerKeyArray + lNbOfIntegerKeys,
+                                           lIntegerValueArray[idx])
+                         - lIntegerKeyArray);
+  }
+
+}
+
+/**
+ * Test the fixed-point coding of the probabilities
+ */
+BOOST_AUTO_TEST_CASE (trademgen_dictionary_key_test) {
+
+  // Bounds (and out-of-range values)
+  BOOST_CHECK_EQUAL (TRADEMGEN::DictionaryManager::valueToKey (0.0), 0U);
+  BOOST_CHECK_EQUAL (TRADEMGEN::DictionaryManager::valueToKey (-0.5), 0U);
+  BOOST_CHECK_EQUAL (TRADEMGEN::DictionaryManager::valueToKey (1.0),
+                     TRADEMGEN::DictionaryManager::KEY_MAX);
+  BOOST_CHECK_EQUAL (TRADEMGEN::DictionaryManager::valueToKey (1.5),
+                     TRADEMGEN::DictionaryManager::KEY_MAX);
+
+  // Rounding to the nearest key, in a non-decreasing way
+  const double lMaxError = 0.5 / TRADEMGEN::DictionaryManager::KEY_MAX;
+  TRADEMGEN::DictionaryKey_T lPreviousKey = 0;
+  for (unsigned int idx = 0; idx <= 100000; ++idx) {
+    const stdair::Probability_T lValue = idx / 100000.0;
+    const TRADEMGEN::DictionaryKey_T lKey =
+      TRADEMGEN::DictionaryManager::valueToKey (lValue);
+    BOOST_REQUIRE (lKey >= lPreviousKey);
+    lPreviousKey = lKey;
+
+    const double lDecodedValue = TRADEMGEN::DictionaryManager::keyToValue (lKey);
+    BOOST_REQUIRE (std::fabs (lDecodedValue - static_cast<double> (lValue))
+                   <= lMaxError + std::numeric_limits<stdair::Probability_T>::epsilon());
+  }
+}
+
+/**
+ * Test the sharing of the demand characteristics
+ */
+BOOST_AUTO_TEST_CASE (trademgen_demand_characteristics_pool_test) {
+
+  TRADEMGEN::ArrivalPatternCumulativeDistribution_T lArrivalPattern;
+  lArrivalPattern[-330] = 0.0; lArrivalPattern[0] = 1.0;
+  TRADEMGEN::POSProbabilityMassFunction_T lPOSMass;
+  lPOSMass["SIN"] = 0.7; lPOSMass["BKK"] = 0.3;
+  TRADEMGEN::ChannelProbabilityMassFunction_T lChannelMass;
+  lChannelMass["DN"] = 0.4; lChannelMass["IN"] = 0.6;
+  TRADEMGEN::TripTypeProbabilityMassFunction_T lTripTypeMass;
+  lTripTypeMass["RO"] = 0.8; lTripTypeMass["OW"] = 0.2;
+  TRADEMGEN::StayDurationProbabilityMassFunction_T lStayDurationMass;
+  lStayDurationMass[0] = 0.5; lStayDurationMass[7] = 0.5;
+  TRADEMGEN::FrequentFlyerProbabilityMassFunction_T lFFMass;
+  lFFMass["M"] = 0.3; lFFMass["N"] = 0.7;
+  TRADEMGEN::PreferredDepartureTimeContinuousDistribution_T lPrefDepTime;
+  lPrefDepTime[21600] = 0.0; lPrefDepTime[79200] = 1.0;
+  TRADEMGEN::ValueOfTimeContinuousDistribution_T lValueOfTime;
+  lValueOfTime[15] = 0.0; lValueOfTime[60] = 1.0;
+
+  TRADEMGEN::DemandCharacteristicsPool& lPool =
+    TRADEMGEN::DemandCharacteristicsPool::instance();
+  const unsigned int lInitialPoolSize = lPool.getSize();
+
+  // Two demand characteristics built from the same distributions
+  const TRADEMGEN::DemandCharacteristics lDC1 (lArrivalPattern, lPOSMass,
+                                               lChannelMass, lTripTypeMass,
+                                               lStayDurationMass, lFFMass,
+                                               0.2, 10.0, 0.8, 10.0,
+                                               lPrefDepTime, 200.0,
+                                               lValueOfTime);
+  const TRADEMGEN::DemandCharacteristics lDC2 (lArrivalPattern, lPOSMass,
+                                               lChannelMass, lTripTypeMass,
+                                               lStayDurationMass, lFFMass,
+                                               0.2, 10.0, 0.8, 10.0,
+                                               lPrefDepTime, 200.0,
+                                               lValueOfTime);
+  BOOST_CHECK (lDC1 == lDC2);
+  BOOST_CHECK_EQUAL (lDC1.getHashValue(), lDC2.getHashValue());
+
+  // And a third one, with another minimum WTP
+  const TRADEMGEN::DemandCharacteristics lDC3 (lArrivalPattern, lPOSMass,
+                                               lChannelMass, lTripTypeMass,
+                                               lStayDurationMass, lFFMass,
+                                               0.2, 10.0, 0.8, 10.0,
+                                               lPrefDepTime, 300.0,
+                                               lValueOfTime);
+  BOOST_CHECK (!(lDC1 == lDC3));
+
+  {
+    const TRADEMGEN::DemandCharacteristicsPtr_T lDC1_ptr = lPool.intern (lDC1);
+    const TRADEMGEN::DemandCharacteristicsPtr_T lDC2_ptr = lPool.intern (lDC2);
+    const TRADEMGEN::DemandCharacteristicsPtr_T lDC3_ptr = lPool.intern (lDC3);
+    BOOST_CHECK (lDC1_ptr == lDC2_ptr);
+    BOOST_CHECK (lDC1_ptr != lDC3_ptr);
+    BOOST_CHECK_EQUAL (lPool.getSize(), lInitialPoolSize + 2);
+  }
+
+  // The characteristics are released along with their last user
+  BOOST_CHECK_EQUAL (lPool.getSize(), lInitialPoolSize);
+
+  // The entries of the released characteristics do not pile up
+  for (unsigned int idx = 0; idx != 1000; ++idx) {
+    const TRADEMGEN::DemandCharacteristics lDC (lArrivalPattern, lPOSMass,
+                                                lChannelMass, lTripTypeMass,
+                                                lStayDurationMass, lFFMass,
+                                                0.2, 10.0, 0.8, 10.0,
+                                                lPrefDepTime, 400.0 + idx,
+                                                lValueOfTime);
+    BOOST_REQUIRE (lPool.intern (lDC) != NULL);
+  }
+  BOOST_CHECK_EQUAL (lPool.getSize(), lInitialPoolSize);
+  BOOST_CHECK_LE (lPool.getNbOfEntries(),
+                  std::max (2 * (lInitialPoolSize + 1),
+                            TRADEMGEN::DemandCharacteristicsPool::SWEEP_THRESHOLD));
+}
+
+/**
+ * Test the ziggurat samplers against the first moments and the tails
+ * of the exponential and normal distributions.
+ */
+BOOST_AUTO_TEST_CASE (trademgen_ziggurat_sampler_test) {
+
+  const unsigned int lNbOfDraws = 1000000;
+  stdair::BaseGenerator_T lGenerator (stdair::DEFAULT_RANDOM_SEED);
+
+  // Exponential distribution of rate 2
+  const TRADEMGEN::ZigguratSampler
+    lExponentialSampler (TRADEMGEN::ZigguratSampler::EXPONENTIAL);
+  double lSum = 0.0;
+  double lSumOfSquares = 0.0;
+  unsigned int lNbOfTailDraws = 0;
+  for (unsigned int idx = 0; idx < lNbOfDraws; ++idx) {
+    const double lX = lExponentialSampler.generateExponential (lGenerator, 2.0);
+    BOOST_REQUIRE (lX >= 0.0);
+    lSum += lX;
+    lSumOfSquares += lX * lX;
+    if (lX > 3.0) {
+      ++lNbOfTailDraws;
+    }
+  }
+  double lMean = lSum / lNbOfDraws;
+  BOOST_CHECK_CLOSE (lMean, 0.5, 1.0);
+  BOOST_CHECK_CLOSE (lSumOfSquares / lNbOfDraws - lMean * lMean, 0.25, 1.0);
+  BOOST_CHECK_CLOSE (static_cast<double> (lNbOfTailDraws) / lNbOfDraws,
+                     std::exp (-6.0), 15.0);
+
+  // Normal distribution of mean 10 and standard deviation 3
+  const TRADEMGEN::ZigguratSampler
+    lNormalSampler (TRADEMGEN::ZigguratSampler::NORMAL);
+  lSum = 0.0;
+  lSumOfSquares = 0.0;
+  lNbOfTailDraws = 0;
+  for (unsigned int idx = 0; idx < lNbOfDraws; ++idx) {
+    const double lX = lNormalSampler.generateNormal (lGenerator, 10.0, 3.0);
+    lSum += lX;
+    lSumOfSquares += lX * lX;
+    if (std::fabs (lX - 10.0) > 9.0) {
+      ++lNbOfTailDraws;
+    }
+  }
+  lMean = lSum / lNbOfDraws;
+  BOOST_CHECK_CLOSE (lMean, 10.0, 0.1);
+  BOOST_CHECK_CLOSE (lSumOfSquares / lNbOfDraws - lMean * lMean, 9.0, 1.0);
+  BOOST_CHECK_CLOSE (static_cast<double> (lNbOfTailDraws) / lNbOfDraws,
+                     std::erfc (3.0 / std::sqrt (2.0)), 15.0);
+}
+
+/**
+ * Test the counter-based random generator: known answers of
+ * Philox4x32-10, two draws per block, skip-ahead and independence from
+ * the creation order.
+ */
+BOOST_AUTO_TEST_CASE (trademgen_counter_based_generation_test) {
+
+  // Known answers (from the Random123 reference implementation)
+  const boost::uint32_t lCounter[4] = { 0x243f6a88u, 0x85a308d3u,
+                                        0x13198a2eu, 0x03707344u };
+  const boost::uint32_t lKey[2] = { 0xa4093822u, 0x299f31d0u };
+  boost::uint32_t lBlock[4];
+  TRADEMGEN::CounterBasedRandomGeneration::generateBlock (lCounter, lKey,
+                                                          lBlock);
+  BOOST_CHECK_EQUAL (lBlock[0], 0xd16cfe09u);
+  BOOST_CHECK_EQUAL (lBlock[1], 0x94fdccebu);
+  BOOST_CHECK_EQUAL (lBlock[2], 0x5001e420u);
+  BOOST_CHECK_EQUAL (lBlock[3], 0x24126ea1u);
+
+  const TRADEMGEN::CounterBasedRandomGeneration::StreamId_T lStreamId =
+    TRADEMGEN::CounterBasedRandomGeneration::generateStreamId ("SIN-BKK");
+  BOOST_CHECK (lStreamId !=
+               TRADEMGEN::CounterBasedRandomGeneration::generateStreamId ("SIN-HKG"));
+  BOOST_CHECK (TRADEMGEN::CounterBasedRandomGeneration::generateStreamId (lStreamId, 1)
+               != TRADEMGEN::CounterBasedRandomGeneration::generateStreamId (lStreamId, 2));
+  BOOST_CHECK (TRADEMGEN::CounterBasedRandomGeneration::getFirstDrawIndex (1)
+               > TRADEMGEN::CounterBasedRandomGeneration::getFirstDrawIndex (0));
+
+  // The first two draws are given by the two halves of the first block
+  const boost::uint32_t lFirstCounter[4] = {
+    0, 0, static_cast<boost::uint32_t> (lStreamId),
+    static_cast<boost::uint32_t> (lStreamId >> 32)
+  };
+  const boost::uint64_t lSeed = stdair::DEFAULT_RANDOM_SEED;
+  const boost::uint32_t lSeedKey[2] = {
+    static_cast<boost::uint32_t> (lSeed),
+    static_cast<boost::uint32_t> (lSeed >> 32)
+  };
+  TRADEMGEN::CounterBasedRandomGeneration::generateBlock (lFirstCounter,
+                                                          lSeedKey, lBlock);
+
+  // Draws within [0, 1), with the expected mean
+  const unsigned int lNbOfDraws = 100000;
+  TRADEMGEN::CounterBasedRandomGeneration lGenerator (stdair::DEFAULT_RANDOM_SEED,
+                                                      lStreamId);
+  std::vector<stdair::RealNumber_T> lDrawList;
+  double lSum = 0.0;
+  for (unsigned int idx = 0; idx < lNbOfDraws; ++idx) {
+    const stdair::RealNumber_T lDraw = lGenerator();
+    BOOST_REQUIRE (lDraw >= 0.0 && lDraw < 1.0);
+    lDrawList.push_back (lDraw);
+    lSum += lDraw;
+  }
+  BOOST_CHECK_CLOSE (lSum / lNbOfDraws, 0.5, 1.0);
+  BOOST_CHECK_EQUAL (lGenerator.getDrawIndex(), lNbOfDraws);
+  BOOST_CHECK_EQUAL (lDrawList[0],
+                     ((lBlock[0] >> 5) * 67108864.0 + (lBlock[1] >> 6))
+                     / 9007199254740992.0);
+  BOOST_CHECK_EQUAL (lDrawList[1],
+                     ((lBlock[2] >> 5) * 67108864.0 + (lBlock[3] >> 6))
+                     / 9007199254740992.0);
+
+  // Skip-ahead, and another generator interleaved with the first one
+  TRADEMGEN::CounterBasedRandomGeneration lOtherGenerator;
+  lOtherGenerator.init (stdair::DEFAULT_RANDOM_SEED, lStreamId + 1);
+  lGenerator.setDrawIndex (lNbOfDraws - 11);
+  for (unsigned int idx = lNbOfDraws - 11; idx < lNbOfDraws; ++idx) {
+    lOtherGenerator();
+    BOOST_CHECK_EQUAL (lGenerator(), lDrawList[idx]);
+  }
+  lGenerator.init (stdair::DEFAULT_RANDOM_SEED, lStreamId);
+  lGenerator.discard (5);
+  BOOST_CHECK_EQUAL (lGenerator(), lDrawList[5]);
+
+  // Batch of draws (of a size which is not a multiple of the SIMD
+  // width), over several streams and draw indexes
+  const unsigned int lNbOfBatchDraws = 37;
+  std::vector<TRADEMGEN::CounterBasedRandomGeneration::StreamId_T> lStreamIdList;
+  std::vector<TRADEMGEN::CounterBasedRandomGeneration::DrawIndex_T> lDrawIndexList;
+  for (unsigned int idx = 0; idx < lNbOfBatchDraws; ++idx) {
+    lStreamIdList.push_back (lStreamId + idx % 3);
+    lDrawIndexList.push_back (idx * 0x10000001ull);
+  }
+  std::vector<stdair::RealNumber_T> lBatchDrawList (lNbOfBatchDraws);
+  TRADEMGEN::CounterBasedRandomGeneration::
+    generateUniforms01 (stdair::DEFAULT_RANDOM_SEED, &lStreamIdList[0],
+                        &lDrawIndexList[0], &lBatchDrawList[0],
+                        lNbOfBatchDraws);
+  for (unsigned int idx = 0; idx < lNbOfBatchDraws; ++idx) {
+    lOtherGenerator.init (stdair::DEFAULT_RANDOM_SEED, lStreamIdList[idx]);
+    lOtherGenerator.setDrawIndex (lDrawIndexList[idx]);
+    BOOST_CHECK_EQUAL (lOtherGenerator(), lBatchDrawList[idx]);
+  }
+  BOOST_TEST_MESSAGE ("Batch draws made with the "
+                      << TRADEMGEN::CounterBasedRandomGeneration::getInstructionSet()
+                      << " instruction set");
+}
+
+/**
+ * Test the generation of the order statistics in log space, against
+ * the former formula (i.e., 1 - (1 - x(k - 1))(1 - y)^{1/(n - k + 1)})
+ */
+BOOST_AUTO_TEST_CASE (trademgen_order_statistics_test) {
+
+  const TRADEMGEN::CounterBasedRandomGeneration::StreamId_T lStreamId =
+    TRADEMGEN::CounterBasedRandomGeneration::generateStreamId ("SIN-BKK");
+
+  // Same cumulative probabilities as the former formula, for the same
+  // uniform variates
+  const stdair::Count_T lSmallNbOfRequests = 1000;
+  TRADEMGEN::CounterBasedRandomGeneration lGenerator (stdair::DEFAULT_RANDOM_SEED,
+                                                      lStreamId);
+  TRADEMGEN::RandomGenerationContext lContext;
+  double lFormerCumulativeProbability = 0.0;
+  for (stdair::Count_T idx = 0; idx < lSmallNbOfRequests; ++idx) {
+    const stdair::Probability_T lVariate = lGenerator();
+    const stdair::Count_T lRemainingNbOfRequests = lSmallNbOfRequests - idx;
+    lFormerCumulativeProbability = 1.0 - (1.0 - lFormerCumulativeProbability)
+      * std::pow (1.0 - lVariate, 1.0 / lRemainingNbOfRequests);
+
+    const stdair::Probability_T lCumulativeProbability =
+      lContext.advanceCumulativeProbabilitySoFar (lVariate,
+                                                  lRemainingNbOfRequests);
+    BOOST_REQUIRE_SMALL (lCumulativeProbability - lFormerCumulativeProbability,
+                         1e-12);
+  }
+
+  // Non-decreasing cumulative probabilities staying below 1, for a
+  // large number of requests (for which the former formula had to be
+  // clamped)
+  const stdair::Count_T lLargeNbOfRequests = 100000;
+  lGenerator.init (stdair::DEFAULT_RANDOM_SEED, lStreamId);
+  lContext.reset();
+  stdair::Probability_T lPreviousCumulativeProbability = 0.0;
+  for (stdair::Count_T idx = 0; idx < lLargeNbOfRequests; ++idx) {
+    const stdair::Probability_T lCumulativeProbability =
+      lContext.advanceCumulativeProbabilitySoFar (lGenerator(),
+                                                  lLargeNbOfRequests - idx);
+    BOOST_REQUIRE (lCumulativeProbability >= lPreviousCumulativeProbability);
+    BOOST_REQUIRE (lCumulativeProbability < 1.0);
+    lPreviousCumulativeProbability = lCumulativeProbability;
+  }
+  BOOST_CHECK (lContext.getLogComplementOfCumulativeProbabilitySoFar() < 0.0);
+
+}
+
+/**
+ * Test the interning of the codes, within the demand stream keys and
+ * the categorical attributes.
+ */
+BOOST_AUTO_TEST_CASE (trademgen_code_pool_test) {
+
+  TRADEMGEN::CodePool& lCodePool = TRADEMGEN::CodePool::instance();
+  const TRADEMGEN::Code_T lSINCode = lCodePool.intern ("SIN");
+  const unsigned int lSize = lCodePool.getSize();
+  BOOST_CHECK_EQUAL (lCodePool.intern ("SIN"), lSINCode);
+  BOOST_CHECK_EQUAL (lCodePool.getSize(), lSize);
+  BOOST_CHECK_EQUAL (lCodePool.getString (lSINCode), "SIN");
+
+  // The keys are compared on their codes
+  const stdair::Date_T lDate (2010, 2, 8);
+  const TRADEMGEN::DemandStreamKey lKey ("SIN", "BKK", lDate, "Y");
+  const TRADEMGEN::DemandStreamKey lSameKey ("SIN", "BKK", lDate, "Y");
+  const TRADEMGEN::DemandStreamKey lOtherKey ("BKK", "SIN", lDate, "Y");
+  BOOST_CHECK_EQUAL (lKey.getOriginCode(), lSINCode);
+  BOOST_CHECK (lKey == lSameKey);
+  BOOST_CHECK_EQUAL (lKey.getHashValue(), lSameKey.getHashValue());
+  BOOST_CHECK (!(lKey == lOtherKey));
+  BOOST_CHECK_EQUAL (lKey.toString(), "SIN-BKK 2010-Feb-08 Y");
+
+  // The string values of the categorical attributes are given back
+  TRADEMGEN::POSProbabilityMassFunction_T lPOSMassFunction;
+  lPOSMassFunction["SIN"] = 0.7;
+  lPOSMassFunction["BKK"] = 0.3;
+  const TRADEMGEN::POSProbabilityMass_T lPOSMass (lPOSMassFunction);
+  BOOST_CHECK_EQUAL (lPOSMass.getValue (0.1), "BKK");
+  BOOST_CHECK_EQUAL (lPOSMass.getValue (0.9), "SIN");
+  BOOST_CHECK (lPOSMass.checkValue ("SIN"));
+  BOOST_CHECK (!lPOSMass.checkValue ("HKG"));
+
+  // The strings are given back while another thread interns new ones
+  // (spanning several chunks of the pool)
+  const unsigned int lNbOfNewStrings = 5000;
+  std::vector<TRADEMGEN::Code_T> lNewCodeList (lNbOfNewStrings);
+  std::thread lInterningThread ([&lCodePool, &lNewCodeList]() {
+      for (std::size_t idx = 0; idx != lNewCodeList.size(); ++idx) {
+        std::ostringstream oStr;
+        oStr << "CODE-POOL-TEST-" << idx;
+        lNewCodeList[idx] = lCodePool.intern (oStr.str());
+      }
+    });
+  unsigned int lNbOfEmptyStrings = 0;
+  while (lCodePool.getSize() < lSize + lNbOfNewStrings) {
+    const unsigned int lCurrentSize = lCodePool.getSize();
+    if (lCodePool.getString (lCurrentSize - 1).empty() == true) {
+      ++lNbOfEmptyStrings;
+    }
+    BOOST_REQUIRE_EQUAL (lCodePool.getString (lSINCode), "SIN");
+  }
+  lInterningThread.join();
+  BOOST_CHECK_EQUAL (lNbOfEmptyStrings, 0U);
+  for (std::size_t idx = 0; idx != lNbOfNewStrings; ++idx) {
+    std::ostringstream oStr;
+    oStr << "CODE-POOL-TEST-" << idx;
+    BOOST_REQUIRE_EQUAL (lCodePool.getString (lNewCodeList[idx]), oStr.str());
+    BOOST_REQUIRE_EQUAL (lCodePool.getCode (oStr.str()), lNewCodeList[idx]);
+  }
+}
+
+/**
+ * Test the small vectors, which store the distribution tables inline
+ * up to a given size, and spill over to the heap beyond it.
+ */
+BOOST_AUTO_TEST_CASE (trademgen_small_vector_test) {
+
+  // Inline storage, up to the inline capacity
+  TRADEMGEN::SmallVector<double, 4> lSmallVector;
+  for (unsigned int idx = 0; idx < 4; ++idx) {
+    lSmallVector.push_back (idx * 0.5);
+  }
+  BOOST_CHECK (lSmallVector.isInline());
+  BOOST_CHECK_EQUAL (lSmallVector.size(), 4U);
+  BOOST_CHECK_EQUAL (lSmallVector.back(), 1.5);
+
+  // Copies are independent from the original
+  TRADEMGEN::SmallVector<double, 4> lCopy (lSmallVector);
+  BOOST_CHECK (lCopy.isInline());
+  BOOST_CHECK (lCopy == lSmallVector);
+  lCopy[0] = 10.0;
+  BOOST_CHECK (lCopy != lSmallVector);
+
+  // Heap storage beyond the inline capacity (including when pushing
+  // back one of the elements themselves)
+  lSmallVector.push_back (lSmallVector[1]);
+  BOOST_CHECK (lSmallVector.isInline() == false);
+  BOOST_CHECK_EQUAL (lSmallVector.size(), 5U);
+  for (unsigned int idx = 0; idx < 4; ++idx) {
+    BOOST_CHECK_EQUAL (lSmallVector[idx], idx * 0.5);
+  }
+  BOOST_CHECK_EQUAL (lSmallVector.back(), 0.5);
+  BOOST_CHECK_THROW (lSmallVector.at (5), std::out_of_range);
+
+  lCopy = lSmallVector;
+  BOOST_CHECK (lCopy == lSmallVector);
+  lCopy.assign (3, 2.0);
+  BOOST_CHECK_EQUAL (lCopy.size(), 3U);
+  BOOST_CHECK_EQUAL (lCopy.front(), 2.0);
+
+  // The typical distributions are stored inline
+  TRADEMGEN::CategoricalAttributeLite<stdair::TripType_T>::ProbabilityMassFunction_T lTripTypeMass;
+  lTripTypeMass["RO"] = 0.6; lTripTypeMass["RI"] = 0.2; lTripTypeMass["OW"] = 0.2;
+  const TRADEMGEN::CategoricalAttributeLite<stdair::TripType_T> lTripType (lTripTypeMass);
+  BOOST_CHECK (lTripType.getProbabilityMassArray().isInline());
+  BOOST_CHECK_EQUAL (lTripType.getValueByAlias (0.0), lTripType.getValueAt (0));
+}
+
+/**
+ * Test the compact booking request records, and the conversions of
+ * their (epoch) date-times
+ */
+BOOST_AUTO_TEST_CASE (trademgen_booking_request_record_test) {
+
+  // The records are meant to fit within a cache line
+  BOOST_CHECK_LE (sizeof (TRADEMGEN::BookingRequestRecord), 64U);
+
+  // Origin of the epoch times
+  const stdair::DateTime_T lEpoch (stdair::Date_T (1970, 1, 1));
+  BOOST_CHECK_EQUAL (TRADEMGEN::EpochTimeManager::convertIntoEpochTime (lEpoch),
+                     0);
+  BOOST_CHECK (TRADEMGEN::EpochTimeManager::convertIntoDateTime (0) == lEpoch);
+
+  // The date-times of the requests are kept to the millisecond
+  const stdair::DateTime_T lDateTime (stdair::Date_T (2011, 2, 1),
+                                      boost::posix_time::hours (8)
+                                      - boost::posix_time::seconds (7)
+                                      + boost::posix_time::millisec (751));
+  const TRADEMGEN::EpochTime_T lEpochTime =
+    TRADEMGEN::EpochTimeManager::convertIntoEpochTime (lDateTime);
+  BOOST_CHECK_EQUAL (lEpochTime, 1296547193751LL);
+  BOOST_CHECK (TRADEMGEN::EpochTimeManager::convertIntoDateTime (lEpochTime)
+               == lDateTime);
+
+  // Date-times before the origin
+  const stdair::DateTime_T lOldDateTime (stdair::Date_T (1969, 12, 31),
+                                         boost::posix_time::millisec (1));
+  const TRADEMGEN::EpochTime_T lOldEpochTime =
+    TRADEMGEN::EpochTimeManager::convertIntoEpochTime (lOldDateTime);
+  BOOST_CHECK_EQUAL (lOldEpochTime, 1 - TRADEMGEN::EpochTimeManager::
+                     MILLISECONDS_IN_ONE_DAY);
+  BOOST_CHECK (TRADEMGEN::EpochTimeManager::convertIntoDateTime (lOldEpochTime)
+               == lOldDateTime);
+
+  // Numbers of days (e.g., for the advance purchases)
+  BOOST_CHECK_EQUAL (TRADEMGEN::EpochTimeManager::getNbOfDays (lOldEpochTime),
+                     -1);
+  BOOST_CHECK_EQUAL (TRADEMGEN::EpochTimeManager::getNbOfDays (lEpochTime)
+                     - TRADEMGEN::EpochTimeManager::getNbOfDays (lOldEpochTime),
+                     (lDateTime.date() - lOldDateTime.date()).days());
+}
+
+/**
+ * Test that the booking request structures are recycled by their pool
+ */
+BOOST_AUTO_TEST_CASE (trademgen_booking_request_pool_test) {
+
+  const stdair::Date_T lDepartureDate (2011, 2, 1);
+  const stdair::DateTime_T lRequestDateTime (stdair::Date_T (2011, 1, 7),
+                                             boost::posix_time::hours (12));
+  const stdair::BookingRequestStruct
+    lBookingRequestStruct ("SIN-BKK 2011-Feb-01 Y", "SIN", "BKK", "SIN",
+                           lDepartureDate, lRequestDateTime, "Y", 1, "IF",
+                           "RO", 5, "M", boost::posix_time::hours (18),
+                           358.5, 33.5, true, 50.0, false, 50.0);
+
+  stdair::BookingRequestPtr_T lFirstRequest_ptr =
+    TRADEMGEN::BookingRequestPool::create (lBookingRequestStruct);
+  const stdair::BookingRequestPtr_T lSecondRequest_ptr =
+    TRADEMGEN::BookingRequestPool::create (lBookingRequestStruct);
+  BOOST_REQUIRE (lFirstRequest_ptr != NULL && lSecondRequest_ptr != NULL);
+  BOOST_CHECK (lFirstRequest_ptr != lSecondRequest_ptr);
+  BOOST_CHECK_EQUAL (lSecondRequest_ptr->describe(),
+                     lBookingRequestStruct.describe());
+
+  // The block of a released request is given to the next one
+  const stdair::BookingRequestStruct* lFirstRequestAddress =
+    lFirstRequest_ptr.get();
+  lFirstRequest_ptr.reset();
+  const stdair::BookingRequestPtr_T lThirdRequest_ptr =
+    TRADEMGEN::BookingRequestPool::create (lBookingRequestStruct);
+  BOOST_CHECK (lThirdRequest_ptr.get() == lFirstRequestAddress);
+
+  // The same structure may be built in place, within its block
+  const stdair::BookingRequestPtr_T lInPlaceRequest_ptr =
+    TRADEMGEN::BookingRequestPool::
+    create ("SIN-BKK 2011-Feb-01 Y", "SIN", "BKK", "SIN", lDepartureDate,
+            lRequestDateTime, "Y", 1, "IF", "RO", 5, "M",
+            boost::posix_time::hours (18), 358.5, 33.5, true, 50.0, false,
+            50.0);
+  BOOST_REQUIRE (lInPlaceRequest_ptr != NULL);
+  BOOST_CHECK_EQUAL (lInPlaceRequest_ptr->describe(),
+                     lBookingRequestStruct.describe());
+}
+
+/**
+ * Test that the binary trace sink receives the records of all the
+ * generated requests, in the order of their generation
+ */
+BOOST_AUTO_TEST_CASE (trademgen_binary_trace_sink_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_4.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the TraDemGen service object, with the default BOM tree
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+  TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                 stdair::DEFAULT_RANDOM_SEED);
+  trademgenService.buildSampleBom();
+
+  // Small buffers, so that many of them are handed over to the writer
+  std::ostringstream lTraceStream;
+  const boost::shared_ptr<TRADEMGEN::BinaryTraceSink> lTraceSink_ptr =
+    boost::make_shared<TRADEMGEN::BinaryTraceSink> (boost::ref (lTraceStream),
+                                                    256);
+  trademgenService.setTraceSink (lTraceSink_ptr);
+
+  // Generate all the requests of all the demand streams
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+  std::vector<TRADEMGEN::BookingRequestRecord> lRecordList;
+  for (TRADEMGEN::DemandStreamHandle_T lHandle = 0;
+       lHandle != trademgenService.getNbOfDemandStreams(); ++lHandle) {
+    stdair::ProgressStatusSet lPSS (stdair::EventType::BKG_REQ);
+    while (trademgenService.
+           stillHavingRequestsToBeGenerated (lHandle, lPSS,
+                                             lDemandGenerationMethod) == true) {
+      TRADEMGEN::BookingRequestRecord lRecord;
+      trademgenService.generateNextRequest (lHandle, lRecord,
+                                            lDemandGenerationMethod);
+      lRecordList.push_back (lRecord);
+    }
+  }
+  lTraceSink_ptr->flush();
+
+  // Nothing is traced any more
+  trademgenService.setTraceSink (TRADEMGEN::TraceSinkPtr_T());
+
+  // Browse the trace: each request is traced by its time, then by its record
+  const std::string lTrace = lTraceStream.str();
+  const std::size_t lTimeOfRequestSize =
+    1 + sizeof (TRADEMGEN::DemandStreamHandle_T) + sizeof (double);
+  const std::size_t lBookingRequestSize =
+    1 + sizeof (TRADEMGEN::BookingRequestRecord);
+  std::size_t lNbOfRecords = 0;
+  for (std::size_t idx = 0; idx < lTrace.size(); ) {
+    if (lTrace[idx] == TRADEMGEN::BinaryTraceSink::TIME_OF_REQUEST_TAG) {
+      idx += lTimeOfRequestSize;
+      continue;
+    }
+    BOOST_REQUIRE_EQUAL (lTrace[idx],
+                         TRADEMGEN::BinaryTraceSink::BOOKING_REQUEST_TAG);
+    BOOST_REQUIRE_LE (idx + lBookingRequestSize, lTrace.size());
+    BOOST_REQUIRE_LT (lNbOfRecords, lRecordList.size());
+    BOOST_CHECK (std::memcmp (lTrace.data() + idx + 1,
+                              &lRecordList[lNbOfRecords],
+                              sizeof (TRADEMGEN::BookingRequestRecord)) == 0);
+    idx += lBookingRequestSize;
+    ++lNbOfRecords;
+  }
+  BOOST_CHECK_EQUAL (lNbOfRecords, lRecordList.size());
+  BOOST_CHECK_EQUAL (lTrace.size(), lRecordList.size()
+                     * (lTimeOfRequestSize + lBookingRequestSize));
+}
+
+/**
+ * Describe all the booking requests of the default BOM tree, generated
+ * with a new TraDemGen service (hence, with the same random seed),
+ * either as records then built with createBookingRequest(), or
+ * directly as booking request structures
+ */
+std::vector<std::string> describeBookingRequests (const stdair::BasLogParams& iLogParams,
+                                                  const bool isRecordBased,
+                                                  const bool isJointSampled) {
+  TRADEMGEN::TRADEMGEN_Service trademgenService (iLogParams,
+                                                 stdair::DEFAULT_RANDOM_SEED);
+  trademgenService.buildSampleBom();
+  trademgenService.setJointCharacteristicsSampling (isJointSampled);
+
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+  std::vector<std::string> oDescriptionList;
+  for (TRADEMGEN::DemandStreamHandle_T lHandle = 0;
+       lHandle != trademgenService.getNbOfDemandStreams(); ++lHandle) {
+    stdair::ProgressStatusSet lPSS (stdair::EventType::BKG_REQ);
+    while (trademgenService.
+           stillHavingRequestsToBeGenerated (lHandle, lPSS,
+                                             lDemandGenerationMethod)) {
+      if (isRecordBased == true) {
+        TRADEMGEN::BookingRequestRecord lRecord;
+        trademgenService.generateNextRequest (lHandle, lRecord,
+                                              lDemandGenerationMethod);
+        oDescriptionList.push_back (trademgenService.
+                                    createBookingRequest (lRecord)->describe());
+      } else {
+        oDescriptionList.push_back (trademgenService.
+                                    generateNextRequest (lHandle,
+                                                         lDemandGenerationMethod)->describe());
+      }
+    }
+  }
+  return oDescriptionList;
+}
+
+/**
+ * Test that the booking requests built from the records are the same
+ * as the ones generated directly, for the same random seed
+ */
+BOOST_AUTO_TEST_CASE (trademgen_booking_request_record_path_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_10.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+
+  // With the characteristics drawn one by one, then all at once
+  for (unsigned short isJointSampled = 0; isJointSampled != 2;
+       ++isJointSampled) {
+    const std::vector<std::string> lRecordRequestList =
+      describeBookingRequests (lLogParams, true, isJointSampled == 1);
+    const std::vector<std::string> lRequestList =
+      describeBookingRequests (lLogParams, false, isJointSampled == 1);
+    BOOST_CHECK_GT (lRecordRequestList.size(), 0U);
+    BOOST_CHECK (lRecordRequestList == lRequestList);
+  }
+}
+
+/**
+ * Consumer checking the order of the booking requests, and stopping
+ * the generation after a given number of them
+ */
+class OrderCheckingConsumer : public TRADEMGEN::BookingRequestConsumer {
+public:
+  OrderCheckingConsumer (const stdair::Count_T iMaxNbOfRequests)
+    : _maxNbOfRequests (iMaxNbOfRequests), _nbOfRequests (0),
+      _nbOfUnorderedRequests (0), _lastRequestDateTime (0) {
+  }
+
+  bool consume (const TRADEMGEN::DemandStream& iDemandStream,
+                const TRADEMGEN::BookingRequestRecord& iBookingRequestRecord) {
+    if (iBookingRequestRecord._requestDateTime < _lastRequestDateTime
+        || iDemandStream.getHandle()
+        != iBookingRequestRecord._demandStreamHandle) {
+      ++_nbOfUnorderedRequests;
+    }
+    _lastRequestDateTime = iBookingRequestRecord._requestDateTime;
+    ++_nbOfRequests;
+    return (_nbOfRequests < _maxNbOfRequests);
+  }
+
+  const stdair::Count_T _maxNbOfRequests;
+  stdair::Count_T _nbOfRequests;
+  stdair::Count_T _nbOfUnorderedRequests;
+  TRADEMGEN::EpochTime_T _lastRequestDateTime;
+};
+
+/**
+ * Test the generation of all the requests within TraDemGen, in the
+ * order of their date-times, and its interruption by the consumer
+ */
+BOOST_AUTO_TEST_CASE (trademgen_generate_all_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_5.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the TraDemGen service object, with the default BOM tree
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+  TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                 stdair::DEFAULT_RANDOM_SEED);
+  trademgenService.buildSampleBom();
+
+  // Same total number of requests as with the event queue (see the
+  // trademgen_default_bom_simulation_test test case)
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+  OrderCheckingConsumer lConsumer (std::numeric_limits<stdair::Count_T>::max());
+  const stdair::Count_T lNbOfRequests =
+    trademgenService.generateAll (lConsumer, lDemandGenerationMethod);
+  BOOST_CHECK_EQUAL (lNbOfRequests, 187);
+  BOOST_CHECK_EQUAL (lConsumer._nbOfRequests, lNbOfRequests);
+  BOOST_CHECK_EQUAL (lConsumer._nbOfUnorderedRequests, 0);
+
+  // The consumer may stop the generation
+  trademgenService.reset();
+  OrderCheckingConsumer lStoppingConsumer (10);
+  BOOST_CHECK_EQUAL (trademgenService.generateAll (lStoppingConsumer,
+                                                   lDemandGenerationMethod),
+                     10);
+  BOOST_CHECK_EQUAL (lStoppingConsumer._nbOfUnorderedRequests, 0);
+}
+
+/**
+ * Test that the calendar queue extracts the requests in the order of
+ * their date-times, then of their demand streams, then of insertion
+ */
+BOOST_AUTO_TEST_CASE (trademgen_calendar_queue_test) {
+
+  TRADEMGEN::CalendarQueue lQueue;
+  BOOST_CHECK (lQueue.empty());
+
+  // Same date-time: the lowest handle first, then the first inserted
+  TRADEMGEN::BookingRequestRecord lRecord;
+  lRecord._requestDateTime = 1296547193751LL;
+  lRecord._stayDuration = 0;
+  lRecord._demandStreamHandle = 3;
+  lQueue.push (lRecord);
+  lRecord._stayDuration = 1;
+  lRecord._demandStreamHandle = 1;
+  lQueue.push (lRecord);
+  lRecord._stayDuration = 2;
+  lQueue.push (lRecord);
+  BOOST_CHECK_EQUAL (lQueue.size(), 3U);
+  BOOST_CHECK_EQUAL (lQueue.pop()._stayDuration, 1);
+  BOOST_CHECK_EQUAL (lQueue.pop()._stayDuration, 2);
+  BOOST_CHECK_EQUAL (lQueue.pop()._stayDuration, 0);
+  BOOST_CHECK (lQueue.empty());
+
+  // Many requests, some of them before 1970 and some of them colliding,
+  // added at once, then replaced by later ones as they are extracted
+  // (a linear congruential generator is enough to spread them)
+  boost::uint64_t lSeed = 42;
+  TRADEMGEN::CalendarQueue::BookingRequestRecordList_T lRecordList;
+  for (int idx = 0; idx != 5000; ++idx) {
+    lSeed = lSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+    lRecord._requestDateTime =
+      static_cast<TRADEMGEN::EpochTime_T> ((lSeed >> 24) % 1000000000ULL)
+      - 500000000LL;
+    lRecord._demandStreamHandle = (lSeed >> 8) % 7;
+    lRecord._stayDuration = idx;
+    lRecordList.push_back (lRecord);
+  }
+  lQueue.push (lRecordList);
+  BOOST_CHECK_EQUAL (lQueue.size(), lRecordList.size());
+
+  unsigned int lNbOfUnorderedRequests = 0;
+  unsigned int lNbOfRequests = 0;
+  unsigned int lNbOfPushedRequests = lRecordList.size();
+  TRADEMGEN::BookingRequestRecord lPreviousRecord = lQueue.pop();
+  ++lNbOfRequests;
+  while (lQueue.empty() == false || lNbOfPushedRequests < 20000) {
+    if (lNbOfPushedRequests < 20000) {
+      lSeed = lSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+      lRecord._requestDateTime = lPreviousRecord._requestDateTime
+        + static_cast<TRADEMGEN::EpochTime_T> ((lSeed >> 24) % 4 + 1) * 1000000;
+      lRecord._demandStreamHandle = (lSeed >> 8) % 7;
+      lRecord._stayDuration = lNbOfPushedRequests++;
+      lQueue.push (lRecord);
+    }
+
+    const TRADEMGEN::BookingRequestRecord lCurrentRecord = lQueue.pop();
+    ++lNbOfRequests;
+    if (lCurrentRecord._requestDateTime < lPreviousRecord._requestDateTime
+        || (lCurrentRecord._requestDateTime == lPreviousRecord._requestDateTime
+            && (lCurrentRecord._demandStreamHandle
+                < lPreviousRecord._demandStreamHandle
+                || (lCurrentRecord._demandStreamHandle
+                    == lPreviousRecord._demandStreamHandle
+                    && lCurrentRecord._stayDuration
+                    < lPreviousRecord._stayDuration)))) {
+      ++lNbOfUnorderedRequests;
+    }
+    lPreviousRecord = lCurrentRecord;
+  }
+  BOOST_CHECK_EQUAL (lNbOfRequests, lNbOfPushedRequests);
+  BOOST_CHECK_EQUAL (lNbOfUnorderedRequests, 0U);
+  BOOST_CHECK_EQUAL (lQueue.getNbOfBuckets(),
+                     TRADEMGEN::CalendarQueue::MIN_NB_OF_BUCKETS);
+}
+
+/**
+ * Test the (pull-style) ranges of booking requests, over all the demand
+ * streams and over a single one
+ */
+BOOST_AUTO_TEST_CASE (trademgen_booking_request_range_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_6.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the TraDemGen service object, with the default BOM tree
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+  TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                 stdair::DEFAULT_RANDOM_SEED);
+  trademgenService.buildSampleBom();
+
+  // Same requests as with generateAll() (see the
+  // trademgen_generate_all_test test case)
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+  OrderCheckingConsumer lConsumer (std::numeric_limits<stdair::Count_T>::max());
+  TRADEMGEN::BookingRequestRange lBookingRequestRange =
+    trademgenService.getBookingRequestRange (lDemandGenerationMethod);
+  for (TRADEMGEN::BookingRequestRange::iterator itRequest =
+         lBookingRequestRange.begin();
+       itRequest != lBookingRequestRange.end(); ++itRequest) {
+    lConsumer.consume (lBookingRequestRange.getDemandStream(), *itRequest);
+  }
+  BOOST_CHECK_EQUAL (lConsumer._nbOfRequests, 187);
+  BOOST_CHECK_EQUAL (lConsumer._nbOfUnorderedRequests, 0);
+  BOOST_CHECK (lBookingRequestRange.empty());
+
+  // The caller may leave the loop at any time
+  trademgenService.reset();
+  TRADEMGEN::BookingRequestRange lInterruptedRange =
+    trademgenService.getBookingRequestRange (lDemandGenerationMethod);
+  stdair::Count_T lNbOfRequests = 0;
+  for (TRADEMGEN::BookingRequestRange::iterator itRequest =
+         lInterruptedRange.begin();
+       itRequest != lInterruptedRange.end() && lNbOfRequests != 10;
+       ++itRequest) {
+    ++lNbOfRequests;
+  }
+  BOOST_CHECK_EQUAL (lNbOfRequests, 10);
+  BOOST_CHECK (lInterruptedRange.empty() == false);
+
+  // Over a single demand stream, only its own requests
+  trademgenService.reset();
+  const TRADEMGEN::DemandStreamHandle_T lHandle = 0;
+  OrderCheckingConsumer lStreamConsumer (std::numeric_limits<stdair::Count_T>::max());
+  TRADEMGEN::BookingRequestRange lStreamRange =
+    trademgenService.getBookingRequestRange (lHandle, lDemandGenerationMethod);
+  unsigned int lNbOfForeignRequests = 0;
+  for (TRADEMGEN::BookingRequestRange::iterator itRequest =
+         lStreamRange.begin();
+       itRequest != lStreamRange.end(); ++itRequest) {
+    if (itRequest->_demandStreamHandle != lHandle) {
+      ++lNbOfForeignRequests;
+    }
+    lStreamConsumer.consume (lStreamRange.getDemandStream(), *itRequest);
+  }
+  BOOST_CHECK_GT (lStreamConsumer._nbOfRequests, 0);
+  BOOST_CHECK_LT (lStreamConsumer._nbOfRequests, 187);
+  BOOST_CHECK_EQUAL (lStreamConsumer._nbOfUnorderedRequests, 0);
+  BOOST_CHECK_EQUAL (lNbOfForeignRequests, 0U);
+}
+
+/**
+ * Test the bounded ring between a producer and a consumer thread
+ * (from a single thread here)
+ */
+BOOST_AUTO_TEST_CASE (trademgen_spsc_ring_buffer_test) {
+
+  // The capacity is rounded up to a power of two
+  TRADEMGEN::SPSCRingBuffer<int> lRingBuffer (3);
+  BOOST_CHECK_EQUAL (lRingBuffer.capacity(), 4U);
+
+  // First in, first out, until the ring is full
+  int lElement = 0;
+  BOOST_CHECK (lRingBuffer.tryPop (lElement) == false);
+  for (int idx = 0; idx != 4; ++idx) {
+    BOOST_CHECK (lRingBuffer.tryPush (idx));
+  }
+  BOOST_CHECK (lRingBuffer.tryPush (4) == false);
+  BOOST_CHECK (lRingBuffer.tryPop (lElement));
+  BOOST_CHECK_EQUAL (lElement, 0);
+
+  // The indexes wrap around the ring
+  BOOST_CHECK (lRingBuffer.tryPush (4));
+  for (int idx = 1; idx != 5; ++idx) {
+    BOOST_CHECK (lRingBuffer.tryPop (lElement));
+    BOOST_CHECK_EQUAL (lElement, idx);
+  }
+  BOOST_CHECK (lRingBuffer.tryPop (lElement) == false);
+}
+
+/**
+ * Consumer building the booking requests from their records (on the
+ * thread of the consumer, while the requests are still being generated
+ * by another thread), and recording their descriptions
+ */
+class DescribingConsumer : public TRADEMGEN::BookingRequestConsumer {
+public:
+  bool consume (const TRADEMGEN::DemandStream& iDemandStream,
+                const TRADEMGEN::BookingRequestRecord& iBookingRequestRecord) {
+    const stdair::BookingRequestPtr_T lBookingRequest_ptr =
+      iDemandStream.createBookingRequest (iBookingRequestRecord);
+    _descriptionList.push_back (lBookingRequest_ptr->describe());
+    return true;
+  }
+
+  std::vector<std::string> _descriptionList;
+};
+
+/**
+ * Test the generation of all the requests by a dedicated thread, which
+ * must yield the same requests as generateAll()
+ */
+BOOST_AUTO_TEST_CASE (trademgen_generate_all_concurrently_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_7.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the TraDemGen service object, with the default BOM tree
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+  TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                 stdair::DEFAULT_RANDOM_SEED);
+  trademgenService.buildSampleBom();
+
+  // Same requests as with generateAll() (see the
+  // trademgen_generate_all_test test case)
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+  OrderCheckingConsumer lConsumer (std::numeric_limits<stdair::Count_T>::max());
+  const stdair::Count_T lNbOfRequests =
+    trademgenService.generateAllConcurrently (lConsumer,
+                                              lDemandGenerationMethod);
+  BOOST_CHECK_EQUAL (lNbOfRequests, 187);
+  BOOST_CHECK_EQUAL (lConsumer._nbOfRequests, lNbOfRequests);
+  BOOST_CHECK_EQUAL (lConsumer._nbOfUnorderedRequests, 0);
+
+  // The consumer may stop the generation (and the generator thread)
+  trademgenService.reset();
+  OrderCheckingConsumer lStoppingConsumer (10);
+  BOOST_CHECK_EQUAL (trademgenService.
+                     generateAllConcurrently (lStoppingConsumer,
+                                              lDemandGenerationMethod),
+                     10);
+  BOOST_CHECK_EQUAL (lStoppingConsumer._nbOfUnorderedRequests, 0);
+}
+
+/**
+ * Test the building of the booking requests by the consumer thread,
+ * while the generator thread is still drawing the next ones
+ */
+BOOST_AUTO_TEST_CASE (trademgen_concurrent_booking_request_building_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_11.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+
+  // Reference, generated by a single thread
+  DescribingConsumer lReferenceConsumer;
+  {
+    TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                   stdair::DEFAULT_RANDOM_SEED);
+    trademgenService.buildSampleBom();
+    trademgenService.generateAll (lReferenceConsumer, lDemandGenerationMethod);
+  }
+  BOOST_CHECK_EQUAL (lReferenceConsumer._descriptionList.size(), 166U);
+
+  // Same seed, the booking requests being built by the consumer thread
+  TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                 stdair::DEFAULT_RANDOM_SEED);
+  trademgenService.buildSampleBom();
+  DescribingConsumer lConsumer;
+  BOOST_CHECK_EQUAL (trademgenService.
+                     generateAllConcurrently (lConsumer,
+                                              lDemandGenerationMethod),
+                     187);
+  BOOST_CHECK (lConsumer._descriptionList
+               == lReferenceConsumer._descriptionList);
+}
+
+/**
+ * Consumer recording the booking requests, so that the outputs of
+ * several generations can be compared.
+ */
+class RecordingConsumer : public TRADEMGEN::BookingRequestConsumer {
+public:
+  bool consume (const TRADEMGEN::DemandStream&,
+                const TRADEMGEN::BookingRequestRecord& iBookingRequestRecord) {
+    _recordList.push_back (iBookingRequestRecord);
+    return true;
+  }
+
+  /** Count the requests differing from the ones of the given consumer. */
+  unsigned int countDifferences (const RecordingConsumer& iConsumer) const {
+    unsigned int oNbOfDifferences = 0;
+    for (std::size_t idx = 0;
+         idx < _recordList.size() && idx < iConsumer._recordList.size(); ++idx) {
+      const TRADEMGEN::BookingRequestRecord& lRecord = _recordList[idx];
+      const TRADEMGEN::BookingRequestRecord& lOtherRecord =
+        iConsumer._recordList[idx];
+      if (lRecord._requestDateTime != lOtherRecord._requestDateTime
+          || lRecord._demandStreamHandle != lOtherRecord._demandStreamHandle
+          || lRecord._wtp != lOtherRecord._wtp
+          || lRecord._valueOfTime != lOtherRecord._valueOfTime
+          || lRecord._pos != lOtherRecord._pos
+          || lRecord._channel != lOtherRecord._channel
+          || lRecord._tripType != lOtherRecord._tripType
+          || lRecord._frequentFlyerType != lOtherRecord._frequentFlyerType
+          || lRecord._stayDuration != lOtherRecord._stayDuration
+          || lRecord._preferredDepartureTime
+          != lOtherRecord._preferredDepartureTime
+          || lRecord._changeFees != lOtherRecord._changeFees
+          || lRecord._nonRefundable != lOtherRecord._nonRefundable) {
+        ++oNbOfDifferences;
+      }
+    }
+    return oNbOfDifferences;
+  }
+
+  std::vector<TRADEMGEN::BookingRequestRecord> _recordList;
+};
+
+/**
+ * Test the generation of all the requests by several threads, which
+ * must yield exactly the same requests as generateAll(), whatever the
+ * number of threads
+ */
+BOOST_AUTO_TEST_CASE (trademgen_generate_all_in_parallel_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_8.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+
+  // Reference, generated by a single thread
+  RecordingConsumer lReferenceConsumer;
+  {
+    TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                   stdair::DEFAULT_RANDOM_SEED);
+    trademgenService.buildSampleBom();
+    trademgenService.generateAll (lReferenceConsumer, lDemandGenerationMethod);
+  }
+  BOOST_CHECK_EQUAL (lReferenceConsumer._recordList.size(), 166U);
+
+  // Same seed, with several numbers of threads
+  const unsigned int lNbOfThreadsList[] = { 1, 2, 3, 8, 0 };
+  for (std::size_t idx = 0; idx != 5; ++idx) {
+    TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                   stdair::DEFAULT_RANDOM_SEED);
+    trademgenService.buildSampleBom();
+
+    RecordingConsumer lConsumer;
+    const stdair::Count_T lNbOfRequests =
+      trademgenService.generateAllInParallel (lConsumer,
+                                              lDemandGenerationMethod,
+                                              lNbOfThreadsList[idx]);
+    BOOST_CHECK_EQUAL (lNbOfRequests, 187);
+    BOOST_CHECK_EQUAL (lConsumer._recordList.size(),
+                       lReferenceConsumer._recordList.size());
+    BOOST_CHECK_EQUAL (lConsumer.countDifferences (lReferenceConsumer), 0U);
+  }
+
+  // A trace sink may not be called from several generator threads
+  TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                 stdair::DEFAULT_RANDOM_SEED);
+  trademgenService.buildSampleBom();
+  std::ostringstream lTraceStream;
+  trademgenService.
+    setTraceSink (boost::make_shared<TRADEMGEN::BinaryTraceSink> (boost::ref (lTraceStream)));
+  RecordingConsumer lConsumer;
+  BOOST_CHECK_THROW (trademgenService.generateAllInParallel (lConsumer,
+                                                             lDemandGenerationMethod,
+                                                             2),
+                     TRADEMGEN::UnsafeTraceSinkException);
+  BOOST_CHECK (lConsumer._recordList.empty() == true);
+
+  // With a single generator thread, the requests are traced as usual
+  const stdair::Count_T lNbOfRequests =
+    trademgenService.generateAllInParallel (lConsumer, lDemandGenerationMethod,
+                                            1);
+  BOOST_CHECK_EQUAL (lNbOfRequests, 187);
+  BOOST_CHECK_EQUAL (lConsumer.countDifferences (lReferenceConsumer), 0U);
+  trademgenService.setTraceSink (TRADEMGEN::TraceSinkPtr_T());
+  BOOST_CHECK (lTraceStream.str().empty() == false);
+}
+
+/**
+ * Record all the requests of the range, advancing it with the path
+ * specialised for the given generation method
+ */
+template <typename GENERATION_METHOD>
+void recordBookingRequestRange (TRADEMGEN::BookingRequestRange& ioRange,
+                                RecordingConsumer& ioConsumer) {
+  for ( ; ioRange.empty() == false;
+       ioRange.nextWith<GENERATION_METHOD>()) {
+    ioConsumer.consume (ioRange.getDemandStream(), ioRange.front());
+  }
+}
+
+/**
+ * Test that the generation paths specialised for each generation
+ * method give the same requests as the paths checking the method at
+ * each request
+ */
+BOOST_AUTO_TEST_CASE (trademgen_specialised_generation_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_12.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+
+  // Statistic orders, then Poisson process (with the same numbers of
+  // requests as before the specialisation)
+  const stdair::DemandGenerationMethod lDemandGenerationMethodList[] = {
+    stdair::DemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD),
+    stdair::DemandGenerationMethod (stdair::DemandGenerationMethod::POI_PRO) };
+  const unsigned int lNbOfRequestsList[] = { 187, 155 };
+  for (std::size_t idx = 0; idx != 2; ++idx) {
+    const stdair::DemandGenerationMethod& lDemandGenerationMethod =
+      lDemandGenerationMethodList[idx];
+
+    // Reference, with generateAll() (the method being dispatched once)
+    RecordingConsumer lReferenceConsumer;
+    {
+      TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                     stdair::DEFAULT_RANDOM_SEED);
+      trademgenService.buildSampleBom();
+      trademgenService.generateAll (lReferenceConsumer, lDemandGenerationMethod);
+    }
+    BOOST_CHECK_EQUAL (lReferenceConsumer._recordList.size(),
+                       lNbOfRequestsList[idx]);
+
+    // Same seed, with the specialised path called explicitly
+    RecordingConsumer lRangeConsumer;
+    {
+      TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                     stdair::DEFAULT_RANDOM_SEED);
+      trademgenService.buildSampleBom();
+      TRADEMGEN::BookingRequestRange lBookingRequestRange =
+        trademgenService.getBookingRequestRange (lDemandGenerationMethod);
+      if (idx == 0) {
+        recordBookingRequestRange<TRADEMGEN::DemandStream::StatisticsOrderMethod>
+          (lBookingRequestRange, lRangeConsumer);
+      } else {
+        recordBookingRequestRange<TRADEMGEN::DemandStream::PoissonProcessMethod>
+          (lBookingRequestRange, lRangeConsumer);
+      }
+    }
+    BOOST_CHECK_EQUAL (lRangeConsumer._recordList.size(),
+                       lReferenceConsumer._recordList.size());
+    BOOST_CHECK_EQUAL (lRangeConsumer.countDifferences (lReferenceConsumer),
+                       0U);
+
+    // Same seed, demand stream by demand stream, the method being
+    // checked at each request: the requests of each demand stream
+    // start with the ones given by generateAll()
+    TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                   stdair::DEFAULT_RANDOM_SEED);
+    trademgenService.buildSampleBom();
+    for (TRADEMGEN::DemandStreamHandle_T lHandle = 0;
+         lHandle != trademgenService.getNbOfDemandStreams(); ++lHandle) {
+      RecordingConsumer lStreamReferenceConsumer;
+      for (std::size_t lRecordIdx = 0;
+           lRecordIdx != lReferenceConsumer._recordList.size(); ++lRecordIdx) {
+        const TRADEMGEN::BookingRequestRecord& lRecord =
+          lReferenceConsumer._recordList[lRecordIdx];
+        if (lRecord._demandStreamHandle == lHandle) {
+          lStreamReferenceConsumer._recordList.push_back (lRecord);
+        }
+      }
+
+      RecordingConsumer lStreamConsumer;
+      stdair::ProgressStatusSet lPSS (stdair::EventType::BKG_REQ);
+      while (trademgenService.
+             stillHavingRequestsToBeGenerated (lHandle, lPSS,
+                                               lDemandGenerationMethod)) {
+        TRADEMGEN::BookingRequestRecord lRecord;
+        trademgenService.generateNextRequest (lHandle, lRecord,
+                                              lDemandGenerationMethod);
+        lStreamConsumer._recordList.push_back (lRecord);
+      }
+      BOOST_CHECK_GE (lStreamConsumer._recordList.size(),
+                      lStreamReferenceConsumer._recordList.size());
+      BOOST_CHECK_EQUAL (lStreamConsumer.
+                         countDifferences (lStreamReferenceConsumer), 0U);
+    }
+  }
+}
+
+/**
+ * Test that the demand streams derived from a demand row (one per
+ * date) are held by their family, that they share its configuration,
+ * and that they generate the same requests as when generated on their
+ * own
+ */
+BOOST_AUTO_TEST_CASE (trademgen_demand_stream_family_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_13.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+
+  // Two demand rows, for two dates each
+  const TRADEMGEN::DemandFilePath lDemandFilePath (STDAIR_SAMPLE_DIR
+                                                   "/demand01.csv");
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+
+  // Reference: the requests of every demand stream
+  std::vector<RecordingConsumer> lReferenceConsumerList;
+  {
+    TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                   stdair::DEFAULT_RANDOM_SEED);
+    trademgenService.parseAndLoad (lDemandFilePath);
+    lReferenceConsumerList.resize (trademgenService.getNbOfDemandStreams());
+    for (TRADEMGEN::DemandStreamHandle_T lHandle = 0;
+         lHandle != trademgenService.getNbOfDemandStreams(); ++lHandle) {
+      TRADEMGEN::BookingRequestRange lBookingRequestRange =
+        trademgenService.getBookingRequestRange (lHandle,
+                                                 lDemandGenerationMethod);
+      recordBookingRequestRange<TRADEMGEN::DemandStream::StatisticsOrderMethod>
+        (lBookingRequestRange, lReferenceConsumerList[lHandle]);
+    }
+  }
+  BOOST_REQUIRE_EQUAL (lReferenceConsumerList.size(), 4U);
+
+  // Same seed: the demand streams of the first row share the
+  // configuration of their family
+  TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                 stdair::DEFAULT_RANDOM_SEED);
+  trademgenService.parseAndLoad (lDemandFilePath);
+  TRADEMGEN::BookingRequestRange lBookingRequestRange =
+    trademgenService.getBookingRequestRange (0, lDemandGenerationMethod);
+  TRADEMGEN::DemandStream& lDemandStream =
+    lBookingRequestRange.getDemandStream();
+  TRADEMGEN::DemandStreamFamily& lDemandStreamFamily = lDemandStream.getFamily();
+  const TRADEMGEN::DemandStreamFamily::DemandStreamList_T& lDemandStreamList =
+    lDemandStreamFamily.getDemandStreamList();
+  BOOST_REQUIRE_EQUAL (lDemandStreamList.size(), 2U);
+  BOOST_REQUIRE (&lDemandStreamList.front() == &lDemandStream);
+  const TRADEMGEN::DemandStream& lOtherDemandStream = lDemandStreamList.back();
+  BOOST_CHECK (lOtherDemandStream.getPreferredDepartureDate()
+               > lDemandStream.getPreferredDepartureDate());
+  BOOST_CHECK (&lOtherDemandStream.getFamily() == &lDemandStreamFamily);
+  BOOST_CHECK (lOtherDemandStream.getStreamId() != lDemandStream.getStreamId());
+  BOOST_CHECK (&lOtherDemandStream.getDemandDistribution()
+               == &lDemandStream.getDemandDistribution());
+
+  // Altering the demand distribution of the family alters the one of
+  // all its demand streams
+  const TRADEMGEN::DemandDistribution
+    lDemandDistribution (lDemandStreamFamily.getDemandDistribution());
+  lDemandStreamFamily.
+    setDemandDistribution (TRADEMGEN::DemandDistribution (2.0 * lDemandDistribution._meanNumberOfRequests,
+                                                          lDemandDistribution._stdDevNumberOfRequests));
+  BOOST_CHECK_EQUAL (lDemandStream.getMeanNumberOfRequests(),
+                     2.0 * lDemandDistribution._meanNumberOfRequests);
+  BOOST_CHECK_EQUAL (lOtherDemandStream.getMeanNumberOfRequests(),
+                     2.0 * lDemandDistribution._meanNumberOfRequests);
+  lDemandStreamFamily.setDemandDistribution (lDemandDistribution);
+
+  // Both demand streams generate the same requests as the reference
+  RecordingConsumer lConsumer;
+  recordBookingRequestRange<TRADEMGEN::DemandStream::StatisticsOrderMethod>
+    (lBookingRequestRange, lConsumer);
+  BOOST_CHECK_EQUAL (lConsumer._recordList.size(),
+                     lReferenceConsumerList[0]._recordList.size());
+  BOOST_CHECK_EQUAL (lConsumer.countDifferences (lReferenceConsumerList[0]), 0U);
+
+  const TRADEMGEN::DemandStreamHandle_T& lOtherHandle =
+    lOtherDemandStream.getHandle();
+  TRADEMGEN::BookingRequestRange lOtherBookingRequestRange =
+    trademgenService.getBookingRequestRange (lOtherHandle,
+                                             lDemandGenerationMethod);
+  RecordingConsumer lOtherConsumer;
+  recordBookingRequestRange<TRADEMGEN::DemandStream::StatisticsOrderMethod>
+    (lOtherBookingRequestRange, lOtherConsumer);
+  BOOST_CHECK_EQUAL (lOtherConsumer._recordList.size(),
+                     lReferenceConsumerList[lOtherHandle]._recordList.size());
+  BOOST_CHECK_EQUAL (lOtherConsumer.
+                     countDifferences (lReferenceConsumerList[lOtherHandle]),
+                     0U);
+}
+
+/**
+ * Test that the demand stream engine, advancing all the demand streams
+ * at once, gives the same requests as the statistics order generated
+ * one demand stream at a time
+ */
+BOOST_AUTO_TEST_CASE (trademgen_demand_stream_engine_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("DemandGenerationTestSuite_14.log");
+  std::ofstream logOutputFile;
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+
+  const stdair::DemandGenerationMethod lDemandGenerationMethod (stdair::DemandGenerationMethod::STA_ORD);
+  const std::size_t lNbOfSteps = 20;
+
+  // Reference: the date-times of the requests following the first one,
+  // generated one at a time for each demand stream
+  typedef std::vector<TRADEMGEN::EpochTime_T> EpochTimeList_T;
+  std::vector<EpochTimeList_T> lReferenceEpochTimeList;
+  {
+    TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                   stdair::DEFAULT_RANDOM_SEED);
+    trademgenService.buildSampleBom();
+    lReferenceEpochTimeList.resize (trademgenService.getNbOfDemandStreams());
+    for (TRADEMGEN::DemandStreamHandle_T lHandle = 0;
+         lHandle != trademgenService.getNbOfDemandStreams(); ++lHandle) {
+      TRADEMGEN::BookingRequestRange lBookingRequestRange =
+        trademgenService.getBookingRequestRange (lHandle,
+                                                 lDemandGenerationMethod);
+      TRADEMGEN::DemandStream& lDemandStream =
+        lBookingRequestRange.getDemandStream();
+      for (std::size_t lStep = 0; lStep != lNbOfSteps + 1; ++lStep) {
+        BOOST_REQUIRE (lDemandStream.stillHavingRequestsToBeGeneratedWith<TRADEMGEN::DemandStream::StatisticsOrderMethod>());
+        lReferenceEpochTimeList[lHandle].
+          push_back (lDemandStream.generateTimeOfRequestStatisticsOrder());
+      }
+    }
+  }
+  BOOST_REQUIRE_EQUAL (lReferenceEpochTimeList.size(), 3U);
+
+  // Same seed: after the first requests, the demand streams are
+  // advanced all at once by the engine
+  TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams,
+                                                 stdair::DEFAULT_RANDOM_SEED);
+  trademgenService.buildSampleBom();
+  std::vector<TRADEMGEN::BookingRequestRange> lBookingRequestRangeList;
+  TRADEMGEN::DemandStreamRegistry lDemandStreamRegistry;
+  for (TRADEMGEN::DemandStreamHandle_T lHandle = 0;
+       lHandle != trademgenService.getNbOfDemandStreams(); ++lHandle) {
+    lBookingRequestRangeList.
+      push_back (trademgenService.getBookingRequestRange (lHandle,
+                                                          lDemandGenerationMethod));
+    lDemandStreamRegistry.
+      registerDemandStream (lBookingRequestRangeList.back().getDemandStream());
+  }
+
+  TRADEMGEN::DemandStreamEngine lDemandStreamEngine;
+  lDemandStreamEngine.load (lDemandStreamRegistry);
+  BOOST_REQUIRE_EQUAL (lDemandStreamEngine.getNbOfDemandStreams(), 3U);
+  for (std::size_t lStep = 0; lStep != lNbOfSteps; ++lStep) {
+    BOOST_CHECK_EQUAL (lDemandStreamEngine.advance(), 3U);
+    for (TRADEMGEN::DemandStreamHandle_T lHandle = 0;
+         lHandle != lDemandStreamEngine.getNbOfDemandStreams(); ++lHandle) {
+      BOOST_CHECK_EQUAL (lDemandStreamEngine.
+                         getEpochTimeOfRequest (lDemandStreamRegistry, lHandle),
+                         lReferenceEpochTimeList[lHandle][lStep]);
+    }
+  }
+
+  // Once given their state back, the demand streams go on with the
+  // same requests as the reference
+  lDemandStreamEngine.store (lDemandStreamRegistry);
+  for (TRADEMGEN::DemandStreamHandle_T lHandle = 0;
+       lHandle != lDemandStreamRegistry.getNbOfDemandStreams(); ++lHandle) {
+    TRADEMGEN::DemandStream& lDemandStream =
+      lBookingRequestRangeList[lHandle].getDemandStream();
+    BOOST_CHECK_EQUAL (lDemandStream.getNumberOfRequestsGeneratedSoFar(),
+                       lNbOfSteps + 1);
+    BOOST_CHECK_EQUAL (lDemandStream.generateTimeOfRequestStatisticsOrder(),
+                       lReferenceEpochTimeList[lHandle][lNbOfSteps]);
+  }
+}
+
 // End the test suite
 BOOST_AUTO_TEST_SUITE_END()
 
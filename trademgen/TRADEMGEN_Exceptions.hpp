@@ -49,6 +49,43 @@ namespace TRADEMGEN {
       : TrademgenGenerationException (iWhat) {}
   };
 
+  /**
+   * Exception when no demand stream corresponds to the given key
+   */
+  class DemandStreamNotFoundException : public TrademgenGenerationException {
+  public:
+    /**
+     * Constructor.
+     */
+    DemandStreamNotFoundException (const std::string& iWhat)
+      : TrademgenGenerationException (iWhat) {}
+  };
+
+  /**
+   * Exception when a string has not been interned in the code pool
+   */
+  class CodeNotFoundException : public TrademgenGenerationException {
+  public:
+    /**
+     * Constructor.
+     */
+    CodeNotFoundException (const std::string& iWhat)
+      : TrademgenGenerationException (iWhat) {}
+  };
+
+  /**
+   * Exception when a trace sink would be called from several threads
+   * at once
+   */
+  class UnsafeTraceSinkException : public TrademgenGenerationException {
+  public:
+    /**
+     * Constructor.
+     */
+    UnsafeTraceSinkException (const std::string& iWhat)
+      : TrademgenGenerationException (iWhat) {}
+  };
+
 }
 #endif // __TRADEMGEN_TRADEMGEN_EXCEPTIONS_HPP
 
@@ -37,6 +37,9 @@ namespace TRADEMGEN {
   /// Forward declarations
   class TRADEMGEN_ServiceContext; 
   struct DemandStreamKey;
+  struct BookingRequestRecord;
+  class BookingRequestConsumer;
+  class BookingRequestRange;
   
   /**
    * @brief class holding the services related to Travel Demand Generation.
@@ -272,7 +275,9 @@ namespace TRADEMGEN {
      * that number.
      *
      * \note That number has been drawn when calling the
-     *       generateFirstRequests() method.
+     *       generateFirstRequests() method, or one of the methods
+     *       generating all the requests at once (generateAll() and the
+     *       like).
      *
      * @return const stdair::Count_T& Expected number of events to be
      *   generated.
@@ -298,6 +303,27 @@ namespace TRADEMGEN {
                                       stdair::ProgressStatusSet&,
                                       const stdair::DemandGenerationMethod&) const;
 
+    /**
+     * Check whether enough requests have already been generated for
+     * the demand stream which corresponds to the given handle.
+     *
+     * That overload avoids looking up the demand stream by its key:
+     * the handle is a mere index within the registry of the demand
+     * streams.
+     *
+     * @param const DemandStreamHandle_T& Handle of the demand stream,
+     *   as given by the getDemandStreamHandle() method.
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     * @return bool Whether or not there are still events to be
+     *   generated for that demand stream.
+     */
+    const bool
+    stillHavingRequestsToBeGenerated (const DemandStreamHandle_T&,
+                                      stdair::ProgressStatusSet&,
+                                      const stdair::DemandGenerationMethod&) const;
+
     /**
      * Browse the list of demand streams and generate the first
      * request of each stream.
@@ -313,6 +339,123 @@ namespace TRADEMGEN {
     stdair::Count_T
     generateFirstRequests (const stdair::DemandGenerationMethod&) const;
 
+    /**
+     * Generate all the requests of all the demand streams, and hand
+     * them over, in the order of their date-times, to the given
+     * consumer.
+     *
+     * That method replaces the whole loop made of generateFirstRequests(),
+     * popEvent(), stillHavingRequestsToBeGenerated() and
+     * generateNextRequest(): it is performed within TraDemGen, without
+     * going through the event queue. Another run requires reset() to
+     * be called first.
+     *
+     * @param BookingRequestConsumer& Consumer of the requests, which
+     *        may stop the generation at any time.
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     * @return stdair::Count_T The number of requests handed over to
+     *         the consumer.
+     */
+    stdair::Count_T generateAll (BookingRequestConsumer&,
+                                 const stdair::DemandGenerationMethod&) const;
+
+    /**
+     * Same as generateAll(), the requests being generated by a
+     * dedicated thread while the consumer is called from the calling
+     * thread, so that the generation and the consumption overlap.
+     *
+     * The generator thread fills a bounded ring with the requests, and
+     * waits for the consumer when the ring is full. When the consumer
+     * stops the generation, the generator thread is stopped and waited
+     * for before returning.
+     *
+     * \note The consumer is given the demand streams while they are
+     *       used by the generator thread: it must stick to
+     *       DemandStream::createBookingRequest(). The trace sink is
+     *       called from the generator thread.
+     *
+     * @param BookingRequestConsumer& Consumer of the requests, which
+     *        may stop the generation at any time.
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     * @return stdair::Count_T The number of requests handed over to
+     *         the consumer.
+     */
+    stdair::Count_T
+    generateAllConcurrently (BookingRequestConsumer&,
+                             const stdair::DemandGenerationMethod&) const;
+
+    /**
+     * Same as generateAll(), the demand streams being shared among
+     * several generator threads, while the consumer is called from the
+     * calling thread. The requests of the generator threads are merged
+     * in the order of their date-times (the ties being broken by the
+     * handles of the demand streams).
+     *
+     * As every demand stream draws from its own random generators, the
+     * requests, and their order, are exactly the same as with
+     * generateAll() for the same seed, whatever the number of threads.
+     *
+     * \note As for generateAllConcurrently(), the consumer must stick
+     *       to DemandStream::createBookingRequest(). As the trace sink
+     *       would be called from all the generator threads at once, an
+     *       UnsafeTraceSinkException is thrown when a trace sink is set
+     *       (see setTraceSink()) and several generator threads are
+     *       requested.
+     *
+     * @param BookingRequestConsumer& Consumer of the requests, which
+     *        may stop the generation at any time.
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     * @param const unsigned int Number of generator threads (0 for as
+     *        many as the hardware supports).
+     * @return stdair::Count_T The number of requests handed over to
+     *         the consumer.
+     */
+    stdair::Count_T
+    generateAllInParallel (BookingRequestConsumer&,
+                           const stdair::DemandGenerationMethod&,
+                           const unsigned int iNbOfThreads = 0) const;
+
+    /**
+     * Get the range of all the requests of all the demand streams, in
+     * the order of their date-times, to be iterated over by the caller.
+     *
+     * That is the pull-style counterpart of generateAll(): the requests
+     * are generated lazily, as the range is iterated over, and the
+     * caller may leave the loop at any time. Another run requires
+     * reset() to be called first.
+     *
+     * \note The BookingRequestRange class is defined in
+     *       <trademgen/bom/BookingRequestRange.hpp>.
+     *
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     * @return BookingRequestRange Range of the requests.
+     */
+    BookingRequestRange
+    getBookingRequestRange (const stdair::DemandGenerationMethod&) const;
+
+    /**
+     * Get the range of all the requests of the demand stream
+     * corresponding to the given handle, in the order of their
+     * date-times.
+     *
+     * @param const DemandStreamHandle_T& Handle of the demand stream.
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     * @return BookingRequestRange Range of the requests.
+     */
+    BookingRequestRange
+    getBookingRequestRange (const DemandStreamHandle_T&,
+                            const stdair::DemandGenerationMethod&) const;
+
     /**
      * Generate a request with the demand stream which corresponds to
      * the given key.
@@ -331,6 +474,75 @@ namespace TRADEMGEN {
     generateNextRequest (const stdair::DemandStreamKeyStr_T&,
                          const stdair::DemandGenerationMethod&) const;
 
+    /**
+     * Generate a request with the demand stream which corresponds to
+     * the given handle.
+     *
+     * @param const DemandStreamHandle_T& Handle of the demand stream,
+     *   as given by the getDemandStreamHandle() method.
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     * @return stdair::BookingRequestPtr_T (Boost) shared pointer on
+     *   the booking request structure, which has just been created.
+     */
+    stdair::BookingRequestPtr_T
+    generateNextRequest (const DemandStreamHandle_T&,
+                         const stdair::DemandGenerationMethod&) const;
+
+    /**
+     * Generate a request, as a compact record, with the demand stream
+     * which corresponds to the given handle.
+     *
+     * Unlike the above method, no booking request structure is
+     * created, and no event is added to the event queue: that method
+     * is meant for the clients browsing the demand streams by
+     * themselves, and reading only a few attributes of the requests.
+     *
+     * @param const DemandStreamHandle_T& Handle of the demand stream.
+     * @param BookingRequestRecord& Record to be filled.
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     */
+    void generateNextRequest (const DemandStreamHandle_T&,
+                              BookingRequestRecord&,
+                              const stdair::DemandGenerationMethod&) const;
+
+    /**
+     * Create the booking request structure corresponding to a record
+     * (as generated by the above method).
+     *
+     * @param const BookingRequestRecord& Record of the booking request.
+     * @return stdair::BookingRequestPtr_T (Boost) shared pointer on
+     *   the booking request structure, which has just been created.
+     */
+    stdair::BookingRequestPtr_T
+    createBookingRequest (const BookingRequestRecord&) const;
+
+    /**
+     * Get the handle of the demand stream which corresponds to the
+     * given key (e.g., the demand generator key of a booking request).
+     *
+     * The handles are dense: they range from 0 to the number of
+     * demand streams (excluded), in the order in which the demand
+     * streams have been created.
+     *
+     * \note A DemandStreamNotFoundException is thrown when no demand
+     *       stream corresponds to that key.
+     *
+     * @param const DemandStreamKey& A string identifying uniquely the
+     *   demand stream (e.g., "SIN-HND 2010-Feb-08 Y").
+     */
+    const DemandStreamHandle_T&
+    getDemandStreamHandle (const stdair::DemandStreamKeyStr_T&) const;
+
+    /**
+     * Get the number of demand streams (i.e., the upper bound of the
+     * demand stream handles).
+     */
+    DemandStreamHandle_T getNbOfDemandStreams() const;
+
     /**
      * States whether a demand stream with the given key is used to
      * generate demand.
@@ -382,6 +594,38 @@ namespace TRADEMGEN {
      */
     void reset() const;  
 
+    /**
+     * Switch on or off the joint sampling of the categorical demand
+     * characteristics, for all the demand streams built so far.
+     *
+     * When switched on, the POS, channel, trip type, stay duration,
+     * frequent flyer tier, and change fee and non refundable
+     * acceptations of each request are drawn all at once, with a single
+     * random number, from an alias table built over their Cartesian
+     * product. The demand streams for which that table would be too
+     * large keep on drawing those characteristics one by one.
+     *
+     * @param const bool Whether the joint sampling must be switched on.
+     * @return stdair::Count_T The number of demand streams for which
+     *   the joint sampling is on.
+     */
+    stdair::Count_T setJointCharacteristicsSampling (const bool) const;
+
+    /**
+     * Set the trace sink receiving the records of the requests, as
+     * they are generated, for all the demand streams (including the
+     * ones built later on).
+     *
+     * By default, nothing is traced. For instance, a LogTraceSink
+     * notifies the log of every request (as expected by the demand
+     * generation tools), while a BinaryTraceSink stores the raw
+     * records into a stream from a background thread.
+     *
+     * @param TraceSinkPtr_T Trace sink, kept alive by the service (a
+     *   null pointer switches the tracing off).
+     */
+    void setTraceSink (TraceSinkPtr_T);
+
     /**
      * Get the overall progress status (for the whole event queue).
      */
@@ -15,6 +15,7 @@ namespace TRADEMGEN {
 
   // Forward declarations
   class TRADEMGEN_Service;
+  class TraceSink;
 
 
   // //////// Type definitions specific to DSim /////////
@@ -22,6 +23,17 @@ namespace TRADEMGEN {
    * (Smart) Pointer on the TraDemGen service handler.
    */
   typedef boost::shared_ptr<TRADEMGEN_Service> TRADEMGEN_ServicePtr_T;
+
+  /**
+   * (Smart) Pointer on a trace sink of the demand generation.
+   */
+  typedef boost::shared_ptr<TraceSink> TraceSinkPtr_T;
+
+  /**
+   * Handle on a demand stream, i.e., its (dense) index within the
+   * registry of the demand streams.
+   */
+  typedef unsigned int DemandStreamHandle_T;
   
   // ///////// Files ///////////
   /**
@@ -0,0 +1,83 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// TraDemGen
+#include <trademgen/basic/AliasTable.hpp>
+
+namespace TRADEMGEN {
+
+  // //////////////////////////////////////////////////////////////////////
+  AliasTable::AliasTable() : _size (0) {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void AliasTable::init (const MassArray_T& iMassArray) {
+    _size = iMassArray.size();
+    _probabilityArray.assign (_size, 1.0);
+    _aliasArray.resize (_size);
+    for (unsigned int idx = 0; idx < _size; ++idx) {
+      _aliasArray[idx] = idx;
+    }
+
+    double lTotalMass = 0.0;
+    for (unsigned int idx = 0; idx < _size; ++idx) {
+      if (iMassArray[idx] > 0.0) {
+        lTotalMass += iMassArray[idx];
+      }
+    }
+    if (lTotalMass <= 0.0) {
+      return;
+    }
+
+    // Scale the masses, so that the average one is 1, and split the
+    // entries between the small (below average) and large ones.
+    SmallVector<double> lScaledMassArray (_size, 0.0);
+    SmallVector<unsigned int> lSmallList;
+    SmallVector<unsigned int> lLargeList;
+    lSmallList.reserve (_size);
+    lLargeList.reserve (_size);
+    for (unsigned int idx = 0; idx < _size; ++idx) {
+      if (iMassArray[idx] > 0.0) {
+        lScaledMassArray[idx] = iMassArray[idx] * _size / lTotalMass;
+      }
+      if (lScaledMassArray[idx] < 1.0) {
+        lSmallList.push_back (idx);
+      } else {
+        lLargeList.push_back (idx);
+      }
+    }
+
+    // Fill each small entry with a piece of a large one.
+    while (lSmallList.empty() == false && lLargeList.empty() == false) {
+      const unsigned int lSmall = lSmallList.back();
+      lSmallList.pop_back();
+      const unsigned int lLarge = lLargeList.back();
+
+      _probabilityArray[lSmall] = lScaledMassArray[lSmall];
+      _aliasArray[lSmall] = lLarge;
+
+      lScaledMassArray[lLarge] -= 1.0 - lScaledMassArray[lSmall];
+      if (lScaledMassArray[lLarge] < 1.0) {
+        lLargeList.pop_back();
+        lSmallList.push_back (lLarge);
+      }
+    }
+
+    // The remaining entries are full (up to rounding errors). A null
+    // mass entry may only remain when all the masses are null, which
+    // has been excluded above.
+    for (SmallVector<unsigned int>::const_iterator itIdx = lSmallList.begin();
+         itIdx != lSmallList.end(); ++itIdx) {
+      _probabilityArray[*itIdx] = 1.0;
+      _aliasArray[*itIdx] = *itIdx;
+    }
+    for (SmallVector<unsigned int>::const_iterator itIdx = lLargeList.begin();
+         itIdx != lLargeList.end(); ++itIdx) {
+      _probabilityArray[*itIdx] = 1.0;
+      _aliasArray[*itIdx] = *itIdx;
+    }
+  }
+
+}
@@ -0,0 +1,89 @@
+#ifndef __TRADEMGEN_BAS_ALIASTABLE_HPP
+#define __TRADEMGEN_BAS_ALIASTABLE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+// StdAir
+#include <stdair/stdair_maths_types.hpp>
+// TraDemGen
+#include <trademgen/basic/SmallVector.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Alias table (Walker's alias method, built with Vose's
+   * algorithm) for drawing an index according to a discrete
+   * probability mass function, with a single uniform variate and in
+   * constant time.
+   */
+  class AliasTable {
+  public:
+    // ///////////// Type definitions //////////////
+    /**
+     * Type for the list of probability masses.
+     */
+    typedef SmallVector<double> MassArray_T;
+
+
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Get the index corresponding to the given uniform variate (within
+     * [0, 1]). The table must not be empty.
+     */
+    unsigned int getIndex (const stdair::Probability_T& iVariate) const {
+      const double lPosition = iVariate * _size;
+      unsigned int idx = _size - 1;
+      if (lPosition < static_cast<double> (_size)) {
+        idx = (lPosition > 0.0) ? static_cast<unsigned int> (lPosition) : 0;
+      }
+      const double lFraction = lPosition - idx;
+      return (lFraction < _probabilityArray[idx]) ? idx : _aliasArray[idx];
+    }
+
+    /**
+     * Get the number of entries.
+     */
+    unsigned int getSize() const {
+      return _size;
+    }
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Default constructor (empty table).
+     */
+    AliasTable();
+
+    /**
+     * Build the alias table. The masses are normalised, so that they
+     * do not need to sum up to 1. Null and negative masses are never
+     * drawn.
+     */
+    void init (const MassArray_T&);
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Number of entries.
+     */
+    unsigned int _size;
+
+    /**
+     * For each entry, the probability to keep the entry itself rather
+     * than its alias.
+     */
+    SmallVector<double> _probabilityArray;
+
+    /**
+     * For each entry, the alias entry.
+     */
+    SmallVector<unsigned int> _aliasArray;
+  };
+
+}
+#endif // __TRADEMGEN_BAS_ALIASTABLE_HPP
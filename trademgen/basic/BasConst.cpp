@@ -34,6 +34,10 @@ namespace TRADEMGEN {
   /** Default last lower bound of daily rate interval in arrival pattern. */ 
   const stdair::FloatDuration_T DEFAULT_LAST_LOWER_BOUND_ARRIVAL_PATTERN = -1;
 
+  /** Reference departure time (in milliseconds since midnight), from
+      which the date-times of the requests are derived. */
+  const EpochTime_T DEFAULT_REFERENCE_DEPARTURE_TIME = 8 * 3600 * 1000;
+
   /** Default FRAT5 pattern. */
   const FRAT5Pattern_T DEFAULT_FRAT5_PATTERN = DefaultMap::createFRAT5Pattern();
 
@@ -74,6 +78,14 @@ namespace TRADEMGEN {
   /** Default MAX Advance Purchase. */
   const double DEFAULT_MAX_ADVANCE_PURCHASE = 330.0;
 
+  /** Default minimal number of values of a categorical attribute, for
+      its draws to go through the alias table. */
+  const unsigned int DEFAULT_ALIAS_SAMPLING_MIN_SIZE = 8;
+
+  /** Default maximal number of tuples of the joint alias table of the
+      categorical characteristics of a demand stream. */
+  const unsigned int DEFAULT_JOINT_CHARACTERISTICS_TABLE_MAX_SIZE = 65536;
+
   /** Default base generator. */
   stdair::BaseGenerator_T DEFAULT_BASE_GENERATOR (stdair::DEFAULT_RANDOM_SEED);
 
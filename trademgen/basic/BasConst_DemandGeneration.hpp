@@ -11,6 +11,7 @@
 #include <stdair/stdair_date_time_types.hpp>
 // TraDemGen
 #include <trademgen/basic/DemandCharacteristicsTypes.hpp>
+#include <trademgen/basic/EpochTimeManager.hpp>
 
 namespace TRADEMGEN {
 
@@ -28,10 +29,22 @@ namespace TRADEMGEN {
 
   /** Default last lower bound of daily rate interval in arrival pattern. */
   extern const stdair::FloatDuration_T DEFAULT_LAST_LOWER_BOUND_ARRIVAL_PATTERN;
+
+  /** Reference departure time (in milliseconds since midnight), from
+      which the date-times of the requests are derived. */
+  extern const EpochTime_T DEFAULT_REFERENCE_DEPARTURE_TIME;
   
   /** Default MAX Advance Purchase. */
   extern const double DEFAULT_MAX_ADVANCE_PURCHASE;
 
+  /** Default minimal number of values of a categorical attribute, for
+      its draws to go through the alias table. */
+  extern const unsigned int DEFAULT_ALIAS_SAMPLING_MIN_SIZE;
+
+  /** Default maximal number of tuples of the joint alias table of the
+      categorical characteristics of a demand stream. */
+  extern const unsigned int DEFAULT_JOINT_CHARACTERISTICS_TABLE_MAX_SIZE;
+
   /** Default base generator. Just here to initialise objects
       (e.g., stdair::RandomGeneration) with default generator. They
       are then replaced by a generator, for which the state can better
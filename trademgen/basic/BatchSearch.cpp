@@ -0,0 +1,331 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cstdint>
+// TraDemGen
+#include <trademgen/basic/BatchSearch.hpp>
+
+// The SIMD kernels are compiled thanks to the target attributes, so
+// that the library does not require any specific compilation flag.
+#if (defined(__GNUC__) || defined(__clang__)) \
+  && (defined(__x86_64__) || defined(__i386__))
+#define TRADEMGEN_BATCHSEARCH_X86
+#include <immintrin.h>
+#endif
+
+namespace TRADEMGEN {
+
+  // //////////////////////////////////////////////////////////////////////
+  const std::size_t BatchSearch::CHUNK_SIZE;
+
+  /**
+   * Predicate of the upper bound search: the key is not greater than
+   * the value (true for NaN values).
+   */
+  struct UpperBoundPredicate {
+    template <typename K>
+    static bool isBefore (const K iKey, const K iValue) {
+      return !(iValue < iKey);
+    }
+  };
+
+  /**
+   * Predicate of the lower bound search: the key is not greater than,
+   * nor equal to, the value (true for NaN values).
+   */
+  struct LowerBoundPredicate {
+    template <typename K>
+    static bool isBefore (const K iKey, const K iValue) {
+      return !(iKey >= iValue);
+    }
+  };
+
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * Branchless binary search of the number of keys (at the beginning of
+   * the array) for which the predicate holds.
+   */
+  template <typename PREDICATE, typename K>
+  static unsigned int searchScalar (const K* iKeyArray,
+                                    const unsigned int iSize,
+                                    const K iValue) {
+    if (iSize == 0) {
+      return 0;
+    }
+    unsigned int lBase = 0;
+    unsigned int lLength = iSize;
+    while (lLength > 1) {
+      const unsigned int lHalf = lLength / 2;
+      lBase += PREDICATE::isBefore (iKeyArray[lBase + lHalf], iValue) ? lHalf : 0;
+      lLength -= lHalf;
+    }
+    return lBase + (PREDICATE::isBefore (iKeyArray[lBase], iValue) ? 1 : 0);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  template <typename PREDICATE, typename K>
+  static void searchKernelScalar (const K* iKeyArray,
+                                  const unsigned int iSize,
+                                  const K* iValueArray,
+                                  unsigned int* oIndexArray,
+                                  const std::size_t iNbOfValues) {
+    for (std::size_t idx = 0; idx < iNbOfValues; ++idx) {
+      oIndexArray[idx] =
+        searchScalar<PREDICATE> (iKeyArray, iSize, iValueArray[idx]);
+    }
+  }
+
+#ifdef TRADEMGEN_BATCHSEARCH_X86
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * AVX2 version: four searches at once. The comparison predicate is
+   * given as an immediate (_CMP_NLT_UQ for the upper bound, with the
+   * value as first operand; _CMP_NGE_UQ for the lower bound, with the
+   * key as first operand).
+   */
+  template <typename PREDICATE, int CMP, bool KEY_FIRST>
+  __attribute__ ((target ("avx2")))
+  static void searchKernelAVX2 (const double* iKeyArray,
+                                const unsigned int iSize,
+                                const double* iValueArray,
+                                unsigned int* oIndexArray,
+                                const std::size_t iNbOfValues) {
+    std::size_t idx = 0;
+    if (iSize != 0) {
+      for ( ; idx + 4 <= iNbOfValues; idx += 4) {
+        const __m256d lValue = _mm256_loadu_pd (iValueArray + idx);
+        __m256i lBase = _mm256_setzero_si256();
+        unsigned int lLength = iSize;
+        while (lLength > 1) {
+          const unsigned int lHalf = lLength / 2;
+          const __m256i lHalfVector = _mm256_set1_epi64x (lHalf);
+          const __m256d lKey =
+            _mm256_i64gather_pd (iKeyArray,
+                                 _mm256_add_epi64 (lBase, lHalfVector), 8);
+          const __m256d lMask = KEY_FIRST ? _mm256_cmp_pd (lKey, lValue, CMP)
+            : _mm256_cmp_pd (lValue, lKey, CMP);
+          lBase = _mm256_add_epi64 (lBase,
+                                    _mm256_and_si256 (_mm256_castpd_si256 (lMask),
+                                                      lHalfVector));
+          lLength -= lHalf;
+        }
+        const __m256d lKey = _mm256_i64gather_pd (iKeyArray, lBase, 8);
+        const __m256d lMask = KEY_FIRST ? _mm256_cmp_pd (lKey, lValue, CMP)
+          : _mm256_cmp_pd (lValue, lKey, CMP);
+        lBase = _mm256_sub_epi64 (lBase, _mm256_castpd_si256 (lMask));
+
+        std::int64_t lIndexArray[4];
+        _mm256_storeu_si256 (reinterpret_cast<__m256i*> (lIndexArray), lBase);
+        for (unsigned int lLane = 0; lLane < 4; ++lLane) {
+          oIndexArray[idx + lLane] = static_cast<unsigned int> (lIndexArray[lLane]);
+        }
+      }
+    }
+    searchKernelScalar<PREDICATE> (iKeyArray, iSize, iValueArray + idx,
+                                   oIndexArray + idx, iNbOfValues - idx);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * AVX-512 version: eight searches at once.
+   */
+  template <typename PREDICATE, int CMP, bool KEY_FIRST>
+  __attribute__ ((target ("avx512f")))
+  static void searchKernelAVX512 (const double* iKeyArray,
+                                  const unsigned int iSize,
+                                  const double* iValueArray,
+                                  unsigned int* oIndexArray,
+                                  const std::size_t iNbOfValues) {
+    std::size_t idx = 0;
+    if (iSize != 0) {
+      // (The gathers are given an explicit source, rather than an
+      // undefined one, which some compilers wrongly warn about.)
+      const __m512d lZero = _mm512_setzero_pd();
+      for ( ; idx + 8 <= iNbOfValues; idx += 8) {
+        const __m512d lValue = _mm512_loadu_pd (iValueArray + idx);
+        __m512i lBase = _mm512_setzero_si512();
+        unsigned int lLength = iSize;
+        while (lLength > 1) {
+          const unsigned int lHalf = lLength / 2;
+          const __m512i lHalfVector = _mm512_set1_epi64 (lHalf);
+          const __m512d lKey =
+            _mm512_mask_i64gather_pd (lZero, 0xFF,
+                                      _mm512_add_epi64 (lBase, lHalfVector),
+                                      iKeyArray, 8);
+          const __mmask8 lMask = KEY_FIRST ? _mm512_cmp_pd_mask (lKey, lValue, CMP)
+            : _mm512_cmp_pd_mask (lValue, lKey, CMP);
+          lBase = _mm512_mask_add_epi64 (lBase, lMask, lBase, lHalfVector);
+          lLength -= lHalf;
+        }
+        const __m512d lKey =
+          _mm512_mask_i64gather_pd (lZero, 0xFF, lBase, iKeyArray, 8);
+        const __mmask8 lMask = KEY_FIRST ? _mm512_cmp_pd_mask (lKey, lValue, CMP)
+          : _mm512_cmp_pd_mask (lValue, lKey, CMP);
+        lBase = _mm512_mask_add_epi64 (lBase, lMask, lBase,
+                                       _mm512_set1_epi64 (1));
+
+        // Narrow the 64-bit indexes down to 32 bits.
+        _mm256_storeu_si256 (reinterpret_cast<__m256i*> (oIndexArray + idx),
+                             _mm512_maskz_cvtepi64_epi32 (0xFF, lBase));
+      }
+    }
+    searchKernelScalar<PREDICATE> (iKeyArray, iSize, iValueArray + idx,
+                                   oIndexArray + idx, iNbOfValues - idx);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * AVX2 version over unsigned 32-bit integers: eight searches at once.
+   * As AVX2 only compares signed integers, the keys and the values are
+   * biased by 2^31 (i.e., their sign bits are flipped), which keeps
+   * their order.
+   */
+  template <typename PREDICATE, bool UPPER_BOUND>
+  __attribute__ ((target ("avx2")))
+  static void searchIntegerKernelAVX2 (const boost::uint32_t* iKeyArray,
+                                       const unsigned int iSize,
+                                       const boost::uint32_t* iValueArray,
+                                       unsigned int* oIndexArray,
+                                       const std::size_t iNbOfValues) {
+    std::size_t idx = 0;
+    if (iSize != 0) {
+      const int* lKeyArray = reinterpret_cast<const int*> (iKeyArray);
+      const __m256i lBias = _mm256_set1_epi32 (static_cast<int> (0x80000000u));
+      for ( ; idx + 8 <= iNbOfValues; idx += 8) {
+        const __m256i lValue =
+          _mm256_xor_si256 (_mm256_loadu_si256 (reinterpret_cast<const __m256i*>
+                                                (iValueArray + idx)), lBias);
+        __m256i lBase = _mm256_setzero_si256();
+        unsigned int lLength = iSize;
+        while (lLength > 1) {
+          const unsigned int lHalf = lLength / 2;
+          const __m256i lHalfVector = _mm256_set1_epi32 (static_cast<int> (lHalf));
+          const __m256i lKey =
+            _mm256_xor_si256 (_mm256_i32gather_epi32 (lKeyArray,
+                                                      _mm256_add_epi32 (lBase, lHalfVector),
+                                                      4), lBias);
+          // Upper bound: !(key > value); lower bound: value > key.
+          const __m256i lMask = UPPER_BOUND ?
+            _mm256_cmpgt_epi32 (lKey, lValue) : _mm256_cmpgt_epi32 (lValue, lKey);
+          lBase = _mm256_add_epi32 (lBase, UPPER_BOUND ?
+                                    _mm256_andnot_si256 (lMask, lHalfVector)
+                                    : _mm256_and_si256 (lMask, lHalfVector));
+          lLength -= lHalf;
+        }
+        const __m256i lKey =
+          _mm256_xor_si256 (_mm256_i32gather_epi32 (lKeyArray, lBase, 4), lBias);
+        const __m256i lMask = UPPER_BOUND ?
+          _mm256_cmpgt_epi32 (lKey, lValue) : _mm256_cmpgt_epi32 (lValue, lKey);
+        lBase = UPPER_BOUND ?
+          _mm256_add_epi32 (_mm256_add_epi32 (lBase, _mm256_set1_epi32 (1)), lMask)
+          : _mm256_sub_epi32 (lBase, lMask);
+
+        _mm256_storeu_si256 (reinterpret_cast<__m256i*> (oIndexArray + idx), lBase);
+      }
+    }
+    searchKernelScalar<PREDICATE> (iKeyArray, iSize, iValueArray + idx,
+                                   oIndexArray + idx, iNbOfValues - idx);
+  }
+#endif // TRADEMGEN_BATCHSEARCH_X86
+
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * Kernels selected according to the instruction sets supported by the
+   * processor.
+   */
+  struct BatchSearchKernels {
+    BatchSearchKernels()
+      : _instructionSet ("scalar"),
+        _upperBoundKernel (&searchKernelScalar<UpperBoundPredicate, double>),
+        _lowerBoundKernel (&searchKernelScalar<LowerBoundPredicate, double>),
+        _integerUpperBoundKernel (&searchKernelScalar<UpperBoundPredicate,
+                                  boost::uint32_t>),
+        _integerLowerBoundKernel (&searchKernelScalar<LowerBoundPredicate,
+                                  boost::uint32_t>) {
+#ifdef TRADEMGEN_BATCHSEARCH_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports ("avx2")) {
+        _integerUpperBoundKernel =
+          &searchIntegerKernelAVX2<UpperBoundPredicate, true>;
+        _integerLowerBoundKernel =
+          &searchIntegerKernelAVX2<LowerBoundPredicate, false>;
+      }
+
+      if (__builtin_cpu_supports ("avx512f")) {
+        _instructionSet = "avx512";
+        _upperBoundKernel =
+          &searchKernelAVX512<UpperBoundPredicate, _CMP_NLT_UQ, false>;
+        _lowerBoundKernel =
+          &searchKernelAVX512<LowerBoundPredicate, _CMP_NGE_UQ, true>;
+
+      } else if (__builtin_cpu_supports ("avx2")) {
+        _instructionSet = "avx2";
+        _upperBoundKernel =
+          &searchKernelAVX2<UpperBoundPredicate, _CMP_NLT_UQ, false>;
+        _lowerBoundKernel =
+          &searchKernelAVX2<LowerBoundPredicate, _CMP_NGE_UQ, true>;
+      }
+#endif // TRADEMGEN_BATCHSEARCH_X86
+    }
+
+    const char* _instructionSet;
+    BatchSearch::SearchKernel_T _upperBoundKernel;
+    BatchSearch::SearchKernel_T _lowerBoundKernel;
+    BatchSearch::IntegerSearchKernel_T _integerUpperBoundKernel;
+    BatchSearch::IntegerSearchKernel_T _integerLowerBoundKernel;
+  };
+
+  // //////////////////////////////////////////////////////////////////////
+  static const BatchSearchKernels& getKernels() {
+    static const BatchSearchKernels lKernels;
+    return lKernels;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void BatchSearch::getUpperBounds (const double* iKeyArray,
+                                    const unsigned int iSize,
+                                    const double* iValueArray,
+                                    unsigned int* oIndexArray,
+                                    const std::size_t iNbOfValues) {
+    getKernels()._upperBoundKernel (iKeyArray, iSize, iValueArray,
+                                    oIndexArray, iNbOfValues);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void BatchSearch::getLowerBounds (const double* iKeyArray,
+                                    const unsigned int iSize,
+                                    const double* iValueArray,
+                                    unsigned int* oIndexArray,
+                                    const std::size_t iNbOfValues) {
+    getKernels()._lowerBoundKernel (iKeyArray, iSize, iValueArray,
+                                    oIndexArray, iNbOfValues);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void BatchSearch::getUpperBounds (const boost::uint32_t* iKeyArray,
+                                    const unsigned int iSize,
+                                    const boost::uint32_t* iValueArray,
+                                    unsigned int* oIndexArray,
+                                    const std::size_t iNbOfValues) {
+    getKernels()._integerUpperBoundKernel (iKeyArray, iSize, iValueArray,
+                                           oIndexArray, iNbOfValues);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void BatchSearch::getLowerBounds (const boost::uint32_t* iKeyArray,
+                                    const unsigned int iSize,
+                                    const boost::uint32_t* iValueArray,
+                                    unsigned int* oIndexArray,
+                                    const std::size_t iNbOfValues) {
+    getKernels()._integerLowerBoundKernel (iKeyArray, iSize, iValueArray,
+                                           oIndexArray, iNbOfValues);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const char* BatchSearch::getInstructionSet() {
+    return getKernels()._instructionSet;
+  }
+
+}
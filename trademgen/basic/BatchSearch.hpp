@@ -0,0 +1,110 @@
+#ifndef __TRADEMGEN_BAS_BATCHSEARCH_HPP
+#define __TRADEMGEN_BAS_BATCHSEARCH_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cstddef>
+// Boost
+#include <boost/cstdint.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Class wrapper of the searches of many values at once within
+   * a sorted array of keys.
+   *
+   * The searches are branchless binary searches, run side by side on
+   * the lanes of the SIMD registers. The widest instruction set
+   * supported by the processor (AVX-512, AVX2) is selected at run-time,
+   * with a scalar fallback. All the versions give the same results.
+   *
+   * The keys are either double-precision numbers or unsigned 32-bit
+   * integers (e.g., dictionary-coded cumulative probabilities), which
+   * are searched for directly, without being converted.
+   */
+  class BatchSearch {
+  public:
+    // //////////// Type definitions /////////////////
+    /**
+     * Type of the search kernels.
+     */
+    typedef void (*SearchKernel_T) (const double*, const unsigned int,
+                                    const double*, unsigned int*,
+                                    const std::size_t);
+
+    /**
+     * Type of the search kernels over unsigned 32-bit integers.
+     */
+    typedef void (*IntegerSearchKernel_T) (const boost::uint32_t*,
+                                           const unsigned int,
+                                           const boost::uint32_t*,
+                                           unsigned int*, const std::size_t);
+
+    /**
+     * Number of values searched for at once by the callers of the
+     * kernels (e.g., size of their temporary buffers).
+     */
+    static const std::size_t CHUNK_SIZE = 256;
+
+
+  public:
+    // //////////// Business methods /////////////////
+    /**
+     * For each value, get the index of the first key strictly greater
+     * than that value (i.e., the number of keys when there is no such
+     * key, which is also the case for NaN values).
+     *
+     * @param const double* Non-decreasing array of keys.
+     * @param const unsigned int Number of keys.
+     * @param const double* Array of the values to be searched for.
+     * @param unsigned int* Array receiving the indexes.
+     * @param const std::size_t Number of values.
+     */
+    static void getUpperBounds (const double* iKeyArray,
+                                const unsigned int iSize,
+                                const double* iValueArray,
+                                unsigned int* oIndexArray,
+                                const std::size_t iNbOfValues);
+
+    /**
+     * For each value, get the index of the first key greater than or
+     * equal to that value (i.e., the number of keys when there is no
+     * such key, which is also the case for NaN values).
+     *
+     * @see getUpperBounds() for the parameters.
+     */
+    static void getLowerBounds (const double* iKeyArray,
+                                const unsigned int iSize,
+                                const double* iValueArray,
+                                unsigned int* oIndexArray,
+                                const std::size_t iNbOfValues);
+
+    /**
+     * Same as getUpperBounds(), over unsigned 32-bit integers.
+     */
+    static void getUpperBounds (const boost::uint32_t* iKeyArray,
+                                const unsigned int iSize,
+                                const boost::uint32_t* iValueArray,
+                                unsigned int* oIndexArray,
+                                const std::size_t iNbOfValues);
+
+    /**
+     * Same as getLowerBounds(), over unsigned 32-bit integers.
+     */
+    static void getLowerBounds (const boost::uint32_t* iKeyArray,
+                                const unsigned int iSize,
+                                const boost::uint32_t* iValueArray,
+                                unsigned int* oIndexArray,
+                                const std::size_t iNbOfValues);
+
+    /**
+     * Get the name of the instruction set used by the kernels
+     * ("avx512", "avx2" or "scalar"). The kernels over unsigned 32-bit
+     * integers use AVX2 at most.
+     */
+    static const char* getInstructionSet();
+  };
+}
+#endif // __TRADEMGEN_BAS_BATCHSEARCH_HPP
@@ -0,0 +1,58 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// Boost
+#include <boost/make_shared.hpp>
+#include <boost/pool/pool_alloc.hpp>
+// TraDemGen
+#include <trademgen/basic/BookingRequestPool.hpp>
+
+namespace TRADEMGEN {
+
+  // //////////// Type definitions /////////////////
+  /**
+   * Allocator of the booking request structures. It is rebound, by
+   * boost::allocate_shared(), to the type holding both the structure
+   * and its reference counters; all the blocks of that type are taken
+   * from a single (thread-safe) pool.
+   */
+  typedef boost::fast_pool_allocator<stdair::BookingRequestStruct>
+  BookingRequestAllocator_T;
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::BookingRequestPtr_T BookingRequestPool::
+  create (const stdair::BookingRequestStruct& iBookingRequestStruct) {
+    return boost::allocate_shared<stdair::BookingRequestStruct>
+      (BookingRequestAllocator_T(), iBookingRequestStruct);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::BookingRequestPtr_T BookingRequestPool::
+  create (const stdair::DemandGeneratorKey_T& iGeneratorKey,
+          const stdair::AirportCode_T& iOrigin,
+          const stdair::AirportCode_T& iDestination,
+          const stdair::AirportCode_T& iPOS,
+          const stdair::Date_T& iDepartureDate,
+          const stdair::DateTime_T& iRequestDateTime,
+          const stdair::CabinCode_T& iPreferredCabin,
+          const stdair::NbOfSeats_T& iPartySize,
+          const stdair::ChannelLabel_T& iChannel,
+          const stdair::TripType_T& iTripType,
+          const stdair::DayDuration_T& iStayDuration,
+          const stdair::FrequentFlyer_T& iFrequentFlyerType,
+          const stdair::Duration_T& iPreferredDepartureTime,
+          const stdair::WTP_T& iWTP,
+          const stdair::PriceValue_T& iValueOfTime,
+          const stdair::ChangeFees_T& iChangeFees,
+          const stdair::Disutility_T& iChangeFeeDisutility,
+          const stdair::NonRefundable_T& iNonRefundable,
+          const stdair::Disutility_T& iNonRefundableDisutility) {
+    return boost::allocate_shared<stdair::BookingRequestStruct>
+      (BookingRequestAllocator_T(), iGeneratorKey, iOrigin, iDestination,
+       iPOS, iDepartureDate, iRequestDateTime, iPreferredCabin, iPartySize,
+       iChannel, iTripType, iStayDuration, iFrequentFlyerType,
+       iPreferredDepartureTime, iWTP, iValueOfTime, iChangeFees,
+       iChangeFeeDisutility, iNonRefundable, iNonRefundableDisutility);
+  }
+
+}
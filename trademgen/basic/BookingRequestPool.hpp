@@ -0,0 +1,68 @@
+#ifndef __TRADEMGEN_BAS_BOOKINGREQUESTPOOL_HPP
+#define __TRADEMGEN_BAS_BOOKINGREQUESTPOOL_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// StdAir
+#include <stdair/bom/BookingRequestStruct.hpp>
+#include <stdair/bom/BookingRequestTypes.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Pool of the booking request structures.
+   *
+   * The booking request structures (along with the reference counters
+   * of their shared pointers) are allocated within fixed-size blocks,
+   * which are recycled as soon as the structures are released, rather
+   * than given back to the heap. Once the number of live requests
+   * (e.g., the ones within the event queue) has reached its steady
+   * state, creating a booking request does not allocate any block.
+   *
+   * \note The string attributes of the structures (e.g., the demand
+   *       generator key) still allocate their own buffers, when they
+   *       are too long to be held within the strings themselves.
+   *
+   * \note The blocks are never given back to the heap: they are kept,
+   *       for the lifetime of the process, by a pool shared by all the
+   *       demand streams (and all the services).
+   */
+  class BookingRequestPool {
+  public:
+    // //////////// Business methods /////////////////
+    /**
+     * Create a booking request structure, copied from the given one,
+     * within the pool.
+     */
+    static stdair::BookingRequestPtr_T
+    create (const stdair::BookingRequestStruct&);
+
+    /**
+     * Create a booking request structure within the pool, built in
+     * place from the given attributes (the parameters are the ones of
+     * the stdair::BookingRequestStruct constructor).
+     */
+    static stdair::BookingRequestPtr_T
+    create (const stdair::DemandGeneratorKey_T&,
+            const stdair::AirportCode_T& iOrigin,
+            const stdair::AirportCode_T& iDestination,
+            const stdair::AirportCode_T& iPOS,
+            const stdair::Date_T& iDepartureDate,
+            const stdair::DateTime_T& iRequestDateTime,
+            const stdair::CabinCode_T& iPreferredCabin,
+            const stdair::NbOfSeats_T& iPartySize,
+            const stdair::ChannelLabel_T&,
+            const stdair::TripType_T&,
+            const stdair::DayDuration_T& iStayDuration,
+            const stdair::FrequentFlyer_T&,
+            const stdair::Duration_T& iPreferredDepartureTime,
+            const stdair::WTP_T&,
+            const stdair::PriceValue_T& iValueOfTime,
+            const stdair::ChangeFees_T&,
+            const stdair::Disutility_T& iChangeFeeDisutility,
+            const stdair::NonRefundable_T&,
+            const stdair::Disutility_T& iNonRefundableDisutility);
+  };
+}
+#endif // __TRADEMGEN_BAS_BOOKINGREQUESTPOOL_HPP
@@ -6,22 +6,32 @@
 // //////////////////////////////////////////////////////////////////////
 // STL
 #include <cassert>
+#include <cstddef>
+#include <algorithm>
 #include <sstream>
 #include <string>
-#include <vector>
 #include <map>
+// Boost
+#include <boost/functional/hash.hpp>
 // StdAir
 #include <stdair/stdair_basic_types.hpp>
 #include <stdair/service/Logger.hpp>
 // TraDemGen
 #include <trademgen/TRADEMGEN_Exceptions.hpp>
+#include <trademgen/basic/AliasTable.hpp>
+#include <trademgen/basic/BatchSearch.hpp>
+#include <trademgen/basic/CodePool.hpp>
 #include <trademgen/basic/DictionaryManager.hpp>
+#include <trademgen/basic/SmallVector.hpp>
 
 namespace TRADEMGEN {
 
   /**
    * @brief Class modeling the distribution of values that can be
    * taken by a categorical attribute.
+   *
+   * String values (e.g., POS, channels, trip types) are stored as
+   * codes of the CodePool.
    */
   template <typename T>
   struct CategoricalAttributeLite {
@@ -31,6 +41,16 @@ namespace TRADEMGEN {
      * Type for the probability mass function.
      */
     typedef std::map<T, stdair::Probability_T> ProbabilityMassFunction_T;
+
+    /**
+     * Storage of the values.
+     */
+    typedef InternedValueTraits<T> ValueTraits_T;
+
+    /**
+     * Type of the stored values (codes of the CodePool for strings).
+     */
+    typedef typename ValueTraits_T::Stored_T Stored_T;
     
 
   public:
@@ -39,13 +59,21 @@ namespace TRADEMGEN {
      * Get value from inverse cumulative distribution.
      */
     const T& getValue (const stdair::Probability_T& iCumulativeProbability) const {
+      return ValueTraits_T::getValue (getStoredValue (iCumulativeProbability));
+    }
+
+    /**
+     * Get stored value (e.g., code of the CodePool) from inverse
+     * cumulative distribution.
+     */
+    const Stored_T&
+    getStoredValue (const stdair::Probability_T& iCumulativeProbability) const {
       const DictionaryKey_T& lKey =
         DictionaryManager::valueToKey (iCumulativeProbability);
 
       for (unsigned int idx = 0; idx < _size; ++idx) {
         if (_cumulativeDistribution.at(idx) >= lKey) {
-          const T& oValue = _valueArray.at(idx);
-          return oValue;
+          return _valueArray.at(idx);
         }
       }
 
@@ -55,17 +83,145 @@ namespace TRADEMGEN {
       throw IndexOutOfRangeException (oStr.str());
     }
 
+    /**
+     * Get values from inverse cumulative distribution, for a whole
+     * array of cumulative probabilities at once.
+     *
+     * The values are searched for with the SIMD kernels of
+     * BatchSearch. Each value is the same as the one given by
+     * getValue() for the same cumulative probability.
+     */
+    void getValues (const double* iCumulativeProbabilityArray,
+                    T* oValueArray, const std::size_t iNbOfValues) const {
+      if (iNbOfValues == 0) {
+        return;
+      }
+
+      const unsigned int lSize = _cumulativeDistribution.size();
+      DictionaryKey_T lKeyArray[BatchSearch::CHUNK_SIZE];
+      unsigned int lIndexArray[BatchSearch::CHUNK_SIZE];
+
+      for (std::size_t lStart = 0; lStart < iNbOfValues;
+           lStart += BatchSearch::CHUNK_SIZE) {
+        const std::size_t lLength =
+          std::min (BatchSearch::CHUNK_SIZE, iNbOfValues - lStart);
+
+        for (std::size_t idx = 0; idx < lLength; ++idx) {
+          const stdair::Probability_T lCumulativeProbability =
+            iCumulativeProbabilityArray[lStart + idx];
+          lKeyArray[idx] =
+            DictionaryManager::valueToKey (lCumulativeProbability);
+        }
+
+        // Find the first cumulative probablity values greater than or
+        // equal to the keys.
+        BatchSearch::getLowerBounds (_cumulativeDistribution.data(), lSize,
+                                     lKeyArray, lIndexArray, lLength);
+
+        for (std::size_t idx = 0; idx < lLength; ++idx) {
+          const unsigned int lIndex = lIndexArray[idx];
+          if (lIndex >= lSize) {
+            std::ostringstream oStr;
+            oStr << "The following cumulative probability is out of range: "
+                 << iCumulativeProbabilityArray[lStart + idx]
+                 << displayProbabilityMass();
+            throw IndexOutOfRangeException (oStr.str());
+          }
+          oValueArray[lStart + idx] =
+            ValueTraits_T::getValue (_valueArray[lIndex]);
+        }
+      }
+    }
+
+    /**
+     * Get value thanks to the alias table, from a uniform variate.
+     *
+     * That draw takes a constant time, whatever the number of values.
+     * Unlike the inverse cumulative distribution, it does not
+     * preserve the order of the values with respect to the variate.
+     */
+    const T& getValueByAlias (const stdair::Probability_T& iVariate) const {
+      return ValueTraits_T::getValue (getStoredValueByAlias (iVariate));
+    }
+
+    /**
+     * Get stored value (e.g., code of the CodePool) thanks to the
+     * alias table, from a uniform variate.
+     */
+    const Stored_T&
+    getStoredValueByAlias (const stdair::Probability_T& iVariate) const {
+      if (_aliasTable.getSize() == 0) {
+        std::ostringstream oStr;
+        oStr << "The following probability mass is empty: "
+             << displayProbabilityMass();
+        throw IndexOutOfRangeException (oStr.str());
+      }
+
+      const unsigned int idx = _aliasTable.getIndex (iVariate);
+      return _valueArray[idx];
+    }
+
+    /**
+     * Get the number of values (with a non-null probability mass).
+     */
+    unsigned int getSize() const {
+      return _valueArray.size();
+    }
+
+    /**
+     * Get the value at the given index.
+     */
+    const T& getValueAt (const unsigned int idx) const {
+      return ValueTraits_T::getValue (_valueArray.at(idx));
+    }
+
+    /**
+     * Get the stored value (e.g., code of the CodePool) at the given
+     * index.
+     */
+    const Stored_T& getStoredValueAt (const unsigned int idx) const {
+      return _valueArray.at(idx);
+    }
+
+    /**
+     * Get the (non-null) probability masses of the values.
+     */
+    const AliasTable::MassArray_T& getProbabilityMassArray() const {
+      return _probabilityMassArray;
+    }
+
     /**
      * Check if a value belongs to the value list.
      */
     bool checkValue (const T& iValue) const {
       for (unsigned int idx = 0; idx < _size; ++idx) {
-        if (_valueArray.at(idx) == iValue) {
+        if (getValueAt (idx) == iValue) {
           return true;
         }
       }
       return false;
     }
+
+    /**
+     * Get the hash value of the distribution (i.e., of its values and
+     * probability masses).
+     */
+    std::size_t getHashValue() const {
+      std::size_t oHashValue =
+        boost::hash_range (_valueArray.begin(), _valueArray.end());
+      boost::hash_combine (oHashValue,
+                           boost::hash_range (_probabilityMassArray.begin(),
+                                              _probabilityMassArray.end()));
+      return oHashValue;
+    }
+
+    /**
+     * Equality operator (same values, with the same probability masses).
+     */
+    bool operator== (const CategoricalAttributeLite& iCAL) const {
+      return (_valueArray == iCAL._valueArray
+              && _probabilityMassArray == iCAL._probabilityMassArray);
+    }
     
 
   public:
@@ -80,7 +236,7 @@ namespace TRADEMGEN {
         if (idx != 0) {
           oStr << ", ";
         }
-        oStr << _valueArray.at(idx) << ":"
+        oStr << getValueAt (idx) << ":"
              << DictionaryManager::keyToValue (_cumulativeDistribution[idx]);
       }
       return oStr.str();
@@ -109,7 +265,9 @@ namespace TRADEMGEN {
     CategoricalAttributeLite (const CategoricalAttributeLite& iCAL)
       : _size (iCAL._size),
         _cumulativeDistribution (iCAL._cumulativeDistribution),
-        _valueArray (iCAL._valueArray) {
+        _valueArray (iCAL._valueArray),
+        _probabilityMassArray (iCAL._probabilityMassArray),
+        _aliasTable (iCAL._aliasTable) {
     }
 
     /**
@@ -119,6 +277,8 @@ namespace TRADEMGEN {
       _size = iCAL._size;
       _cumulativeDistribution = iCAL._cumulativeDistribution;
       _valueArray = iCAL._valueArray;
+      _probabilityMassArray = iCAL._probabilityMassArray;
+      _aliasTable = iCAL._aliasTable;
       return *this;
     }
 
@@ -131,13 +291,14 @@ namespace TRADEMGEN {
 
   private:
     /**
-     * Initialise the two arrays from the given map.
+     * Initialise the arrays and the alias table from the given map.
      */
     void init (const ProbabilityMassFunction_T& iValueMap) {
       
       const unsigned int lSize = iValueMap.size();
       _cumulativeDistribution.reserve (lSize);
       _valueArray.reserve (lSize);
+      _probabilityMassArray.reserve (lSize);
 
       stdair::Probability_T cumulative_probability_so_far = 0.0;
 
@@ -160,11 +321,15 @@ namespace TRADEMGEN {
 
           // Build the two arrays.
           _cumulativeDistribution.push_back (lKey);
-          _valueArray.push_back (attribute_value);
+          _valueArray.push_back (ValueTraits_T::intern (attribute_value));
+          _probabilityMassArray.push_back (attribute_probability_mass);
         }
       }
       // Remember the actual array size.
       _size = _valueArray.size();
+
+      // Build the alias table.
+      _aliasTable.init (_probabilityMassArray);
     }
   
   private:
@@ -175,14 +340,25 @@ namespace TRADEMGEN {
     unsigned int _size;
     
     /**
-     * Cumulative dictionary-coded distribution.
+     * Cumulative dictionary-coded distribution (also searched for, as
+     * such, by the batch look-ups).
      */
-    std::vector<DictionaryKey_T> _cumulativeDistribution;
+    SmallVector<DictionaryKey_T> _cumulativeDistribution;
 
     /**
-       The corresponding values.
+       The corresponding (stored) values.
     */
-    std::vector<T> _valueArray;
+    SmallVector<Stored_T> _valueArray;
+
+    /**
+     * The corresponding probability masses.
+     */
+    AliasTable::MassArray_T _probabilityMassArray;
+
+    /**
+     * Alias table over the values, for constant time draws.
+     */
+    AliasTable _aliasTable;
   };
 }
 #endif // __TRADEMGEN_BAS_CATEGORICALATTRIBUTELITE_HPP
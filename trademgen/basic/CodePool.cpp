@@ -0,0 +1,92 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// TraDemGen
+#include <trademgen/TRADEMGEN_Exceptions.hpp>
+#include <trademgen/basic/CodePool.hpp>
+
+namespace TRADEMGEN {
+
+  // /////////////////////////////////////////////////////
+  CodePool::CodePool() : _size (0) {
+    for (unsigned int lChunk = 0; lChunk != MAX_NB_OF_CHUNKS; ++lChunk) {
+      _chunkArray[lChunk] = NULL;
+    }
+  }
+
+  // /////////////////////////////////////////////////////
+  CodePool::~CodePool() {
+    for (unsigned int lChunk = 0; lChunk != MAX_NB_OF_CHUNKS; ++lChunk) {
+      delete[] _chunkArray[lChunk];
+    }
+  }
+
+  // /////////////////////////////////////////////////////
+  CodePool& CodePool::instance() {
+    static CodePool lCodePool;
+    return lCodePool;
+  }
+
+  // /////////////////////////////////////////////////////
+  unsigned int CodePool::getChunk (const Code_T& iCode, std::size_t& oIndex) {
+    // The chunk c starts at the code 2^(c + L) - 2^L, where 2^L is the
+    // size of the first chunk
+    const boost::uint64_t lShiftedCode =
+      static_cast<boost::uint64_t> (iCode) + (1u << FIRST_CHUNK_SIZE_LOG2);
+    unsigned int lLog2 = FIRST_CHUNK_SIZE_LOG2;
+    while ((lShiftedCode >> (lLog2 + 1)) != 0) {
+      ++lLog2;
+    }
+    oIndex = lShiftedCode - (static_cast<boost::uint64_t> (1) << lLog2);
+    return lLog2 - FIRST_CHUNK_SIZE_LOG2;
+  }
+
+  // /////////////////////////////////////////////////////
+  Code_T CodePool::intern (const std::string& iString) {
+    const std::lock_guard<std::mutex> lGuard (_mutex);
+    const Code_T lCode = _size.load (std::memory_order_relaxed);
+    const std::pair<CodeMap_T::iterator, bool> lInsertion =
+      _codeMap.insert (CodeMap_T::value_type (iString, lCode));
+    if (lInsertion.second == true) {
+      std::size_t lIndex = 0;
+      const unsigned int lChunk = getChunk (lCode, lIndex);
+      assert (lChunk < MAX_NB_OF_CHUNKS);
+      if (_chunkArray[lChunk] == NULL) {
+        _chunkArray[lChunk] =
+          new std::string[static_cast<std::size_t> (1) << (lChunk + FIRST_CHUNK_SIZE_LOG2)];
+      }
+      _chunkArray[lChunk][lIndex] = iString;
+
+      // Publish the new string to the readers
+      _size.store (lCode + 1, std::memory_order_release);
+    }
+    return lInsertion.first->second;
+  }
+
+  // /////////////////////////////////////////////////////
+  const std::string& CodePool::getString (const Code_T& iCode) const {
+    // Synchronise with the interning of the last published string
+    const Code_T lSize = _size.load (std::memory_order_acquire);
+    assert (iCode < lSize);
+    (void) lSize;
+
+    std::size_t lIndex = 0;
+    const unsigned int lChunk = getChunk (iCode, lIndex);
+    assert (_chunkArray[lChunk] != NULL);
+    return _chunkArray[lChunk][lIndex];
+  }
+
+  // /////////////////////////////////////////////////////
+  Code_T CodePool::getCode (const std::string& iString) const {
+    const std::lock_guard<std::mutex> lGuard (_mutex);
+    const CodeMap_T::const_iterator itCode = _codeMap.find (iString);
+    if (itCode == _codeMap.end()) {
+      throw CodeNotFoundException ("The '" + iString
+                                   + "' string has not been interned");
+    }
+    return itCode->second;
+  }
+
+}
@@ -0,0 +1,201 @@
+#ifndef __TRADEMGEN_BAS_CODEPOOL_HPP
+#define __TRADEMGEN_BAS_CODEPOOL_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+// Boost
+#include <boost/cstdint.hpp>
+#include <boost/unordered_map.hpp>
+
+namespace TRADEMGEN {
+
+  // //////////// Type definitions /////////////////
+  /**
+   * Interned code, standing for a string (e.g., an airport code, a
+   * cabin code or a channel label) of the CodePool.
+   */
+  typedef boost::uint32_t Code_T;
+
+  /**
+   * @brief Pool of the interned strings (airport and cabin codes,
+   * channel labels, trip types, frequent flyer types, etc.).
+   *
+   * Each distinct string is stored once, and is given a small integer
+   * code, so that the demand stream keys and the values of the
+   * categorical attributes can be stored, compared and hashed as
+   * integers. The strings are given back only for display and
+   * serialisation, by reference: they stay at the same address as
+   * long as the pool lives.
+   *
+   * The pool is shared by all the TraDemGen services of the process.
+   * Interning and looking up the codes of the strings are serialised,
+   * so that several services may load their demand at once.
+   *
+   * Giving the strings back takes no lock, even while other threads
+   * intern strings (e.g., while another service loads its demand): the
+   * strings are stored within chunks, which are never moved nor freed
+   * before the pool, and the number of interned strings is published
+   * (with a release/acquire pair) only once the string of the new code
+   * has been stored.
+   */
+  class CodePool {
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Get the code of the given string, interning it when it is not
+     * in the pool yet.
+     */
+    Code_T intern (const std::string&);
+
+    /**
+     * Get the code of the given string, which has been interned
+     * already. Contrary to intern(), it leaves the pool untouched, and
+     * may thus be called by several threads at once.
+     *
+     * \note A CodeNotFoundException is thrown when the string has not
+     *       been interned.
+     */
+    Code_T getCode (const std::string&) const;
+
+    /**
+     * Get the string corresponding to the given code. It may be
+     * called by several threads at once, while strings are interned.
+     */
+    const std::string& getString (const Code_T&) const;
+
+    /**
+     * Get the number of interned strings.
+     */
+    unsigned int getSize() const {
+      return _size.load (std::memory_order_acquire);
+    }
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Get the pool shared by all the demand streams.
+     */
+    static CodePool& instance();
+
+  private:
+    /**
+     * Default constructor.
+     */
+    CodePool();
+
+    /**
+     * Copy constructor (not implemented).
+     */
+    CodePool (const CodePool&);
+
+    /**
+     * Destructor.
+     */
+    ~CodePool();
+
+
+  private:
+    // ///////////// Type definitions //////////////
+    /**
+     * Type for the codes, indexed by the interned strings.
+     */
+    typedef boost::unordered_map<std::string, Code_T> CodeMap_T;
+
+    /**
+     * Base-2 logarithm of the number of strings of the first chunk.
+     * Each next chunk holds twice as many strings as the previous one,
+     * so that the chunks cover all the codes.
+     */
+    static const unsigned int FIRST_CHUNK_SIZE_LOG2 = 6;
+
+    /**
+     * Maximum number of chunks.
+     */
+    static const unsigned int MAX_NB_OF_CHUNKS = 33 - FIRST_CHUNK_SIZE_LOG2;
+
+
+  private:
+    // /////////////////// Business Methods ///////////////////
+    /**
+     * Get the chunk holding the string of the given code, and the
+     * index of that string within the chunk.
+     */
+    static unsigned int getChunk (const Code_T&, std::size_t& oIndex);
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Chunks of the interned strings, in the order of their codes
+     * (null until needed). A chunk is only read for codes below the
+     * published number of strings, hence once it has been allocated.
+     */
+    std::string* _chunkArray[MAX_NB_OF_CHUNKS];
+
+    /**
+     * Number of interned strings (i.e., code to be given to the next
+     * interned string).
+     */
+    std::atomic<Code_T> _size;
+
+    /**
+     * Codes, indexed by the interned strings.
+     */
+    CodeMap_T _codeMap;
+
+    /**
+     * Guard of the interning and of the look-ups of the codes (the
+     * strings are given back without it).
+     */
+    mutable std::mutex _mutex;
+  };
+
+  /**
+   * @brief Storage of the values of a given type within the attribute
+   * tables: the values are stored as they are, except the strings,
+   * which are stored as codes of the CodePool.
+   */
+  template <typename T>
+  struct InternedValueTraits {
+    /** Type of the stored values. */
+    typedef T Stored_T;
+
+    /** Get the stored value corresponding to the given value. */
+    static const Stored_T& intern (const T& iValue) {
+      return iValue;
+    }
+
+    /** Get the value corresponding to the given stored value. */
+    static const T& getValue (const Stored_T& iStoredValue) {
+      return iStoredValue;
+    }
+  };
+
+  /**
+   * Strings are stored as codes of the CodePool.
+   */
+  template <>
+  struct InternedValueTraits<std::string> {
+    /** Type of the stored values. */
+    typedef Code_T Stored_T;
+
+    /** Get the stored value corresponding to the given value. */
+    static Stored_T intern (const std::string& iValue) {
+      return CodePool::instance().intern (iValue);
+    }
+
+    /** Get the value corresponding to the given stored value. */
+    static const std::string& getValue (const Stored_T& iStoredValue) {
+      return CodePool::instance().getString (iStoredValue);
+    }
+  };
+
+}
+#endif // __TRADEMGEN_BAS_CODEPOOL_HPP
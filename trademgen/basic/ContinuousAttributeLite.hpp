@@ -8,19 +8,22 @@
 #include <cassert>
 #include <iosfwd>
 #include <string>
-#include <vector>
 #include <map>
 // StdAir
 #include <stdair/stdair_basic_types.hpp>
 // TraDemGen
 #include <trademgen/TRADEMGEN_Exceptions.hpp>
-#include <trademgen/basic/DictionaryManager.hpp>
+#include <trademgen/basic/SmallVector.hpp>
 
 namespace TRADEMGEN {
 
   /**
    * @brief Class modeling the distribution of values that can be
    * taken by a continuous attribute.
+   *
+   * The cumulative distribution is not dictionary-coded: it is
+   * interpolated, and it does not always hold probabilities (e.g., the
+   * FRAT5 pattern is indexed by days to departure).
    */
   template <typename T>
   struct ContinuousAttributeLite {
@@ -37,13 +40,11 @@ namespace TRADEMGEN {
      * Get value from inverse cumulative distribution.
      */
     const T getValue(const stdair::Probability_T& iCumulativeProbability) const{
-      const DictionaryKey_T& lKey =
-        DictionaryManager::valueToKey (iCumulativeProbability);
-
-      // Find the first cumulative probablity value greater or equal to lKey.
+      // Find the first cumulative probablity value greater than the
+      // given one.
       unsigned int idx = 0;
       for (; idx < _size; ++idx) {
-        if (_cumulativeDistribution.at(idx) > lKey) {
+        if (_cumulativeDistribution.at(idx) > iCumulativeProbability) {
           break;
         }
       }
@@ -57,12 +58,12 @@ namespace TRADEMGEN {
 
       //
       const stdair::Probability_T& lCumulativeCurrentPoint =
-        DictionaryManager::keyToValue (_cumulativeDistribution.at(idx));
+        _cumulativeDistribution.at(idx);
       const T& lValueCurrentPoint = _valueArray.at(idx);
 
       //
       const stdair::Probability_T& lCumulativePreviousPoint =
-        DictionaryManager::keyToValue (_cumulativeDistribution.at(idx-1));
+        _cumulativeDistribution.at(idx-1);
       const T& lValuePreviousPoint = _valueArray.at(idx-1);
 
       if (lCumulativePreviousPoint == lCumulativeCurrentPoint) {
@@ -94,12 +95,12 @@ namespace TRADEMGEN {
 
       // 
       const stdair::Probability_T& lCumulativeCurrentPoint =
-        DictionaryManager::keyToValue (_cumulativeDistribution.at(idx));
+        _cumulativeDistribution.at(idx);
       const T& lValueCurrentPoint = _valueArray.at(idx);
 
       //
       const stdair::Probability_T& lCumulativePreviousPoint =
-        DictionaryManager::keyToValue (_cumulativeDistribution.at(idx-1));
+        _cumulativeDistribution.at(idx-1);
       const T& lValuePreviousPoint = _valueArray.at(idx-1);
 
       assert (lValueCurrentPoint != lValuePreviousPoint);
@@ -141,7 +142,7 @@ namespace TRADEMGEN {
         }
 
         const stdair::Probability_T& lProbability =
-          DictionaryManager::keyToValue (_cumulativeDistribution.at(idx));
+          _cumulativeDistribution.at(idx);
       
         oStr << _valueArray.at(idx) << ":" << lProbability;
       }
@@ -206,10 +207,10 @@ namespace TRADEMGEN {
              iValueMap.begin(); it != iValueMap.end(); ++it) {
         
         const T& attributeValue = it->first;
-        const DictionaryKey_T& lKey = DictionaryManager::valueToKey (it->second);
+        const stdair::Probability_T& lCumulativeProbability = it->second;
         
         // Build the two arrays.
-        _cumulativeDistribution.push_back (lKey);
+        _cumulativeDistribution.push_back (lCumulativeProbability);
         _valueArray.push_back (attributeValue);
       }
     }
@@ -223,14 +224,14 @@ namespace TRADEMGEN {
     unsigned int _size;
     
     /**
-     * Cumulative dictionary-coded distribution.
+     * Cumulative distribution.
      */
-    std::vector<DictionaryKey_T> _cumulativeDistribution;
+    SmallVector<stdair::Probability_T> _cumulativeDistribution;
 
     /**
      * The corresponding values.
      */
-    std::vector<T> _valueArray;
+    SmallVector<T> _valueArray;
   };
   
 }
@@ -0,0 +1,348 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <sstream>
+// TraDemGen
+#include <trademgen/basic/CounterBasedRandomGeneration.hpp>
+
+// The SIMD kernel is compiled thanks to the target attributes, so that
+// the library does not require any specific compilation flag.
+#if (defined(__GNUC__) || defined(__clang__)) \
+  && (defined(__x86_64__) || defined(__i386__))
+#define TRADEMGEN_PHILOX_X86
+#include <immintrin.h>
+#endif
+
+namespace TRADEMGEN {
+
+  /** Philox4x32 multipliers and Weyl sequence increments of the key. */
+  static const boost::uint32_t PHILOX_MULTIPLIER_0 = 0xD2511F53u;
+  static const boost::uint32_t PHILOX_MULTIPLIER_1 = 0xCD9E8D57u;
+  static const boost::uint32_t PHILOX_WEYL_0 = 0x9E3779B9u;
+  static const boost::uint32_t PHILOX_WEYL_1 = 0xBB67AE85u;
+
+  /** Number of rounds. */
+  static const unsigned short PHILOX_NB_OF_ROUNDS = 10;
+
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * Split the master seed into the Philox key.
+   */
+  static void getKey (const stdair::RandomSeed_T& iMasterSeed,
+                      boost::uint32_t oKey[2]) {
+    const boost::uint64_t lMasterSeed =
+      static_cast<boost::uint64_t> (iMasterSeed);
+    oKey[0] = static_cast<boost::uint32_t> (lMasterSeed);
+    oKey[1] = static_cast<boost::uint32_t> (lMasterSeed >> 32);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * Convert two words of a Philox block into a uniform variate within
+   * [0, 1): 53 random bits, so as to cover all the doubles of the form
+   * k / 2^53.
+   */
+  static stdair::RealNumber_T convertIntoUniform01 (const boost::uint32_t iWord0,
+                                                    const boost::uint32_t iWord1) {
+    const boost::uint64_t lBits =
+      (static_cast<boost::uint64_t> (iWord0 >> 5) << 26) | (iWord1 >> 6);
+    return static_cast<stdair::RealNumber_T> (lBits) * (1.0 / 9007199254740992.0);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const unsigned int CounterBasedRandomGeneration::NB_OF_SUB_STREAMS;
+
+  // //////////////////////////////////////////////////////////////////////
+  CounterBasedRandomGeneration::CounterBasedRandomGeneration() {
+    init (0, 0);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CounterBasedRandomGeneration::
+  CounterBasedRandomGeneration (const stdair::RandomSeed_T& iMasterSeed,
+                                const StreamId_T& iStreamId,
+                                const DrawIndex_T& iDrawIndex) {
+    init (iMasterSeed, iStreamId, iDrawIndex);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CounterBasedRandomGeneration::init (const stdair::RandomSeed_T& iMasterSeed,
+                                           const StreamId_T& iStreamId,
+                                           const DrawIndex_T& iDrawIndex) {
+    getKey (iMasterSeed, _key);
+    _streamId = iStreamId;
+    setDrawIndex (iDrawIndex);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::RandomSeed_T CounterBasedRandomGeneration::getMasterSeed() const {
+    const boost::uint64_t lMasterSeed =
+      (static_cast<boost::uint64_t> (_key[1]) << 32) | _key[0];
+    return static_cast<stdair::RandomSeed_T> (lMasterSeed);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const std::string CounterBasedRandomGeneration::describe() const {
+    std::ostringstream oStr;
+    oStr << "Philox4x32-10 (" << getMasterSeed() << ", " << _streamId
+         << ") @ " << _drawIndex;
+    return oStr.str();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CounterBasedRandomGeneration::
+  generateBlock (const boost::uint32_t iCounter[4],
+                 const boost::uint32_t iKey[2], boost::uint32_t oBlock[4]) {
+    boost::uint32_t c0 = iCounter[0], c1 = iCounter[1];
+    boost::uint32_t c2 = iCounter[2], c3 = iCounter[3];
+    boost::uint32_t k0 = iKey[0], k1 = iKey[1];
+    for (unsigned short lRound = 0; lRound < PHILOX_NB_OF_ROUNDS; ++lRound) {
+      const boost::uint64_t lProduct0 =
+        static_cast<boost::uint64_t> (PHILOX_MULTIPLIER_0) * c0;
+      const boost::uint64_t lProduct1 =
+        static_cast<boost::uint64_t> (PHILOX_MULTIPLIER_1) * c2;
+      c0 = static_cast<boost::uint32_t> (lProduct1 >> 32) ^ c1 ^ k0;
+      c1 = static_cast<boost::uint32_t> (lProduct1);
+      c2 = static_cast<boost::uint32_t> (lProduct0 >> 32) ^ c3 ^ k1;
+      c3 = static_cast<boost::uint32_t> (lProduct0);
+      k0 += PHILOX_WEYL_0;
+      k1 += PHILOX_WEYL_1;
+    }
+    oBlock[0] = c0; oBlock[1] = c1; oBlock[2] = c2; oBlock[3] = c3;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CounterBasedRandomGeneration::StreamId_T CounterBasedRandomGeneration::
+  generateStreamId (const std::string& iKey) {
+    // 64-bit FNV-1a hash of the key, which does not depend on the
+    // platform.
+    const boost::uint64_t lPrime = 0x100000001B3ull;
+    boost::uint64_t oStreamId = 0xCBF29CE484222325ull;
+    for (std::string::const_iterator itChar = iKey.begin();
+         itChar != iKey.end(); ++itChar) {
+      oStreamId ^= static_cast<unsigned char> (*itChar);
+      oStreamId *= lPrime;
+    }
+    return oStreamId;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CounterBasedRandomGeneration::StreamId_T CounterBasedRandomGeneration::
+  generateStreamId (const StreamId_T& iStreamId, const boost::uint32_t iNumber) {
+    // Same hash, the bytes of the number being taken from the least
+    // significant one, whatever the endianness of the platform.
+    const boost::uint64_t lPrime = 0x100000001B3ull;
+    boost::uint64_t oStreamId = iStreamId;
+    for (unsigned int lShift = 0; lShift != 32; lShift += 8) {
+      oStreamId ^= ((iNumber >> lShift) & 0xFF);
+      oStreamId *= lPrime;
+    }
+    return oStreamId;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * Compute the Philox block giving the draw of the given index.
+   */
+  static void generateBlockOfDraw (const boost::uint32_t iKey[2],
+                                   const CounterBasedRandomGeneration::StreamId_T& iStreamId,
+                                   const CounterBasedRandomGeneration::DrawIndex_T& iDrawIndex,
+                                   boost::uint32_t oBlock[4]) {
+    const CounterBasedRandomGeneration::DrawIndex_T lBlockIndex = iDrawIndex >> 1;
+    const boost::uint32_t lCounter[4] = {
+      static_cast<boost::uint32_t> (lBlockIndex),
+      static_cast<boost::uint32_t> (lBlockIndex >> 32),
+      static_cast<boost::uint32_t> (iStreamId),
+      static_cast<boost::uint32_t> (iStreamId >> 32)
+    };
+    CounterBasedRandomGeneration::generateBlock (lCounter, iKey, oBlock);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::RealNumber_T CounterBasedRandomGeneration::generateUniform01() {
+    if (_hasNextUniform == true) {
+      assert ((_drawIndex & 1) != 0);
+      _hasNextUniform = false;
+      ++_drawIndex;
+      return _nextUniform;
+    }
+
+    boost::uint32_t lBlock[4];
+    generateBlockOfDraw (_key, _streamId, _drawIndex, lBlock);
+    const bool isFirstHalf = ((_drawIndex & 1) == 0);
+    ++_drawIndex;
+    if (isFirstHalf == false) {
+      return convertIntoUniform01 (lBlock[2], lBlock[3]);
+    }
+
+    // Keep the second draw of the block for the next call.
+    _nextUniform = convertIntoUniform01 (lBlock[2], lBlock[3]);
+    _hasNextUniform = true;
+    return convertIntoUniform01 (lBlock[0], lBlock[1]);
+  }
+
+  /**
+   * Signature of the kernels drawing a batch of uniform variates.
+   */
+  typedef void (*UniformKernel_T) (const boost::uint32_t iKey[2],
+                                   const CounterBasedRandomGeneration::StreamId_T*,
+                                   const CounterBasedRandomGeneration::DrawIndex_T*,
+                                   stdair::RealNumber_T*, const std::size_t);
+
+  // //////////////////////////////////////////////////////////////////////
+  static void
+  generateUniformsScalar (const boost::uint32_t iKey[2],
+                          const CounterBasedRandomGeneration::StreamId_T* iStreamIdArray,
+                          const CounterBasedRandomGeneration::DrawIndex_T* iDrawIndexArray,
+                          stdair::RealNumber_T* oUniformArray,
+                          const std::size_t iNbOfDraws) {
+    for (std::size_t idx = 0; idx < iNbOfDraws; ++idx) {
+      boost::uint32_t lBlock[4];
+      generateBlockOfDraw (iKey, iStreamIdArray[idx], iDrawIndexArray[idx],
+                           lBlock);
+      const unsigned short lHalf = 2 * (iDrawIndexArray[idx] & 1);
+      oUniformArray[idx] = convertIntoUniform01 (lBlock[lHalf],
+                                                 lBlock[lHalf + 1]);
+    }
+  }
+
+#ifdef TRADEMGEN_PHILOX_X86
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * High and low halves of the 32x32-bit products of the eight lanes
+   * by the given multiplier. The even and the odd lanes are multiplied
+   * separately, as _mm256_mul_epu32() only considers the even ones.
+   */
+  __attribute__ ((target ("avx2")))
+  static inline void multiplyAVX2 (const __m256i iMultiplier, const __m256i iWord,
+                                   __m256i& oHigh, __m256i& oLow) {
+    const __m256i lEvenProduct = _mm256_mul_epu32 (iWord, iMultiplier);
+    const __m256i lOddProduct =
+      _mm256_mul_epu32 (_mm256_srli_epi64 (iWord, 32), iMultiplier);
+    oLow = _mm256_blend_epi32 (lEvenProduct,
+                               _mm256_slli_epi64 (lOddProduct, 32), 0xAA);
+    oHigh = _mm256_blend_epi32 (_mm256_srli_epi64 (lEvenProduct, 32),
+                                lOddProduct, 0xAA);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * AVX2 version: eight Philox blocks at once, one per 32-bit lane.
+   */
+  __attribute__ ((target ("avx2")))
+  static void
+  generateUniformsAVX2 (const boost::uint32_t iKey[2],
+                        const CounterBasedRandomGeneration::StreamId_T* iStreamIdArray,
+                        const CounterBasedRandomGeneration::DrawIndex_T* iDrawIndexArray,
+                        stdair::RealNumber_T* oUniformArray,
+                        const std::size_t iNbOfDraws) {
+    const __m256i lMultiplier0 =
+      _mm256_set1_epi32 (static_cast<int> (PHILOX_MULTIPLIER_0));
+    const __m256i lMultiplier1 =
+      _mm256_set1_epi32 (static_cast<int> (PHILOX_MULTIPLIER_1));
+    const __m256i lWeyl0 = _mm256_set1_epi32 (static_cast<int> (PHILOX_WEYL_0));
+    const __m256i lWeyl1 = _mm256_set1_epi32 (static_cast<int> (PHILOX_WEYL_1));
+
+    std::size_t idx = 0;
+    for ( ; idx + 8 <= iNbOfDraws; idx += 8) {
+      // Transpose the counters, so that each vector holds one word of
+      // the eight counters.
+      boost::uint32_t lCounter[4][8];
+      for (unsigned int lLane = 0; lLane < 8; ++lLane) {
+        const CounterBasedRandomGeneration::DrawIndex_T lBlockIndex =
+          iDrawIndexArray[idx + lLane] >> 1;
+        const CounterBasedRandomGeneration::StreamId_T& lStreamId =
+          iStreamIdArray[idx + lLane];
+        lCounter[0][lLane] = static_cast<boost::uint32_t> (lBlockIndex);
+        lCounter[1][lLane] = static_cast<boost::uint32_t> (lBlockIndex >> 32);
+        lCounter[2][lLane] = static_cast<boost::uint32_t> (lStreamId);
+        lCounter[3][lLane] = static_cast<boost::uint32_t> (lStreamId >> 32);
+      }
+      __m256i c0 = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (lCounter[0]));
+      __m256i c1 = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (lCounter[1]));
+      __m256i c2 = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (lCounter[2]));
+      __m256i c3 = _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (lCounter[3]));
+      __m256i k0 = _mm256_set1_epi32 (static_cast<int> (iKey[0]));
+      __m256i k1 = _mm256_set1_epi32 (static_cast<int> (iKey[1]));
+
+      for (unsigned short lRound = 0; lRound < PHILOX_NB_OF_ROUNDS; ++lRound) {
+        __m256i lHigh0, lLow0, lHigh1, lLow1;
+        multiplyAVX2 (lMultiplier0, c0, lHigh0, lLow0);
+        multiplyAVX2 (lMultiplier1, c2, lHigh1, lLow1);
+        c0 = _mm256_xor_si256 (_mm256_xor_si256 (lHigh1, c1), k0);
+        c1 = lLow1;
+        c2 = _mm256_xor_si256 (_mm256_xor_si256 (lHigh0, c3), k1);
+        c3 = lLow0;
+        k0 = _mm256_add_epi32 (k0, lWeyl0);
+        k1 = _mm256_add_epi32 (k1, lWeyl1);
+      }
+
+      _mm256_storeu_si256 (reinterpret_cast<__m256i*> (lCounter[0]), c0);
+      _mm256_storeu_si256 (reinterpret_cast<__m256i*> (lCounter[1]), c1);
+      _mm256_storeu_si256 (reinterpret_cast<__m256i*> (lCounter[2]), c2);
+      _mm256_storeu_si256 (reinterpret_cast<__m256i*> (lCounter[3]), c3);
+      for (unsigned int lLane = 0; lLane < 8; ++lLane) {
+        const unsigned short lHalf = 2 * (iDrawIndexArray[idx + lLane] & 1);
+        oUniformArray[idx + lLane] =
+          convertIntoUniform01 (lCounter[lHalf][lLane],
+                                lCounter[lHalf + 1][lLane]);
+      }
+    }
+    // Clear the upper halves of the vector registers before leaving the
+    // AVX2 code: otherwise, the SSE code running afterwards (the scalar
+    // tail and the callers, e.g., the logarithms of the demand stream
+    // engine) pays for the AVX-SSE transitions.
+    _mm256_zeroupper();
+    generateUniformsScalar (iKey, iStreamIdArray + idx, iDrawIndexArray + idx,
+                            oUniformArray + idx, iNbOfDraws - idx);
+  }
+#endif // TRADEMGEN_PHILOX_X86
+
+  // //////////////////////////////////////////////////////////////////////
+  /**
+   * Kernel selected according to the instruction sets supported by the
+   * processor.
+   */
+  struct UniformKernel {
+    UniformKernel()
+      : _instructionSet ("scalar"), _kernel (&generateUniformsScalar) {
+#ifdef TRADEMGEN_PHILOX_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports ("avx2")) {
+        _instructionSet = "avx2";
+        _kernel = &generateUniformsAVX2;
+      }
+#endif // TRADEMGEN_PHILOX_X86
+    }
+
+    const char* _instructionSet;
+    UniformKernel_T _kernel;
+  };
+
+  // //////////////////////////////////////////////////////////////////////
+  static const UniformKernel& getUniformKernel() {
+    static const UniformKernel lKernel;
+    return lKernel;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CounterBasedRandomGeneration::
+  generateUniforms01 (const stdair::RandomSeed_T& iMasterSeed,
+                      const StreamId_T* iStreamIdArray,
+                      const DrawIndex_T* iDrawIndexArray,
+                      stdair::RealNumber_T* oUniformArray,
+                      const std::size_t iNbOfDraws) {
+    boost::uint32_t lKey[2];
+    getKey (iMasterSeed, lKey);
+    getUniformKernel()._kernel (lKey, iStreamIdArray, iDrawIndexArray,
+                                oUniformArray, iNbOfDraws);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const char* CounterBasedRandomGeneration::getInstructionSet() {
+    return getUniformKernel()._instructionSet;
+  }
+
+}
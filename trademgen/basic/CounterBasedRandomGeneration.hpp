@@ -0,0 +1,217 @@
+#ifndef __TRADEMGEN_BAS_COUNTERBASEDRANDOMGENERATION_HPP
+#define __TRADEMGEN_BAS_COUNTERBASEDRANDOMGENERATION_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cstddef>
+#include <string>
+// Boost
+#include <boost/cstdint.hpp>
+// StdAir
+#include <stdair/stdair_maths_types.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Counter-based random generator (Philox4x32-10, as described
+   * by J. K. Salmon et al.).
+   *
+   * The i-th draw is a pure function of the master seed (used as the
+   * Philox key), of the stream identifier and of the draw index i
+   * (together used as the Philox counter). Hence, the generator only
+   * stores those three numbers; it can be moved to any draw index in
+   * constant time, and its draws do not depend on the order in which
+   * the streams are created, nor on the thread drawing them.
+   *
+   * Each Philox block gives two draws, from its first two and from
+   * its last two words: the draw of index i is given by the block of
+   * counter i / 2. The second draw of the last block is kept, so that
+   * a block is computed only once when the draws follow each other.
+   *
+   * The draw indexes of a stream are split into NB_OF_SUB_STREAMS
+   * ranges, so that a single stream identifier gives as many
+   * independent sub-streams (see getFirstDrawIndex()).
+   */
+  class CounterBasedRandomGeneration {
+  public:
+    // ///////////// Type definitions //////////////
+    /**
+     * Stream identifier.
+     */
+    typedef boost::uint64_t StreamId_T;
+
+    /**
+     * Draw index.
+     */
+    typedef boost::uint64_t DrawIndex_T;
+
+    /**
+     * Number of sub-streams of a stream.
+     */
+    static const unsigned int NB_OF_SUB_STREAMS = 4;
+
+
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Draw a uniform variate within [0, 1), and move to the next draw
+     * index.
+     */
+    stdair::RealNumber_T generateUniform01();
+
+    /**
+     * Draw a uniform variate within [0, 1) (same as generateUniform01()).
+     */
+    stdair::RealNumber_T operator()() {
+      return generateUniform01();
+    }
+
+    /**
+     * Skip the given number of draws.
+     */
+    void discard (const DrawIndex_T& iNbOfDraws) {
+      setDrawIndex (_drawIndex + iNbOfDraws);
+    }
+
+    /**
+     * Compute the Philox4x32-10 block for the given counter and key.
+     */
+    static void generateBlock (const boost::uint32_t iCounter[4],
+                               const boost::uint32_t iKey[2],
+                               boost::uint32_t oBlock[4]);
+
+    /**
+     * Compute a stream identifier from a (demand row) key.
+     */
+    static StreamId_T generateStreamId (const std::string& iKey);
+
+    /**
+     * Compute the stream identifier of a member (e.g., a preferred
+     * departure date) of the stream of the given identifier (e.g., a
+     * demand row), by going on hashing with the given number.
+     */
+    static StreamId_T generateStreamId (const StreamId_T& iStreamId,
+                                        const boost::uint32_t iNumber);
+
+    /**
+     * Get the index of the first draw of the given sub-stream (the
+     * sub-streams are 2^62 draws apart).
+     */
+    static DrawIndex_T getFirstDrawIndex (const unsigned int iSubStream) {
+      assert (iSubStream < NB_OF_SUB_STREAMS);
+      return static_cast<DrawIndex_T> (iSubStream) << 62;
+    }
+
+    /**
+     * Draw, for each (stream identifier, draw index) pair, the uniform
+     * variate which a generator of that stream would draw at that draw
+     * index. The Philox blocks are computed several streams at once,
+     * with the SIMD instructions supported by the processor, if any;
+     * the results do not depend on them.
+     */
+    static void generateUniforms01 (const stdair::RandomSeed_T& iMasterSeed,
+                                    const StreamId_T* iStreamIdArray,
+                                    const DrawIndex_T* iDrawIndexArray,
+                                    stdair::RealNumber_T* oUniformArray,
+                                    const std::size_t iNbOfDraws);
+
+    /**
+     * Get the name of the instruction set used by generateUniforms01()
+     * ("avx2" or "scalar").
+     */
+    static const char* getInstructionSet();
+
+
+  public:
+    // ////////// Getters /////////
+    /**
+     * Get the master seed.
+     */
+    const stdair::RandomSeed_T getMasterSeed() const;
+
+    /**
+     * Get the stream identifier.
+     */
+    const StreamId_T& getStreamId() const {
+      return _streamId;
+    }
+
+    /**
+     * Get the index of the next draw.
+     */
+    const DrawIndex_T& getDrawIndex() const {
+      return _drawIndex;
+    }
+
+
+  public:
+    // ////////// Setters /////////
+    /**
+     * (Re-)initialise the generator, from its first draw.
+     */
+    void init (const stdair::RandomSeed_T& iMasterSeed,
+               const StreamId_T& iStreamId,
+               const DrawIndex_T& iDrawIndex = 0);
+
+    /**
+     * Move to the given draw index.
+     */
+    void setDrawIndex (const DrawIndex_T& iDrawIndex) {
+      _drawIndex = iDrawIndex;
+      _hasNextUniform = false;
+    }
+
+
+  public:
+    // ////////// Display support methods /////////
+    /**
+     * Display of the structure.
+     */
+    const std::string describe() const;
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Default constructor (null master seed and stream identifier).
+     */
+    CounterBasedRandomGeneration();
+
+    /**
+     * Constructor.
+     */
+    CounterBasedRandomGeneration (const stdair::RandomSeed_T& iMasterSeed,
+                                  const StreamId_T& iStreamId,
+                                  const DrawIndex_T& iDrawIndex = 0);
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Philox key (master seed).
+     */
+    boost::uint32_t _key[2];
+
+    /**
+     * Stream identifier (upper half of the Philox counter).
+     */
+    StreamId_T _streamId;
+
+    /**
+     * Index of the next draw (twice the lower half of the Philox
+     * counter, plus the half of the block).
+     */
+    DrawIndex_T _drawIndex;
+
+    /**
+     * Second draw of the last block, when the next draw is that one.
+     */
+    stdair::RealNumber_T _nextUniform;
+    bool _hasNextUniform;
+  };
+
+}
+#endif // __TRADEMGEN_BAS_COUNTERBASEDRANDOMGENERATION_HPP
@@ -4,13 +4,29 @@
 // STL
 #include <cassert>
 #include <sstream>
+// Boost
+#include <boost/functional/hash.hpp>
 // StdAir
 #include <stdair/stdair_basic_types.hpp>
 // TraDemGen
 #include <trademgen/basic/BasConst_DemandGeneration.hpp>
 #include <trademgen/basic/DemandCharacteristics.hpp>
+#include <trademgen/basic/JointCharacteristicsTable.hpp>
 
 namespace TRADEMGEN {
+
+  /** Position of the categorical characteristics within the tuples of
+      the joint alias table. */
+  enum EN_JointCharacteristicsFactor {
+    POS_FACTOR = 0,
+    CHANNEL_FACTOR,
+    TRIP_TYPE_FACTOR,
+    STAY_DURATION_FACTOR,
+    FREQUENT_FLYER_FACTOR,
+    CHANGE_FEES_FACTOR,
+    NON_REFUNDABLE_FACTOR,
+    LAST_VALUE_FACTOR
+  };
   
   // /////////////////////////////////////////////////////
   DemandCharacteristics::DemandCharacteristics()
@@ -25,6 +41,7 @@ namespace TRADEMGEN {
       _preferredDepartureTimeCumulativeDistribution (PreferredDepartureTimeContinuousDistribution_T()),
       _minWTP (stdair::WTP_T()), _frat5Pattern (DEFAULT_FRAT5_PATTERN),
       _valueOfTimeCumulativeDistribution (ValueOfTimeContinuousDistribution_T()) {
+    chooseCategoricalSampling (DEFAULT_ALIAS_SAMPLING_MIN_SIZE);
   }
 
   // /////////////////////////////////////////////////////
@@ -42,7 +59,13 @@ namespace TRADEMGEN {
       _nonRefundableDisutility (iDC._nonRefundableDisutility),
       _preferredDepartureTimeCumulativeDistribution (iDC._preferredDepartureTimeCumulativeDistribution),
       _minWTP (iDC._minWTP), _frat5Pattern (iDC._frat5Pattern),
-      _valueOfTimeCumulativeDistribution (iDC._valueOfTimeCumulativeDistribution) {
+      _valueOfTimeCumulativeDistribution (iDC._valueOfTimeCumulativeDistribution),
+      _isPOSAliasSampled (iDC._isPOSAliasSampled),
+      _isChannelAliasSampled (iDC._isChannelAliasSampled),
+      _isTripTypeAliasSampled (iDC._isTripTypeAliasSampled),
+      _isStayDurationAliasSampled (iDC._isStayDurationAliasSampled),
+      _isFrequentFlyerAliasSampled (iDC._isFrequentFlyerAliasSampled),
+      _jointCharacteristicsTable (iDC._jointCharacteristicsTable) {
   }
 
   // /////////////////////////////////////////////////////
@@ -73,6 +96,7 @@ namespace TRADEMGEN {
       _preferredDepartureTimeCumulativeDistribution (iPreferredDepartureTimeContinuousDistribution),
       _minWTP (iMinWTP), _frat5Pattern (DEFAULT_FRAT5_PATTERN),
       _valueOfTimeCumulativeDistribution (iValueOfTimeContinuousDistribution) {
+    chooseCategoricalSampling (DEFAULT_ALIAS_SAMPLING_MIN_SIZE);
   }
     
   // /////////////////////////////////////////////////////
@@ -82,6 +106,9 @@ namespace TRADEMGEN {
   // /////////////////////////////////////////////////////
   const stdair::AirportCode_T& DemandCharacteristics::
   getPOSValue (const stdair::Probability_T& iCumulativeProbability) const {
+    if (_isPOSAliasSampled == true) {
+      return _posProbabilityMass.getValueByAlias (iCumulativeProbability);
+    }
     return _posProbabilityMass.getValue (iCumulativeProbability);
   }
 
@@ -91,6 +118,253 @@ namespace TRADEMGEN {
     return _posProbabilityMass.checkValue (iPOS);
   }
 
+  // /////////////////////////////////////////////////////
+  const stdair::ChannelLabel_T& DemandCharacteristics::
+  getChannelValue (const stdair::Probability_T& iVariate) const {
+    if (_isChannelAliasSampled == true) {
+      return _channelProbabilityMass.getValueByAlias (iVariate);
+    }
+    return _channelProbabilityMass.getValue (iVariate);
+  }
+
+  // /////////////////////////////////////////////////////
+  const stdair::TripType_T& DemandCharacteristics::
+  getTripTypeValue (const stdair::Probability_T& iVariate) const {
+    if (_isTripTypeAliasSampled == true) {
+      return _tripTypeProbabilityMass.getValueByAlias (iVariate);
+    }
+    return _tripTypeProbabilityMass.getValue (iVariate);
+  }
+
+  // /////////////////////////////////////////////////////
+  const stdair::DayDuration_T& DemandCharacteristics::
+  getStayDurationValue (const stdair::Probability_T& iVariate) const {
+    if (_isStayDurationAliasSampled == true) {
+      return _stayDurationProbabilityMass.getValueByAlias (iVariate);
+    }
+    return _stayDurationProbabilityMass.getValue (iVariate);
+  }
+
+  // /////////////////////////////////////////////////////
+  const stdair::FrequentFlyer_T& DemandCharacteristics::
+  getFrequentFlyerValue (const stdair::Probability_T& iVariate) const {
+    if (_isFrequentFlyerAliasSampled == true) {
+      return _frequentFlyerProbabilityMass.getValueByAlias (iVariate);
+    }
+    return _frequentFlyerProbabilityMass.getValue (iVariate);
+  }
+
+  // /////////////////////////////////////////////////////
+  const Code_T& DemandCharacteristics::
+  getPOSCode (const stdair::Probability_T& iCumulativeProbability) const {
+    if (_isPOSAliasSampled == true) {
+      return _posProbabilityMass.getStoredValueByAlias (iCumulativeProbability);
+    }
+    return _posProbabilityMass.getStoredValue (iCumulativeProbability);
+  }
+
+  // /////////////////////////////////////////////////////
+  const Code_T& DemandCharacteristics::
+  getChannelCode (const stdair::Probability_T& iVariate) const {
+    if (_isChannelAliasSampled == true) {
+      return _channelProbabilityMass.getStoredValueByAlias (iVariate);
+    }
+    return _channelProbabilityMass.getStoredValue (iVariate);
+  }
+
+  // /////////////////////////////////////////////////////
+  const Code_T& DemandCharacteristics::
+  getTripTypeCode (const stdair::Probability_T& iVariate) const {
+    if (_isTripTypeAliasSampled == true) {
+      return _tripTypeProbabilityMass.getStoredValueByAlias (iVariate);
+    }
+    return _tripTypeProbabilityMass.getStoredValue (iVariate);
+  }
+
+  // /////////////////////////////////////////////////////
+  const Code_T& DemandCharacteristics::
+  getFrequentFlyerCode (const stdair::Probability_T& iVariate) const {
+    if (_isFrequentFlyerAliasSampled == true) {
+      return _frequentFlyerProbabilityMass.getStoredValueByAlias (iVariate);
+    }
+    return _frequentFlyerProbabilityMass.getStoredValue (iVariate);
+  }
+
+  // /////////////////////////////////////////////////////
+  void DemandCharacteristics::
+  chooseCategoricalSampling (const unsigned int iMinSizeForAlias) {
+    // For short tables, the linear walk over the cumulative
+    // distribution is as fast as the alias method, and it keeps the
+    // draws monotonic with respect to the variates.
+    _isPOSAliasSampled =
+      (_posProbabilityMass.getSize() >= iMinSizeForAlias);
+    _isChannelAliasSampled =
+      (_channelProbabilityMass.getSize() >= iMinSizeForAlias);
+    _isTripTypeAliasSampled =
+      (_tripTypeProbabilityMass.getSize() >= iMinSizeForAlias);
+    _isStayDurationAliasSampled =
+      (_stayDurationProbabilityMass.getSize() >= iMinSizeForAlias);
+    _isFrequentFlyerAliasSampled =
+      (_frequentFlyerProbabilityMass.getSize() >= iMinSizeForAlias);
+  }
+
+  // /////////////////////////////////////////////////////
+  /** Probability masses of the "false" and "true" outcomes, when
+      "true" is drawn for variates below the given probability. */
+  static AliasTable::MassArray_T
+  getBernoulliMassArray (const stdair::Probability_T& iProbability) {
+    AliasTable::MassArray_T oMassArray (2, 0.0);
+    if (iProbability <= 0.0) {
+      oMassArray[0] = 1.0;
+    } else if (iProbability >= 1.0) {
+      oMassArray[1] = 1.0;
+    } else {
+      oMassArray[0] = 1.0 - iProbability;
+      oMassArray[1] = iProbability;
+    }
+    return oMassArray;
+  }
+
+  // /////////////////////////////////////////////////////
+  bool DemandCharacteristics::
+  setJointCharacteristicsSampling (const bool iIsJointSampled) {
+    _jointCharacteristicsTable.reset();
+    if (iIsJointSampled == false) {
+      return false;
+    }
+
+    JointCharacteristicsTable::MassArrayList_T lMassArrayList (LAST_VALUE_FACTOR);
+    lMassArrayList[POS_FACTOR] =
+      _posProbabilityMass.getProbabilityMassArray();
+    lMassArrayList[CHANNEL_FACTOR] =
+      _channelProbabilityMass.getProbabilityMassArray();
+    lMassArrayList[TRIP_TYPE_FACTOR] =
+      _tripTypeProbabilityMass.getProbabilityMassArray();
+    lMassArrayList[STAY_DURATION_FACTOR] =
+      _stayDurationProbabilityMass.getProbabilityMassArray();
+    lMassArrayList[FREQUENT_FLYER_FACTOR] =
+      _frequentFlyerProbabilityMass.getProbabilityMassArray();
+    lMassArrayList[CHANGE_FEES_FACTOR] =
+      getBernoulliMassArray (_changeFeeProb);
+    lMassArrayList[NON_REFUNDABLE_FACTOR] =
+      getBernoulliMassArray (_nonRefundableProb);
+
+    boost::shared_ptr<JointCharacteristicsTable> lJointTable_ptr (new JointCharacteristicsTable());
+    const bool isBuilt =
+      lJointTable_ptr->init (lMassArrayList,
+                             DEFAULT_JOINT_CHARACTERISTICS_TABLE_MAX_SIZE);
+    if (isBuilt == true) {
+      _jointCharacteristicsTable = lJointTable_ptr;
+    }
+    return isBuilt;
+  }
+
+  // /////////////////////////////////////////////////////
+  void DemandCharacteristics::
+  getJointCharacteristics (const stdair::Probability_T& iVariate,
+                           stdair::AirportCode_T& oPOS,
+                           stdair::ChannelLabel_T& oChannelLabel,
+                           stdair::TripType_T& oTripType,
+                           stdair::DayDuration_T& oStayDuration,
+                           stdair::FrequentFlyer_T& oFrequentFlyer,
+                           stdair::ChangeFees_T& oChangeFees,
+                           stdair::NonRefundable_T& oNonRefundable) const {
+    Code_T lPOSCode, lChannelCode, lTripTypeCode, lFrequentFlyerCode;
+    getJointCharacteristicCodes (iVariate, lPOSCode, lChannelCode,
+                                 lTripTypeCode, oStayDuration,
+                                 lFrequentFlyerCode, oChangeFees,
+                                 oNonRefundable);
+
+    const CodePool& lCodePool = CodePool::instance();
+    oPOS = lCodePool.getString (lPOSCode);
+    oChannelLabel = lCodePool.getString (lChannelCode);
+    oTripType = lCodePool.getString (lTripTypeCode);
+    oFrequentFlyer = lCodePool.getString (lFrequentFlyerCode);
+  }
+
+  // /////////////////////////////////////////////////////
+  void DemandCharacteristics::
+  getJointCharacteristicCodes (const stdair::Probability_T& iVariate,
+                               Code_T& oPOSCode, Code_T& oChannelCode,
+                               Code_T& oTripTypeCode,
+                               stdair::DayDuration_T& oStayDuration,
+                               Code_T& oFrequentFlyerCode,
+                               stdair::ChangeFees_T& oChangeFees,
+                               stdair::NonRefundable_T& oNonRefundable) const {
+    assert (_jointCharacteristicsTable != NULL);
+    const JointCharacteristicsTable& lJointTable = *_jointCharacteristicsTable;
+
+    const unsigned int idx = lJointTable.getIndex (iVariate);
+    oPOSCode = _posProbabilityMass.
+      getStoredValueAt (lJointTable.getFactorIndex (idx, POS_FACTOR));
+    oChannelCode = _channelProbabilityMass.
+      getStoredValueAt (lJointTable.getFactorIndex (idx, CHANNEL_FACTOR));
+    oTripTypeCode = _tripTypeProbabilityMass.
+      getStoredValueAt (lJointTable.getFactorIndex (idx, TRIP_TYPE_FACTOR));
+    oStayDuration = _stayDurationProbabilityMass.
+      getValueAt (lJointTable.getFactorIndex (idx, STAY_DURATION_FACTOR));
+    oFrequentFlyerCode = _frequentFlyerProbabilityMass.
+      getStoredValueAt (lJointTable.getFactorIndex (idx, FREQUENT_FLYER_FACTOR));
+    oChangeFees =
+      (lJointTable.getFactorIndex (idx, CHANGE_FEES_FACTOR) == 1);
+    oNonRefundable =
+      (lJointTable.getFactorIndex (idx, NON_REFUNDABLE_FACTOR) == 1);
+  }
+
+  // /////////////////////////////////////////////////////
+  std::size_t DemandCharacteristics::getHashValue() const {
+    std::size_t oHashValue = _arrivalPattern.getHashValue();
+    boost::hash_combine (oHashValue, _posProbabilityMass.getHashValue());
+    boost::hash_combine (oHashValue, _channelProbabilityMass.getHashValue());
+    boost::hash_combine (oHashValue, _tripTypeProbabilityMass.getHashValue());
+    boost::hash_combine (oHashValue,
+                         _stayDurationProbabilityMass.getHashValue());
+    boost::hash_combine (oHashValue,
+                         _frequentFlyerProbabilityMass.getHashValue());
+    boost::hash_combine (oHashValue, _changeFeeProb);
+    boost::hash_combine (oHashValue, _changeFeeDisutility);
+    boost::hash_combine (oHashValue, _nonRefundableProb);
+    boost::hash_combine (oHashValue, _nonRefundableDisutility);
+    boost::hash_combine (oHashValue,
+                         _preferredDepartureTimeCumulativeDistribution.getHashValue());
+    boost::hash_combine (oHashValue, _minWTP);
+    boost::hash_combine (oHashValue, _frat5Pattern.getHashValue());
+    boost::hash_combine (oHashValue,
+                         _valueOfTimeCumulativeDistribution.getHashValue());
+    boost::hash_combine (oHashValue, isJointCharacteristicsSampled());
+    return oHashValue;
+  }
+
+  // /////////////////////////////////////////////////////
+  bool DemandCharacteristics::
+  operator== (const DemandCharacteristics& iDC) const {
+    // The alias flags and the joint alias table derive from the
+    // distributions; only whether the joint sampling is on matters.
+    return (_arrivalPattern == iDC._arrivalPattern
+            && _posProbabilityMass == iDC._posProbabilityMass
+            && _channelProbabilityMass == iDC._channelProbabilityMass
+            && _tripTypeProbabilityMass == iDC._tripTypeProbabilityMass
+            && _stayDurationProbabilityMass == iDC._stayDurationProbabilityMass
+            && _frequentFlyerProbabilityMass == iDC._frequentFlyerProbabilityMass
+            && _changeFeeProb == iDC._changeFeeProb
+            && _changeFeeDisutility == iDC._changeFeeDisutility
+            && _nonRefundableProb == iDC._nonRefundableProb
+            && _nonRefundableDisutility == iDC._nonRefundableDisutility
+            && _preferredDepartureTimeCumulativeDistribution
+            == iDC._preferredDepartureTimeCumulativeDistribution
+            && _minWTP == iDC._minWTP
+            && _frat5Pattern == iDC._frat5Pattern
+            && _valueOfTimeCumulativeDistribution
+            == iDC._valueOfTimeCumulativeDistribution
+            && _isPOSAliasSampled == iDC._isPOSAliasSampled
+            && _isChannelAliasSampled == iDC._isChannelAliasSampled
+            && _isTripTypeAliasSampled == iDC._isTripTypeAliasSampled
+            && _isStayDurationAliasSampled == iDC._isStayDurationAliasSampled
+            && _isFrequentFlyerAliasSampled == iDC._isFrequentFlyerAliasSampled
+            && isJointCharacteristicsSampled()
+            == iDC.isJointCharacteristicsSampled());
+  }
+
   // /////////////////////////////////////////////////////
   const std::string DemandCharacteristics::describe() const {
     std::ostringstream oStr;
@@ -5,12 +5,14 @@
 // Import section
 // //////////////////////////////////////////////////////////////////////
 // STL
+#include <cstddef>
 #include <string>
 // StdAir
 #include <stdair/stdair_basic_types.hpp>
 #include <stdair/stdair_date_time_types.hpp>
 #include <stdair/basic/StructAbstract.hpp>
 // TraDemGen
+#include <trademgen/basic/CodePool.hpp>
 #include <trademgen/basic/DemandCharacteristicsTypes.hpp>
 
 namespace TRADEMGEN {
@@ -33,6 +35,122 @@ namespace TRADEMGEN {
      */
     bool checkPOSValue (const stdair::AirportCode_T& iPOS) const;
 
+    /**
+     * Get the channel corresponding to the uniform variate.
+     */
+    const stdair::ChannelLabel_T&
+    getChannelValue (const stdair::Probability_T& iVariate) const;
+
+    /**
+     * Get the trip type corresponding to the uniform variate.
+     */
+    const stdair::TripType_T&
+    getTripTypeValue (const stdair::Probability_T& iVariate) const;
+
+    /**
+     * Get the stay duration corresponding to the uniform variate.
+     */
+    const stdair::DayDuration_T&
+    getStayDurationValue (const stdair::Probability_T& iVariate) const;
+
+    /**
+     * Get the frequent flyer tier corresponding to the uniform variate.
+     */
+    const stdair::FrequentFlyer_T&
+    getFrequentFlyerValue (const stdair::Probability_T& iVariate) const;
+
+    /**
+     * Get the code (within the CodePool) of the POS corresponding to
+     * the cumulative probability.
+     */
+    const Code_T&
+    getPOSCode (const stdair::Probability_T& iCumulativeProbability) const;
+
+    /**
+     * Get the code of the channel corresponding to the uniform variate.
+     */
+    const Code_T& getChannelCode (const stdair::Probability_T& iVariate) const;
+
+    /**
+     * Get the code of the trip type corresponding to the uniform variate.
+     */
+    const Code_T&
+    getTripTypeCode (const stdair::Probability_T& iVariate) const;
+
+    /**
+     * Get the code of the frequent flyer tier corresponding to the
+     * uniform variate.
+     */
+    const Code_T&
+    getFrequentFlyerCode (const stdair::Probability_T& iVariate) const;
+
+    /**
+     * Choose, for each categorical attribute, how the values are drawn:
+     * thanks to the alias table when the attribute has at least the
+     * given number of values, and with the inverse cumulative
+     * distribution otherwise.
+     */
+    void chooseCategoricalSampling (const unsigned int iMinSizeForAlias);
+
+    /**
+     * State whether the categorical characteristics (POS, channel, trip
+     * type, stay duration, frequent flyer tier, change fee and non
+     * refundable acceptations) are drawn all at once, from a joint
+     * alias table.
+     */
+    bool isJointCharacteristicsSampled() const {
+      return (_jointCharacteristicsTable != NULL);
+    }
+
+    /**
+     * Switch on or off the joint sampling of the categorical
+     * characteristics. Switching it on builds the joint alias table over
+     * the Cartesian product of those characteristics; that is not done
+     * when the product has more than
+     * DEFAULT_JOINT_CHARACTERISTICS_TABLE_MAX_SIZE tuples.
+     *
+     * @return bool Whether the joint sampling is on.
+     */
+    bool setJointCharacteristicsSampling (const bool iIsJointSampled);
+
+    /**
+     * Get the categorical characteristics corresponding to the uniform
+     * variate, thanks to the joint alias table.
+     */
+    void getJointCharacteristics (const stdair::Probability_T& iVariate,
+                                  stdair::AirportCode_T& oPOS,
+                                  stdair::ChannelLabel_T& oChannelLabel,
+                                  stdair::TripType_T& oTripType,
+                                  stdair::DayDuration_T& oStayDuration,
+                                  stdair::FrequentFlyer_T& oFrequentFlyer,
+                                  stdair::ChangeFees_T& oChangeFees,
+                                  stdair::NonRefundable_T& oNonRefundable) const;
+
+    /**
+     * Same as getJointCharacteristics(), but with the codes (within the
+     * CodePool) of the POS, channel, trip type and frequent flyer tier.
+     */
+    void getJointCharacteristicCodes (const stdair::Probability_T& iVariate,
+                                      Code_T& oPOSCode,
+                                      Code_T& oChannelCode,
+                                      Code_T& oTripTypeCode,
+                                      stdair::DayDuration_T& oStayDuration,
+                                      Code_T& oFrequentFlyerCode,
+                                      stdair::ChangeFees_T& oChangeFees,
+                                      stdair::NonRefundable_T& oNonRefundable) const;
+
+    /**
+     * Get the hash value of the demand characteristics (see
+     * DemandCharacteristicsPool).
+     */
+    std::size_t getHashValue() const;
+
+    /**
+     * Equality operator (same distributions and parameters, and same
+     * sampling methods).
+     */
+    bool operator== (const DemandCharacteristics&) const;
+
 
   public:
     // ////////////// Display support methods //////////
@@ -151,6 +269,37 @@ namespace TRADEMGEN {
      * Value of time cumulative distribution.
      */
     ValueOfTimeCumulativeDistribution_T _valueOfTimeCumulativeDistribution;
+
+    /**
+     * Whether the POS is drawn thanks to the alias table.
+     */
+    bool _isPOSAliasSampled;
+
+    /**
+     * Whether the channel is drawn thanks to the alias table.
+     */
+    bool _isChannelAliasSampled;
+
+    /**
+     * Whether the trip type is drawn thanks to the alias table.
+     */
+    bool _isTripTypeAliasSampled;
+
+    /**
+     * Whether the stay duration is drawn thanks to the alias table.
+     */
+    bool _isStayDurationAliasSampled;
+
+    /**
+     * Whether the frequent flyer tier is drawn thanks to the alias table.
+     */
+    bool _isFrequentFlyerAliasSampled;
+
+    /**
+     * Joint alias table of the categorical characteristics (NULL when
+     * those characteristics are drawn one by one).
+     */
+    JointCharacteristicsTablePtr_T _jointCharacteristicsTable;
   };
 
 }
@@ -0,0 +1,99 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <algorithm>
+#include <cassert>
+// TraDemGen
+#include <trademgen/basic/DemandCharacteristics.hpp>
+#include <trademgen/basic/DemandCharacteristicsPool.hpp>
+
+namespace TRADEMGEN {
+
+  // /////////////////////////////////////////////////////
+  const unsigned int DemandCharacteristicsPool::SWEEP_THRESHOLD;
+
+  // /////////////////////////////////////////////////////
+  DemandCharacteristicsPool::DemandCharacteristicsPool()
+    : _sweepThreshold (SWEEP_THRESHOLD) {
+  }
+
+  // /////////////////////////////////////////////////////
+  DemandCharacteristicsPool::~DemandCharacteristicsPool() {
+  }
+
+  // /////////////////////////////////////////////////////
+  DemandCharacteristicsPool& DemandCharacteristicsPool::instance() {
+    static DemandCharacteristicsPool lDemandCharacteristicsPool;
+    return lDemandCharacteristicsPool;
+  }
+
+  // /////////////////////////////////////////////////////
+  DemandCharacteristicsPtr_T DemandCharacteristicsPool::
+  intern (const DemandCharacteristics& iDemandCharacteristics) {
+    const std::size_t lHashValue = iDemandCharacteristics.getHashValue();
+    const std::lock_guard<std::mutex> lGuard (_mutex);
+
+    // Browse the candidates of the same hash value, forgetting on the
+    // way about those which are no longer used.
+    DemandCharacteristicsMap_T::iterator itDC =
+      _demandCharacteristicsMap.lower_bound (lHashValue);
+    while (itDC != _demandCharacteristicsMap.end()
+           && itDC->first == lHashValue) {
+      const DemandCharacteristicsPtr_T lDemandCharacteristics_ptr =
+        itDC->second.lock();
+      if (lDemandCharacteristics_ptr == NULL) {
+        _demandCharacteristicsMap.erase (itDC++);
+        continue;
+      }
+
+      if (*lDemandCharacteristics_ptr == iDemandCharacteristics) {
+        return lDemandCharacteristics_ptr;
+      }
+      ++itDC;
+    }
+
+    // Sweep away the entries of all the released characteristics,
+    // once the pool has doubled since the last sweep
+    if (_demandCharacteristicsMap.size() >= _sweepThreshold) {
+      for (itDC = _demandCharacteristicsMap.begin();
+           itDC != _demandCharacteristicsMap.end(); ) {
+        if (itDC->second.expired() == true) {
+          _demandCharacteristicsMap.erase (itDC++);
+        } else {
+          ++itDC;
+        }
+      }
+      _sweepThreshold = std::max<std::size_t> (2 * _demandCharacteristicsMap.size(),
+                                               SWEEP_THRESHOLD);
+    }
+
+    const DemandCharacteristicsPtr_T oDemandCharacteristics_ptr (new DemandCharacteristics (iDemandCharacteristics));
+    assert (oDemandCharacteristics_ptr != NULL);
+    _demandCharacteristicsMap.insert (DemandCharacteristicsMap_T::
+                                      value_type (lHashValue,
+                                                  oDemandCharacteristics_ptr));
+    return oDemandCharacteristics_ptr;
+  }
+
+  // /////////////////////////////////////////////////////
+  unsigned int DemandCharacteristicsPool::getSize() const {
+    const std::lock_guard<std::mutex> lGuard (_mutex);
+    unsigned int oSize = 0;
+    for (DemandCharacteristicsMap_T::const_iterator itDC =
+           _demandCharacteristicsMap.begin();
+         itDC != _demandCharacteristicsMap.end(); ++itDC) {
+      if (itDC->second.expired() == false) {
+        ++oSize;
+      }
+    }
+    return oSize;
+  }
+
+  // /////////////////////////////////////////////////////
+  unsigned int DemandCharacteristicsPool::getNbOfEntries() const {
+    const std::lock_guard<std::mutex> lGuard (_mutex);
+    return _demandCharacteristicsMap.size();
+  }
+
+}
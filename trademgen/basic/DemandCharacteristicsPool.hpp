@@ -0,0 +1,124 @@
+#ifndef __TRADEMGEN_BAS_DEMANDCHARACTERISTICSPOOL_HPP
+#define __TRADEMGEN_BAS_DEMANDCHARACTERISTICSPOOL_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cstddef>
+#include <map>
+#include <mutex>
+// Boost
+#include <boost/weak_ptr.hpp>
+// TraDemGen
+#include <trademgen/basic/DemandCharacteristicsTypes.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Pool of the (immutable) demand characteristics, shared by
+   * the demand streams.
+   *
+   * A demand row usually gives birth to one demand stream per active
+   * departure date, all of them with the very same characteristics.
+   * The pool hands out a single, reference-counted, instance for all
+   * the equal characteristics (hash-consing): the characteristics are
+   * looked up by their hash value, and then compared with the
+   * candidates of the same hash value.
+   *
+   * The pool does not own the characteristics: they are released as
+   * soon as the last demand stream referring to them is. The entries
+   * of the released characteristics are swept away whenever the pool
+   * has doubled since the last sweep, so that the pool stays within
+   * twice the number of characteristics in use (or SWEEP_THRESHOLD).
+   *
+   * The pool is shared by all the TraDemGen services of the process:
+   * the interning is serialised, so that several services may load
+   * their demand at once. The shared characteristics are immutable,
+   * and may thus be read by several threads without any lock.
+   */
+  class DemandCharacteristicsPool {
+  public:
+    // ///////////// Type definitions //////////////
+    /**
+     * Minimum number of entries before the entries of the released
+     * characteristics are swept away.
+     */
+    static const unsigned int SWEEP_THRESHOLD = 64;
+
+
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Get the shared instance equal to the given demand
+     * characteristics, creating it (as a copy) when there is none yet.
+     */
+    DemandCharacteristicsPtr_T
+    intern (const DemandCharacteristics& iDemandCharacteristics);
+
+    /**
+     * Get the number of distinct demand characteristics still in use.
+     */
+    unsigned int getSize() const;
+
+    /**
+     * Get the number of entries of the pool, including the ones of the
+     * characteristics released since the last sweep.
+     */
+    unsigned int getNbOfEntries() const;
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Get the pool shared by all the demand streams.
+     */
+    static DemandCharacteristicsPool& instance();
+
+  private:
+    /**
+     * Default constructor.
+     */
+    DemandCharacteristicsPool();
+
+    /**
+     * Copy constructor (not implemented).
+     */
+    DemandCharacteristicsPool (const DemandCharacteristicsPool&);
+
+    /**
+     * Destructor.
+     */
+    ~DemandCharacteristicsPool();
+
+
+  private:
+    // ///////////// Type definitions //////////////
+    /**
+     * Type for the demand characteristics, indexed by their hash value.
+     */
+    typedef std::multimap<std::size_t,
+                          boost::weak_ptr<const DemandCharacteristics> > DemandCharacteristicsMap_T;
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Demand characteristics, indexed by their hash value.
+     */
+    DemandCharacteristicsMap_T _demandCharacteristicsMap;
+
+    /**
+     * Number of entries from which the entries of the released
+     * characteristics are swept away.
+     */
+    std::size_t _sweepThreshold;
+
+    /**
+     * Guard of the demand characteristics map.
+     */
+    mutable std::mutex _mutex;
+  };
+
+}
+#endif // __TRADEMGEN_BAS_DEMANDCHARACTERISTICSPOOL_HPP
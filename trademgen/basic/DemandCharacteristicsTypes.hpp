@@ -4,19 +4,25 @@
 // //////////////////////////////////////////////////////////////////////
 // Import section
 // //////////////////////////////////////////////////////////////////////
+// Boost
+#include <boost/shared_ptr.hpp>
 // StdAir
 #include <stdair/stdair_basic_types.hpp>
 #include <stdair/stdair_date_time_types.hpp>
 #include <stdair/stdair_demand_types.hpp>
 // TraDemGen
-#include <trademgen/basic/ContinuousAttributeLite.hpp>
+#include <trademgen/basic/IndexedContinuousAttributeLite.hpp>
 #include <trademgen/basic/CategoricalAttributeLite.hpp>
 
 namespace TRADEMGEN {
 
+  // Forward declarations
+  struct DemandCharacteristics;
+  class JointCharacteristicsTable;
+
   /** Type definition for the continuous distribition of the duration
       (as a float number). */
-  typedef ContinuousAttributeLite<stdair::FloatDuration_T> ContinuousFloatDuration_T;
+  typedef IndexedContinuousAttributeLite<stdair::FloatDuration_T> ContinuousFloatDuration_T;
    
   /** Type definition for the arrival pattern cumulative distribution. */
   typedef ContinuousFloatDuration_T::ContinuousDistribution_T ArrivalPatternCumulativeDistribution_T;
@@ -52,19 +58,25 @@ namespace TRADEMGEN {
   typedef FrequentFlyerProbabilityMass_T::ProbabilityMassFunction_T FrequentFlyerProbabilityMassFunction_T;
 
   /** Define the preferred departure time cumulative distribution. */
-  typedef ContinuousAttributeLite<stdair::IntDuration_T> PreferredDepartureTimeCumulativeDistribution_T;
+  typedef IndexedContinuousAttributeLite<stdair::IntDuration_T> PreferredDepartureTimeCumulativeDistribution_T;
 
   /** Define the preferred departure time continuous distribution. */
   typedef PreferredDepartureTimeCumulativeDistribution_T::ContinuousDistribution_T PreferredDepartureTimeContinuousDistribution_T;
 
   /** Define the value of time cumulative distribution. */
-  typedef ContinuousAttributeLite<stdair::PriceValue_T> ValueOfTimeCumulativeDistribution_T;
+  typedef IndexedContinuousAttributeLite<stdair::PriceValue_T> ValueOfTimeCumulativeDistribution_T;
 
   /** Define the value of time continuous distribution. */
   typedef ValueOfTimeCumulativeDistribution_T::ContinuousDistribution_T ValueOfTimeContinuousDistribution_T;
 
   /** Define the FRAT5 pattern type. */
-  typedef ContinuousAttributeLite<stdair::RealNumber_T> CumulativeDistribution_T;
+  typedef IndexedContinuousAttributeLite<stdair::RealNumber_T> CumulativeDistribution_T;
   typedef CumulativeDistribution_T::ContinuousDistribution_T FRAT5Pattern_T;
+
+  /** Define the (shared) joint table of the categorical characteristics. */
+  typedef boost::shared_ptr<const JointCharacteristicsTable> JointCharacteristicsTablePtr_T;
+
+  /** Define the (shared, immutable) demand characteristics. */
+  typedef boost::shared_ptr<const DemandCharacteristics> DemandCharacteristicsPtr_T;
 }
 #endif // __TRADEMGEN_BAS_DEMANDCHARACTERISTICSTYPES_HPP
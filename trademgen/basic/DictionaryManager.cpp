@@ -5,17 +5,30 @@
 #include <trademgen/basic/DictionaryManager.hpp>
 
 namespace TRADEMGEN {
+  // ////////////////////////////////////////////////////////////////////
+  const DictionaryKey_T DictionaryManager::KEY_MAX;
+
   // ////////////////////////////////////////////////////////////////////
   const stdair::Probability_T DictionaryManager::
   keyToValue (const DictionaryKey_T iKey) {
-    //    return static_cast<stdair::Probability_T>(iKey) / 1000;
-    return iKey;
+    const double lValue = static_cast<double> (iKey) / KEY_MAX;
+    return static_cast<stdair::Probability_T> (lValue);
   }
 
   // ////////////////////////////////////////////////////////////////////
   const DictionaryKey_T DictionaryManager::
   valueToKey (const stdair::Probability_T iValue) {
-    //    return iValue * 1000;
-    return iValue;
+    // That test also catches NaN values.
+    if (!(iValue > 0.0)) {
+      return 0;
+    }
+    if (iValue >= 1.0) {
+      return KEY_MAX;
+    }
+
+    // The scaled value is lower than KEY_MAX, hence the rounded one
+    // cannot overflow.
+    const double lScaledValue = static_cast<double> (iValue) * KEY_MAX;
+    return static_cast<DictionaryKey_T> (lScaledValue + 0.5);
   }
 }
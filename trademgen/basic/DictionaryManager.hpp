@@ -5,29 +5,53 @@
 // //////////////////////////////////////////////////////////////////////
 // Import section
 // //////////////////////////////////////////////////////////////////////
+// Boost
+#include <boost/cstdint.hpp>
 // StdAir
 #include <stdair/stdair_maths_types.hpp>
 
 namespace TRADEMGEN {
 
   // //////////// Type definitions /////////////////
-  /** Dictionary key. */
-  //typedef unsigned short DictionaryKey_T;
-  typedef stdair::Probability_T DictionaryKey_T;
+  /**
+   * Dictionary key: fixed-point (32-bit) encoding of a probability. The
+   * key k stands for the probability k / DictionaryManager::KEY_MAX.
+   */
+  typedef boost::uint32_t DictionaryKey_T;
   
   /**
    * @brief Class wrapper of dictionary business methods.
+   *
+   * Probabilities, within [0, 1], are coded on 32-bit keys, so that the
+   * cumulative distributions of the categorical attributes are compact
+   * and compared on integers only.
    */
   class DictionaryManager {
+  public:
+    // //////////// Constants /////////////////
+    /**
+     * Key of the probability 1 (greatest key).
+     */
+    static const DictionaryKey_T KEY_MAX = 0xFFFFFFFFu;
+
   public:
     // //////////// Business methods /////////////////
     /**
      * Convert from key to value.
+     *
+     * That conversion is exact when stdair::Probability_T is a double
+     * precision floating point type.
      */
     static const stdair::Probability_T keyToValue (const DictionaryKey_T);
     
     /**
      * Convert from value to key.
+     *
+     * The value is rounded to the nearest key (ties are rounded
+     * upwards), so that the coding error is at most half of
+     * 1 / KEY_MAX. Values below 0 (and NaN) are coded as 0; values
+     * above 1 are coded as KEY_MAX. The coding is non-decreasing, so
+     * that the order of the cumulative probabilities is kept.
      */
     static const DictionaryKey_T valueToKey (const stdair::Probability_T);
   };
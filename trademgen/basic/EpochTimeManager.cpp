@@ -0,0 +1,43 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// TraDemGen
+#include <trademgen/basic/EpochTimeManager.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  const EpochTime_T EpochTimeManager::MILLISECONDS_IN_ONE_SECOND;
+  const EpochTime_T EpochTimeManager::MILLISECONDS_IN_ONE_DAY;
+
+  // ////////////////////////////////////////////////////////////////////
+  /**
+   * Origin of the epoch times.
+   */
+  static const stdair::DateTime_T& getEpoch() {
+    static const stdair::DateTime_T lEpoch (stdair::Date_T (1970, 1, 1));
+    return lEpoch;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const EpochTime_T EpochTimeManager::
+  convertIntoEpochTime (const stdair::DateTime_T& iDateTime) {
+    const stdair::Duration_T lDuration = iDateTime - getEpoch();
+    return static_cast<EpochTime_T> (lDuration.total_milliseconds());
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const stdair::DateTime_T EpochTimeManager::
+  convertIntoDateTime (const EpochTime_T iEpochTime) {
+    // Split the epoch time into days and milliseconds, so that the
+    // Boost durations do not overflow.
+    const EpochTime_T lNbOfDays = getNbOfDays (iEpochTime);
+    const EpochTime_T lNbOfMilliseconds =
+      iEpochTime - lNbOfDays * MILLISECONDS_IN_ONE_DAY;
+    const stdair::Date_T lDate =
+      getEpoch().date() + stdair::DateOffset_T (static_cast<long> (lNbOfDays));
+    return stdair::DateTime_T (lDate, boost::posix_time::
+                               milliseconds (static_cast<long> (lNbOfMilliseconds)));
+  }
+
+}
@@ -0,0 +1,63 @@
+#ifndef __TRADEMGEN_BAS_EPOCHTIMEMANAGER_HPP
+#define __TRADEMGEN_BAS_EPOCHTIMEMANAGER_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// Boost
+#include <boost/cstdint.hpp>
+// StdAir
+#include <stdair/stdair_date_time_types.hpp>
+
+namespace TRADEMGEN {
+
+  // //////////// Type definitions /////////////////
+  /**
+   * Epoch time: number of milliseconds since 1970-01-01 00:00:00.
+   */
+  typedef boost::int64_t EpochTime_T;
+
+  /**
+   * @brief Class wrapper of the conversions between the epoch times
+   * (64-bit integers) and the Boost date-times.
+   */
+  class EpochTimeManager {
+  public:
+    // //////////// Constants /////////////////
+    /**
+     * Number of milliseconds in one second.
+     */
+    static const EpochTime_T MILLISECONDS_IN_ONE_SECOND = 1000;
+
+    /**
+     * Number of milliseconds in one day.
+     */
+    static const EpochTime_T MILLISECONDS_IN_ONE_DAY = 86400000;
+
+  public:
+    // //////////// Business methods /////////////////
+    /**
+     * Convert a date-time into an epoch time (the sub-millisecond part,
+     * if any, is truncated).
+     */
+    static const EpochTime_T
+    convertIntoEpochTime (const stdair::DateTime_T&);
+
+    /**
+     * Convert an epoch time into a date-time.
+     */
+    static const stdair::DateTime_T
+    convertIntoDateTime (const EpochTime_T);
+
+    /**
+     * Get the number of days, since the origin, of the date of the
+     * given epoch time (e.g., the difference of two such numbers of
+     * days is the difference of the two dates).
+     */
+    static const EpochTime_T getNbOfDays (const EpochTime_T iEpochTime) {
+      const EpochTime_T lNbOfDays = iEpochTime / MILLISECONDS_IN_ONE_DAY;
+      return (iEpochTime % MILLISECONDS_IN_ONE_DAY < 0) ? lNbOfDays - 1 : lNbOfDays;
+    }
+  };
+}
+#endif // __TRADEMGEN_BAS_EPOCHTIMEMANAGER_HPP
@@ -0,0 +1,138 @@
+#ifndef __TRADEMGEN_BAS_GUIDETABLE_HPP
+#define __TRADEMGEN_BAS_GUIDETABLE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// TraDemGen
+#include <trademgen/basic/SmallVector.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Guide table (indexed search, as described by H.-C. Chen and
+   * Y. Asau) over a non-decreasing array of keys.
+   *
+   * The key range is split into as many buckets as there are keys.
+   * Each bucket stores the number of keys falling into the preceding
+   * buckets, so that the search for the first key strictly greater
+   * than a given value starts right next to the answer. On average,
+   * the search then costs a constant number of comparisons.
+   *
+   * The guide table does not hold a copy of the keys: they stay with
+   * their owner, which gives them at each search (so that the owner
+   * may be copied along with its guide table).
+   */
+  template <typename K>
+  class GuideTable {
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Get the index of the first key strictly greater than the given
+     * value (i.e., the size of the array when there is no such key).
+     * The keys must be the ones given to init().
+     */
+    unsigned int getUpperBound (const K* iKeyArray, const K& iValue) const {
+      if (_size == 0) {
+        return 0;
+      }
+
+      // NaN values, just like values beyond the last key, do not
+      // have any key greater than them.
+      if (!(iValue < iKeyArray[_size - 1])) {
+        return _size;
+      }
+      if (iValue < iKeyArray[0]) {
+        return 0;
+      }
+
+      unsigned int idx = _guideArray[getBucket (iValue)];
+      while (!(iValue < iKeyArray[idx])) {
+        ++idx;
+      }
+      assert (idx < _size);
+      return idx;
+    }
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Default constructor (empty table).
+     */
+    GuideTable() : _size (0), _lowerBound (0.0), _scale (0.0) {
+    }
+
+    /**
+     * Build the guide table. The given keys must be sorted in
+     * non-decreasing order.
+     */
+    void init (const K* iKeyArray, const unsigned int iSize) {
+      _size = iSize;
+      _guideArray.clear();
+      if (_size == 0) {
+        return;
+      }
+
+      const double lLowerBound = static_cast<double> (iKeyArray[0]);
+      const double lUpperBound = static_cast<double> (iKeyArray[_size - 1]);
+      _lowerBound = lLowerBound;
+      _scale = 0.0;
+      if (lUpperBound > lLowerBound) {
+        _scale = static_cast<double> (_size) / (lUpperBound - lLowerBound);
+      }
+
+      // The bucket function is non-decreasing, so that the keys
+      // counted for a bucket are all lower than any value of that bucket.
+      _guideArray.reserve (_size);
+      unsigned int idx = 0;
+      for (unsigned int lBucket = 0; lBucket < _size; ++lBucket) {
+        while (idx < _size && getBucket (iKeyArray[idx]) < lBucket) {
+          ++idx;
+        }
+        _guideArray.push_back (idx);
+      }
+    }
+
+
+  private:
+    /**
+     * Get the bucket corresponding to a value within the key range.
+     */
+    unsigned int getBucket (const K& iValue) const {
+      const double lPosition =
+        (static_cast<double> (iValue) - _lowerBound) * _scale;
+      if (!(lPosition < static_cast<double> (_size))) {
+        return _size - 1;
+      }
+      return static_cast<unsigned int> (lPosition);
+    }
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Number of keys (and of buckets).
+     */
+    unsigned int _size;
+
+    /**
+     * Lowest key.
+     */
+    double _lowerBound;
+
+    /**
+     * Number of buckets per unit of key.
+     */
+    double _scale;
+
+    /**
+     * For each bucket, the number of keys lying in the lower buckets.
+     */
+    SmallVector<unsigned int> _guideArray;
+  };
+
+}
+#endif // __TRADEMGEN_BAS_GUIDETABLE_HPP
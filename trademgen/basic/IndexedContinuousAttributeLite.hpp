@@ -0,0 +1,395 @@
+#ifndef __TRADEMGEN_BAS_INDEXEDCONTINUOUSATTRIBUTELITE_HPP
+#define __TRADEMGEN_BAS_INDEXEDCONTINUOUSATTRIBUTELITE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <map>
+// Boost
+#include <boost/functional/hash.hpp>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+// TraDemGen
+#include <trademgen/TRADEMGEN_Exceptions.hpp>
+#include <trademgen/basic/BatchSearch.hpp>
+#include <trademgen/basic/GuideTable.hpp>
+#include <trademgen/basic/SmallVector.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Class modeling the distribution of values that can be
+   * taken by a continuous attribute, with indexed look-ups.
+   *
+   * The interpolation semantics are exactly the ones of
+   * ContinuousAttributeLite. However, the segment differences and
+   * slopes are computed once and for all at initialisation, and the
+   * searches go through guide tables, so that each look-up costs a
+   * constant number of steps on average (instead of a linear scan).
+   *
+   * As for ContinuousAttributeLite, the cumulative distribution is not
+   * dictionary-coded.
+   */
+  template <typename T>
+  struct IndexedContinuousAttributeLite {
+  public:
+    // ///////////////////// Type definitions ///////////////////////
+    /**
+     * Type for the probability mass function.
+     */
+    typedef std::map<T, stdair::Probability_T> ContinuousDistribution_T;
+
+  public:
+    // ////////////////////// Business Methods ////////////////////
+    /**
+     * Get value from inverse cumulative distribution.
+     */
+    const T getValue(const stdair::Probability_T& iCumulativeProbability) const{
+      // Find the first cumulative probablity value greater than the
+      // given one.
+      const unsigned int idx =
+        _cumulativeGuideTable.getUpperBound (_maxCumulativeArray.data(),
+                                             iCumulativeProbability);
+
+      return interpolate (idx, iCumulativeProbability);
+    }
+
+    /**
+     * Get values from inverse cumulative distribution, for a whole
+     * array of cumulative probabilities at once.
+     *
+     * The segments are searched for with the SIMD kernels of
+     * BatchSearch. Each value is the same as the one given by
+     * getValue() for the same cumulative probability.
+     */
+    void getValues (const double* iCumulativeProbabilityArray,
+                    T* oValueArray, const std::size_t iNbOfValues) const {
+      double lKeyArray[BatchSearch::CHUNK_SIZE];
+      unsigned int lIndexArray[BatchSearch::CHUNK_SIZE];
+
+      for (std::size_t lStart = 0; lStart < iNbOfValues;
+           lStart += BatchSearch::CHUNK_SIZE) {
+        const std::size_t lLength =
+          std::min (BatchSearch::CHUNK_SIZE, iNbOfValues - lStart);
+
+        for (std::size_t idx = 0; idx < lLength; ++idx) {
+          const stdair::Probability_T lCumulativeProbability =
+            iCumulativeProbabilityArray[lStart + idx];
+          lKeyArray[idx] = static_cast<double> (lCumulativeProbability);
+        }
+
+        BatchSearch::getUpperBounds (_maxCumulativeArray.data(), _size,
+                                     lKeyArray, lIndexArray, lLength);
+
+        for (std::size_t idx = 0; idx < lLength; ++idx) {
+          const stdair::Probability_T lCumulativeProbability =
+            iCumulativeProbabilityArray[lStart + idx];
+          oValueArray[lStart + idx] =
+            interpolate (lIndexArray[idx], lCumulativeProbability);
+        }
+      }
+    }
+
+    /**
+     * Get the value of the derivative function in a key point.
+     */
+    const double getDerivativeValue(const T iKey) const{
+
+      // Find the first key value greater than iKey.
+      const unsigned int idx =
+        _valueGuideTable.getUpperBound (_valueArray.data(), iKey);
+
+      assert (idx != 0);
+      assert (idx != _size);
+
+      return _derivativeArray[idx];
+    }
+
+    /**
+     * Get the upper bound.
+     */
+    const T getUpperBound (const T iKey) const {
+      // Find the first key value greater than iKey.
+      const unsigned int idx =
+        _valueGuideTable.getUpperBound (_valueArray.data(), iKey);
+
+      assert (idx != 0);
+      assert (idx != _size);
+
+      return _valueArray[idx];
+    }
+
+    /**
+     * Get the cumulative probability corresponding to a value (i.e.,
+     * the cumulative distribution function, linearly interpolated
+     * between the points of the distribution). Values beyond the first
+     * (resp. last) point give the first (resp. last) cumulative
+     * probability.
+     */
+    const double getCumulativeProbability (const T& iValue) const {
+      // Find the first key value greater than iValue.
+      const unsigned int idx =
+        _valueGuideTable.getUpperBound (_valueArray.data(), iValue);
+
+      if (idx == 0) {
+        if (_size == 0) {
+          throw IndexOutOfRangeException ("The cumulative distribution is "
+                                          "empty");
+        }
+        return _cumulativeArray[idx];
+      }
+      if (idx == _size) {
+        return _cumulativeArray[idx-1];
+      }
+
+      return _cumulativeArray[idx-1]
+        + _derivativeArray[idx] * (iValue - _valueArray[idx-1]);
+    }
+
+    /**
+     * Get the hash value of the distribution (i.e., of its values and
+     * cumulative probabilities).
+     */
+    std::size_t getHashValue() const {
+      std::size_t oHashValue =
+        boost::hash_range (_valueArray.begin(), _valueArray.end());
+      boost::hash_combine (oHashValue,
+                           boost::hash_range (_cumulativeArray.begin(),
+                                              _cumulativeArray.end()));
+      return oHashValue;
+    }
+
+    /**
+     * Equality operator (same values, with the same cumulative
+     * probabilities).
+     */
+    bool operator== (const IndexedContinuousAttributeLite& iCAL) const {
+      return (_valueArray == iCAL._valueArray
+              && _cumulativeArray == iCAL._cumulativeArray);
+    }
+
+  public:
+    // ////////////// Display Support Methods ////////////////
+    /**
+     * Display cumulative distribution.
+     */
+    const std::string displayCumulativeDistribution() const {
+      std::ostringstream oStr;
+
+      for (unsigned int idx = 0; idx < _size; ++idx) {
+        if (idx != 0) {
+          oStr << ", ";
+        }
+        oStr << _valueArray[idx] << ":" << _cumulativeArray[idx];
+      }
+      return oStr.str();
+    }
+
+
+  public:
+    // ////////// Constructors and destructors //////////////
+    /**
+     * Constructor.
+     */
+    IndexedContinuousAttributeLite (const ContinuousDistribution_T& iValueMap)
+      : _size (iValueMap.size()) {
+      init (iValueMap);
+    }
+
+    /**
+     * Copy constructor.
+     */
+    IndexedContinuousAttributeLite (const IndexedContinuousAttributeLite& iCAL)
+      : _size (iCAL._size),
+        _cumulativeArray (iCAL._cumulativeArray),
+        _cumulativeDeltaArray (iCAL._cumulativeDeltaArray),
+        _valueArray (iCAL._valueArray),
+        _valueDeltaArray (iCAL._valueDeltaArray),
+        _derivativeArray (iCAL._derivativeArray),
+        _maxCumulativeArray (iCAL._maxCumulativeArray),
+        _cumulativeGuideTable (iCAL._cumulativeGuideTable),
+        _valueGuideTable (iCAL._valueGuideTable) {
+    }
+
+    /**
+     * Copy operator.
+     */
+    IndexedContinuousAttributeLite&
+    operator= (const IndexedContinuousAttributeLite& iCAL) {
+      _size = iCAL._size;
+      _cumulativeArray = iCAL._cumulativeArray;
+      _cumulativeDeltaArray = iCAL._cumulativeDeltaArray;
+      _valueArray = iCAL._valueArray;
+      _valueDeltaArray = iCAL._valueDeltaArray;
+      _derivativeArray = iCAL._derivativeArray;
+      _maxCumulativeArray = iCAL._maxCumulativeArray;
+      _cumulativeGuideTable = iCAL._cumulativeGuideTable;
+      _valueGuideTable = iCAL._valueGuideTable;
+      return *this;
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~IndexedContinuousAttributeLite() {
+    }
+
+  private:
+    /**
+     * Default constructor.
+     */
+    IndexedContinuousAttributeLite() : _size(0) {
+    }
+
+    /**
+     * Interpolate the value within the segment ending at the given index
+     * (i.e., the index of the first cumulative probablity value greater
+     * than the given one).
+     */
+    const T interpolate (const unsigned int idx,
+                         const stdair::Probability_T& iCumulativeProbability) const {
+      if (idx == 0) {
+        if (_size == 0) {
+          throw IndexOutOfRangeException ("The cumulative distribution is "
+                                          "empty");
+        }
+        return _valueArray[idx];
+      }
+      if (idx == _size) {
+        return _valueArray[idx-1];
+      }
+
+      //
+      const stdair::Probability_T& lCumulativePreviousPoint =
+        _cumulativeArray[idx-1];
+      if (lCumulativePreviousPoint == _cumulativeArray[idx]) {
+        return _valueArray[idx-1];
+      }
+
+      T oValue = _valueArray[idx-1] + _valueDeltaArray[idx]
+        * (iCumulativeProbability - lCumulativePreviousPoint)
+        / _cumulativeDeltaArray[idx];
+
+      return oValue;
+    }
+
+    /**
+     * Determine inverse cumulative distribution from cumulative
+     * distribution (initialisation).
+     */
+    void init (const ContinuousDistribution_T& iValueMap) {
+      //
+      const unsigned int lSize = iValueMap.size();
+      _maxCumulativeArray.reserve (lSize);
+      _cumulativeArray.reserve (lSize);
+      _cumulativeDeltaArray.reserve (lSize);
+      _valueArray.reserve (lSize);
+      _valueDeltaArray.reserve (lSize);
+      _derivativeArray.reserve (lSize);
+
+      // Browse the map to retrieve the values and cumulative probabilities.
+      for (typename ContinuousDistribution_T::const_iterator it =
+             iValueMap.begin(); it != iValueMap.end(); ++it) {
+
+        const T& attributeValue = it->first;
+        const stdair::Probability_T& lCumulativeProbability = it->second;
+
+        // The guide table requires sorted keys. Nothing forces the
+        // cumulative probabilities to be monotonic though. Searching
+        // for the first running maximum greater than a key gives the
+        // same index as searching for the first cumulative probability
+        // greater than that key.
+        if (_maxCumulativeArray.empty() == true
+            || _maxCumulativeArray.back() < lCumulativeProbability) {
+          _maxCumulativeArray.push_back (lCumulativeProbability);
+        } else {
+          _maxCumulativeArray.push_back (_maxCumulativeArray.back());
+        }
+
+        // Differences with the previous point, and slope of the segment.
+        if (_valueArray.empty() == true) {
+          _cumulativeDeltaArray.push_back (0.0);
+          _valueDeltaArray.push_back (T());
+          _derivativeArray.push_back (0.0);
+
+        } else {
+          const stdair::Probability_T lCumulativeDelta =
+            lCumulativeProbability - _cumulativeArray.back();
+          const T lValueDelta = attributeValue - _valueArray.back();
+          assert (attributeValue != _valueArray.back());
+
+          _cumulativeDeltaArray.push_back (lCumulativeDelta);
+          _valueDeltaArray.push_back (lValueDelta);
+          _derivativeArray.push_back (lCumulativeDelta / lValueDelta);
+        }
+
+        // Build the arrays.
+        _cumulativeArray.push_back (lCumulativeProbability);
+        _valueArray.push_back (attributeValue);
+      }
+
+      // Build the guide tables, over the arrays themselves.
+      _cumulativeGuideTable.init (_maxCumulativeArray.data(), lSize);
+      _valueGuideTable.init (_valueArray.data(), lSize);
+    }
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Size of the arrays.
+     */
+    unsigned int _size;
+
+    /**
+     * Cumulative distribution.
+     */
+    SmallVector<stdair::Probability_T> _cumulativeArray;
+
+    /**
+     * Differences between consecutive cumulative probabilities.
+     */
+    SmallVector<stdair::Probability_T> _cumulativeDeltaArray;
+
+    /**
+     * The corresponding values.
+     */
+    SmallVector<T> _valueArray;
+
+    /**
+     * Differences between consecutive values.
+     */
+    SmallVector<T> _valueDeltaArray;
+
+    /**
+     * Slopes of the segments (i.e., values of the derivative function).
+     */
+    SmallVector<double> _derivativeArray;
+
+    /**
+     * Running maximum of the cumulative distribution (as
+     * double-precision numbers, searched for by both the guide table
+     * and the batch look-ups).
+     */
+    SmallVector<double> _maxCumulativeArray;
+
+    /**
+     * Guide table over the running maximum of the cumulative
+     * distribution.
+     */
+    GuideTable<double> _cumulativeGuideTable;
+
+    /**
+     * Guide table over the values.
+     */
+    GuideTable<T> _valueGuideTable;
+  };
+
+}
+#endif // __TRADEMGEN_BAS_INDEXEDCONTINUOUSATTRIBUTELITE_HPP
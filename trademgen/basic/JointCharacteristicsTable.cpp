@@ -0,0 +1,56 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// TraDemGen
+#include <trademgen/basic/JointCharacteristicsTable.hpp>
+
+namespace TRADEMGEN {
+
+  // //////////////////////////////////////////////////////////////////////
+  JointCharacteristicsTable::JointCharacteristicsTable() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool JointCharacteristicsTable::init (const MassArrayList_T& iMassArrayList,
+                                        const unsigned int iMaxSize) {
+    const unsigned int lNbOfFactors = iMassArrayList.size();
+    _radixArray.assign (lNbOfFactors, 1);
+    _strideArray.assign (lNbOfFactors, 1);
+    _aliasTable.init (AliasTable::MassArray_T());
+
+    // Compute the strides, starting from the last factor (which
+    // varies the fastest).
+    unsigned int lSize = 1;
+    for (unsigned int lFactor = lNbOfFactors; lFactor > 0; --lFactor) {
+      const unsigned int lRadix = iMassArrayList[lFactor-1].size();
+      if (lRadix == 0 || lSize > iMaxSize / lRadix) {
+        return false;
+      }
+      _radixArray[lFactor-1] = lRadix;
+      _strideArray[lFactor-1] = lSize;
+      lSize *= lRadix;
+    }
+
+    // The probability mass of a tuple is the product of the
+    // probability masses of its components.
+    AliasTable::MassArray_T lMassArray (lSize, 1.0);
+    double lTotalMass = 0.0;
+    for (unsigned int idx = 0; idx < lSize; ++idx) {
+      for (unsigned int lFactor = 0; lFactor < lNbOfFactors; ++lFactor) {
+        const double lMass =
+          iMassArrayList[lFactor][getFactorIndex (idx, lFactor)];
+        lMassArray[idx] *= (lMass > 0.0) ? lMass : 0.0;
+      }
+      lTotalMass += lMassArray[idx];
+    }
+    if (lTotalMass <= 0.0) {
+      return false;
+    }
+    _aliasTable.init (lMassArray);
+
+    return true;
+  }
+
+}
@@ -0,0 +1,97 @@
+#ifndef __TRADEMGEN_BAS_JOINTCHARACTERISTICSTABLE_HPP
+#define __TRADEMGEN_BAS_JOINTCHARACTERISTICSTABLE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <vector>
+// StdAir
+#include <stdair/stdair_maths_types.hpp>
+// TraDemGen
+#include <trademgen/basic/AliasTable.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Alias table over the Cartesian product of several independent
+   * discrete distributions (called factors).
+   *
+   * A single uniform variate gives the index of a whole tuple, from
+   * which the index of each factor is then deduced (the tuples are
+   * numbered with a mixed radix, the first factor varying the slowest).
+   */
+  class JointCharacteristicsTable {
+  public:
+    // ///////////// Type definitions //////////////
+    /**
+     * Type for the list of probability masses of each factor.
+     */
+    typedef std::vector<AliasTable::MassArray_T> MassArrayList_T;
+
+
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Get the index of the tuple corresponding to the given uniform
+     * variate (within [0, 1]).
+     */
+    unsigned int getIndex (const stdair::Probability_T& iVariate) const {
+      return _aliasTable.getIndex (iVariate);
+    }
+
+    /**
+     * Get the index, within the given factor, of the given tuple.
+     */
+    unsigned int getFactorIndex (const unsigned int iIndex,
+                                 const unsigned int iFactor) const {
+      return (iIndex / _strideArray[iFactor]) % _radixArray[iFactor];
+    }
+
+    /**
+     * Get the number of tuples.
+     */
+    unsigned int getSize() const {
+      return _aliasTable.getSize();
+    }
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Default constructor (empty table).
+     */
+    JointCharacteristicsTable();
+
+    /**
+     * Build the alias table over all the tuples of the given factors.
+     *
+     * @param const MassArrayList_T& Probability masses of each factor.
+     * @param const unsigned int Maximal number of tuples.
+     * @return bool Whether the table has been built, i.e., whether no
+     *         factor is empty and the number of tuples does not exceed
+     *         the given maximum.
+     */
+    bool init (const MassArrayList_T&, const unsigned int iMaxSize);
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Number of values of each factor.
+     */
+    std::vector<unsigned int> _radixArray;
+
+    /**
+     * Number of consecutive tuples sharing the same value of each factor.
+     */
+    std::vector<unsigned int> _strideArray;
+
+    /**
+     * Alias table over the tuples.
+     */
+    AliasTable _aliasTable;
+  };
+
+}
+#endif // __TRADEMGEN_BAS_JOINTCHARACTERISTICSTABLE_HPP
@@ -12,14 +12,14 @@ namespace TRADEMGEN {
   // //////////////////////////////////////////////////////////////////////
   RandomGenerationContext::RandomGenerationContext ()
     : _numberOfRequestsGeneratedSoFar (0),
-      _cumulativeProbabilitySoFar (0.0) {
+      _logComplementOfCumulativeProbabilitySoFar (0.0) {
   }
   
   // //////////////////////////////////////////////////////////////////////
   RandomGenerationContext::
   RandomGenerationContext (const RandomGenerationContext& iRGC)
     : _numberOfRequestsGeneratedSoFar (iRGC._numberOfRequestsGeneratedSoFar),
-      _cumulativeProbabilitySoFar (iRGC._cumulativeProbabilitySoFar) {
+      _logComplementOfCumulativeProbabilitySoFar (iRGC._logComplementOfCumulativeProbabilitySoFar) {
   }
   
   // //////////////////////////////////////////////////////////////////////
@@ -30,7 +30,7 @@ namespace TRADEMGEN {
   const std::string RandomGenerationContext::describe() const {
     std::ostringstream oStr;
     oStr << _numberOfRequestsGeneratedSoFar
-         << " => " << _cumulativeProbabilitySoFar;
+         << " => " << getCumulativeProbabilitySoFar();
     return oStr.str();
   }
 
@@ -39,9 +39,19 @@ namespace TRADEMGEN {
     ++_numberOfRequestsGeneratedSoFar;
   }
 
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::Probability_T RandomGenerationContext::
+  advanceCumulativeProbabilitySoFar (const stdair::Probability_T& iVariate,
+                                     const stdair::Count_T& iRemainingNumberOfRequests) {
+    _logComplementOfCumulativeProbabilitySoFar =
+      getNextLogComplement (_logComplementOfCumulativeProbabilitySoFar,
+                            iVariate, iRemainingNumberOfRequests);
+    return getCumulativeProbabilitySoFar();
+  }
+
   // //////////////////////////////////////////////////////////////////////
   void RandomGenerationContext::reset() {
-    _cumulativeProbabilitySoFar = 0.0;
+    _logComplementOfCumulativeProbabilitySoFar = 0.0;
     _numberOfRequestsGeneratedSoFar = 0;
   }
 
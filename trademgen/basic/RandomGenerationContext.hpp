@@ -5,6 +5,8 @@
 // Import section
 // //////////////////////////////////////////////////////////////////////
 // STL
+#include <cassert>
+#include <cmath>
 #include <iosfwd>
 #include <string>
 // StdAir
@@ -31,8 +33,17 @@ namespace TRADEMGEN {
      * Get the cumulative probability in arrival pattern for last
      * request generated so far (needed for sequential generation).
      */
-    const stdair::Probability_T& getCumulativeProbabilitySoFar() const {
-      return _cumulativeProbabilitySoFar;
+    const stdair::Probability_T getCumulativeProbabilitySoFar() const {
+      return -std::expm1 (_logComplementOfCumulativeProbabilitySoFar);
+    }
+
+    /**
+     * Get the logarithm of the complement of the cumulative probability
+     * in arrival pattern for last request generated so far (i.e.,
+     * log(1 - x)).
+     */
+    const double& getLogComplementOfCumulativeProbabilitySoFar() const {
+      return _logComplementOfCumulativeProbabilitySoFar;
     }
     
   public:
@@ -49,7 +60,15 @@ namespace TRADEMGEN {
      * request generated so far (needed for sequential generation).
      */
     void setCumulativeProbabilitySoFar (const stdair::Probability_T& iProb) {
-      _cumulativeProbabilitySoFar = iProb;
+      _logComplementOfCumulativeProbabilitySoFar = std::log1p (-iProb);
+    }
+
+    /**
+     * Set the logarithm of the complement of the cumulative probability
+     * in arrival pattern for last request generated so far.
+     */
+    void setLogComplementOfCumulativeProbabilitySoFar (const double& iLogComplement) {
+      _logComplementOfCumulativeProbabilitySoFar = iLogComplement;
     }
     
 
@@ -78,6 +97,40 @@ namespace TRADEMGEN {
      */
     void incrementGeneratedRequestsCounter();
 
+    /**
+     * Advance the cumulative probability so far to the one of the next
+     * request (sequential generation in increasing order).
+     *
+     * @see getNextLogComplement() for the parameters.
+     * @return stdair::Probability_T Cumulative probability of the next
+     *         request.
+     */
+    const stdair::Probability_T
+    advanceCumulativeProbabilitySoFar (const stdair::Probability_T& iVariate,
+                                       const stdair::Count_T& iRemainingNumberOfRequests);
+
+    /**
+     * Get the logarithm of the complement of the cumulative probability
+     * of the next request (i.e., of the k-th order statistic), given the
+     * one of the last request:
+     * log(1 - x(k)) = log(1 - x(k - 1)) - E/(n - k + 1),
+     * where E = -log(1 - y) follows an exponential distribution of rate 1.
+     *
+     * @param const double& Logarithm of the complement of the cumulative
+     *        probability of the last request (i.e., log(1 - x(k - 1))).
+     * @param const stdair::Probability_T& Uniform variate (i.e., y).
+     * @param const stdair::Count_T& Number of requests not generated yet
+     *        (i.e., n - k + 1).
+     */
+    static double getNextLogComplement (const double& iLogComplement,
+                                        const stdair::Probability_T& iVariate,
+                                        const stdair::Count_T& iRemainingNumberOfRequests) {
+      assert (iRemainingNumberOfRequests > 0);
+      const double lExponentialVariable = -std::log1p (-iVariate);
+      return iLogComplement
+        - lExponentialVariable / static_cast<double> (iRemainingNumberOfRequests);
+    }
+
     /**
      * Reset the counters.
      */
@@ -100,10 +153,13 @@ namespace TRADEMGEN {
     stdair::Count_T _numberOfRequestsGeneratedSoFar;
 
     /**
-     * Cumulative probability in arrival pattern for last request
-     * generated so far (needed for sequential generation).
+     * Logarithm of the complement of the cumulative probability in
+     * arrival pattern for last request generated so far (needed for
+     * sequential generation). Kept in log space, so that the
+     * successive order statistics are accumulated without any loss of
+     * precision, even when they get close to 1.
      */
-    stdair::Probability_T _cumulativeProbabilitySoFar;   
+    double _logComplementOfCumulativeProbabilitySoFar;
   };
 
 }
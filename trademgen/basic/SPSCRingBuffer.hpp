@@ -0,0 +1,144 @@
+#ifndef __TRADEMGEN_BAS_SPSCRINGBUFFER_HPP
+#define __TRADEMGEN_BAS_SPSCRINGBUFFER_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cstddef>
+#include <atomic>
+#include <vector>
+
+namespace TRADEMGEN {
+
+  /**
+   * Size of the cache lines, on which the indexes of the producer and
+   * of the consumer are kept apart.
+   */
+  const std::size_t CACHE_LINE_SIZE = 64;
+
+  /**
+   * @brief Bounded, lock-free ring buffer between a single producer
+   * thread and a single consumer thread.
+   *
+   * The producer alone writes the write index, and the consumer alone
+   * writes the read index; each of them sits on its own cache line,
+   * along with the copy of the other index last seen by its owner, so
+   * that the other index is (atomically) read only when the ring
+   * looks full (for the producer) or empty (for the consumer).
+   *
+   * Neither tryPush() nor tryPop() ever blocks: waiting (e.g., for the
+   * back-pressure of the consumer) is up to the caller.
+   */
+  template <typename T>
+  class SPSCRingBuffer {
+  public:
+    // ///////////// Type definitions //////////////
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+
+  public:
+    // /////////////// Getters //////////
+    /** Get the maximal number of elements within the ring. */
+    size_type capacity() const {
+      return _slotList.size();
+    }
+
+
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Add an element (to be called by the producer thread only).
+     *
+     * @return bool Whether the element has been added (false when the
+     *         ring is full).
+     */
+    bool tryPush (const T& iElement) {
+      const size_type lWriteIndex =
+        _writeIndex.load (std::memory_order_relaxed);
+      if (lWriteIndex - _cachedReadIndex == _slotList.size()) {
+        _cachedReadIndex = _readIndex.load (std::memory_order_acquire);
+        if (lWriteIndex - _cachedReadIndex == _slotList.size()) {
+          return false;
+        }
+      }
+      _slotList[lWriteIndex & _indexMask] = iElement;
+      _writeIndex.store (lWriteIndex + 1, std::memory_order_release);
+      return true;
+    }
+
+    /**
+     * Extract the oldest element (to be called by the consumer thread
+     * only).
+     *
+     * @return bool Whether an element has been extracted (false when
+     *         the ring is empty).
+     */
+    bool tryPop (T& ioElement) {
+      const size_type lReadIndex = _readIndex.load (std::memory_order_relaxed);
+      if (lReadIndex == _cachedWriteIndex) {
+        _cachedWriteIndex = _writeIndex.load (std::memory_order_acquire);
+        if (lReadIndex == _cachedWriteIndex) {
+          return false;
+        }
+      }
+      ioElement = _slotList[lReadIndex & _indexMask];
+      _readIndex.store (lReadIndex + 1, std::memory_order_release);
+      return true;
+    }
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor. The capacity is rounded up to a power of two.
+     */
+    explicit SPSCRingBuffer (const size_type iCapacity)
+      : _writeIndex (0), _cachedReadIndex (0),
+        _readIndex (0), _cachedWriteIndex (0) {
+      size_type lCapacity = 1;
+      while (lCapacity < iCapacity) {
+        lCapacity *= 2;
+      }
+      _slotList.resize (lCapacity);
+      _indexMask = lCapacity - 1;
+    }
+
+  private:
+    /** Copy constructor (not implemented). */
+    SPSCRingBuffer (const SPSCRingBuffer&);
+    /** Assignment operator (not implemented). */
+    SPSCRingBuffer& operator= (const SPSCRingBuffer&);
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Slots of the ring, and mask giving the slot of an index (read
+     * only once constructed).
+     */
+    std::vector<T> _slotList;
+    size_type _indexMask;
+
+    /**
+     * Producer side: next index to be written, and last seen read index.
+     */
+    alignas (CACHE_LINE_SIZE) std::atomic<size_type> _writeIndex;
+    size_type _cachedReadIndex;
+
+    /**
+     * Consumer side: next index to be read, and last seen write index.
+     */
+    alignas (CACHE_LINE_SIZE) std::atomic<size_type> _readIndex;
+    size_type _cachedWriteIndex;
+
+    /**
+     * Keep whatever follows the ring off the line of the consumer.
+     */
+    alignas (CACHE_LINE_SIZE) char _padding;
+  };
+
+}
+#endif // __TRADEMGEN_BAS_SPSCRINGBUFFER_HPP
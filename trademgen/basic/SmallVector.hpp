@@ -0,0 +1,250 @@
+#ifndef __TRADEMGEN_BAS_SMALLVECTOR_HPP
+#define __TRADEMGEN_BAS_SMALLVECTOR_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+
+namespace TRADEMGEN {
+
+  /**
+   * Default number of elements stored inline by a SmallVector, which
+   * covers most of the distributions of the demand (e.g., 3 trip
+   * types, 4 channels).
+   */
+  const std::size_t DEFAULT_SMALL_VECTOR_INLINE_CAPACITY = 16;
+
+  /**
+   * @brief Array storing up to N elements within the object itself,
+   * and spilling over to the heap only beyond that size.
+   *
+   * It offers the subset of the std::vector interface used by the
+   * distribution tables. The elements must be default-constructible
+   * and copyable (e.g., numbers and codes), as the inline elements
+   * are all constructed along with the array.
+   */
+  template <typename T, std::size_t N = DEFAULT_SMALL_VECTOR_INLINE_CAPACITY>
+  class SmallVector {
+  public:
+    // ///////////// Type definitions //////////////
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef T& reference;
+    typedef const T& const_reference;
+
+
+  public:
+    // /////////////// Element access //////////
+    T& operator[] (const size_type idx) {
+      assert (idx < _size);
+      return _data[idx];
+    }
+    const T& operator[] (const size_type idx) const {
+      assert (idx < _size);
+      return _data[idx];
+    }
+
+    /**
+     * Access with bound check (std::out_of_range is thrown otherwise,
+     * as by std::vector).
+     */
+    T& at (const size_type idx) {
+      checkIndex (idx);
+      return _data[idx];
+    }
+    const T& at (const size_type idx) const {
+      checkIndex (idx);
+      return _data[idx];
+    }
+
+    T& front() { assert (_size != 0); return _data[0]; }
+    const T& front() const { assert (_size != 0); return _data[0]; }
+    T& back() { assert (_size != 0); return _data[_size - 1]; }
+    const T& back() const { assert (_size != 0); return _data[_size - 1]; }
+
+    T* data() { return _data; }
+    const T* data() const { return _data; }
+
+    iterator begin() { return _data; }
+    const_iterator begin() const { return _data; }
+    iterator end() { return _data + _size; }
+    const_iterator end() const { return _data + _size; }
+
+
+  public:
+    // /////////////// Capacity //////////
+    size_type size() const { return _size; }
+    bool empty() const { return (_size == 0); }
+    size_type capacity() const { return _capacity; }
+
+    /**
+     * State whether the elements are stored within the object itself.
+     */
+    bool isInline() const { return (_data == _inlineArray); }
+
+    /**
+     * Make room for the given number of elements (on the heap, when
+     * beyond the inline capacity).
+     */
+    void reserve (const size_type iCapacity) {
+      if (iCapacity <= _capacity) {
+        return;
+      }
+      T* lData = new T[iCapacity];
+      std::copy (_data, _data + _size, lData);
+      release();
+      _data = lData;
+      _capacity = iCapacity;
+    }
+
+
+  public:
+    // /////////////// Modifiers //////////
+    void clear() { _size = 0; }
+
+    void push_back (const T& iValue) {
+      if (_size == _capacity) {
+        // Copy the value first, as it may belong to the array itself.
+        const T lValue (iValue);
+        reserve (2 * _capacity);
+        _data[_size++] = lValue;
+        return;
+      }
+      _data[_size++] = iValue;
+    }
+
+    void pop_back() {
+      assert (_size != 0);
+      --_size;
+    }
+
+    void resize (const size_type iSize, const T& iValue = T()) {
+      reserve (iSize);
+      std::fill (_data + std::min (_size, iSize), _data + iSize, iValue);
+      _size = iSize;
+    }
+
+    void assign (const size_type iSize, const T& iValue) {
+      clear();
+      resize (iSize, iValue);
+    }
+
+    template <typename INPUT_ITERATOR>
+    void assign (INPUT_ITERATOR iFirst, INPUT_ITERATOR iLast) {
+      clear();
+      for ( ; iFirst != iLast; ++iFirst) {
+        push_back (*iFirst);
+      }
+    }
+
+
+  public:
+    // /////////////// Comparison //////////
+    bool operator== (const SmallVector& iSV) const {
+      return (_size == iSV._size && std::equal (begin(), end(), iSV.begin()));
+    }
+
+    bool operator!= (const SmallVector& iSV) const {
+      return !(*this == iSV);
+    }
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Default constructor (empty array).
+     */
+    SmallVector() : _data (_inlineArray), _size (0), _capacity (N) {
+    }
+
+    /**
+     * Constructor (array of the given size, filled with the given value).
+     */
+    explicit SmallVector (const size_type iSize, const T& iValue = T())
+      : _data (_inlineArray), _size (0), _capacity (N) {
+      resize (iSize, iValue);
+    }
+
+    /**
+     * Copy constructor.
+     */
+    SmallVector (const SmallVector& iSV)
+      : _data (_inlineArray), _size (0), _capacity (N) {
+      reserve (iSV._size);
+      std::copy (iSV.begin(), iSV.end(), _data);
+      _size = iSV._size;
+    }
+
+    /**
+     * Copy operator.
+     */
+    SmallVector& operator= (const SmallVector& iSV) {
+      if (this != &iSV) {
+        clear();
+        reserve (iSV._size);
+        std::copy (iSV.begin(), iSV.end(), _data);
+        _size = iSV._size;
+      }
+      return *this;
+    }
+
+    /**
+     * Destructor.
+     */
+    ~SmallVector() {
+      release();
+    }
+
+
+  private:
+    /**
+     * Free the heap storage, if any.
+     */
+    void release() {
+      if (_data != _inlineArray) {
+        delete[] _data;
+      }
+    }
+
+    /**
+     * Check that the given index is within the array.
+     */
+    void checkIndex (const size_type idx) const {
+      if (idx >= _size) {
+        throw std::out_of_range ("SmallVector: index out of range");
+      }
+    }
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Elements (either the inline ones or the heap ones).
+     */
+    T* _data;
+
+    /**
+     * Number of elements.
+     */
+    size_type _size;
+
+    /**
+     * Number of elements which can be stored without reallocation.
+     */
+    size_type _capacity;
+
+    /**
+     * Inline storage.
+     */
+    T _inlineArray[N];
+  };
+
+}
+#endif // __TRADEMGEN_BAS_SMALLVECTOR_HPP
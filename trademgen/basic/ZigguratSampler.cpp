@@ -0,0 +1,217 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cmath>
+// TraDemGen
+#include <trademgen/basic/CounterBasedRandomGeneration.hpp>
+#include <trademgen/basic/ZigguratSampler.hpp>
+
+namespace TRADEMGEN {
+
+  // //////////////////////////////////////////////////////////////////////
+  struct ZigguratSampler::Layers {
+    /** Number of layers. */
+    static const unsigned int MAX_SIZE = 256;
+    unsigned int _size;
+
+    /** Beginning of the tail (right edge of the base layer). */
+    double _tailBound;
+
+    /** Right edges of the layers, from the base layer (the width of
+        which is stretched so as to account for the tail) to the top. */
+    double _edgeArray[MAX_SIZE + 1];
+
+    /** Ratios of the right edge of the layer above to the one of the
+        layer itself, i.e., the probability to fall within the inner
+        rectangle of the layer. */
+    double _ratioArray[MAX_SIZE];
+
+    /** Values of the density at the right edges. */
+    double _densityArray[MAX_SIZE + 1];
+
+    // ////////////////////////////////////////////////////////////////////
+    static double getDensity (const EN_Density& iDensity, const double& iX) {
+      if (iDensity == EXPONENTIAL) {
+        return std::exp (-iX);
+      }
+      return std::exp (-0.5 * iX * iX);
+    }
+
+    // ////////////////////////////////////////////////////////////////////
+    static double getInverseDensity (const EN_Density& iDensity,
+                                     const double& iY) {
+      if (iDensity == EXPONENTIAL) {
+        return -std::log (iY);
+      }
+      return std::sqrt (-2.0 * std::log (iY));
+    }
+
+    // ////////////////////////////////////////////////////////////////////
+    Layers (const EN_Density& iDensity, const unsigned int iSize,
+            const double& iTailBound, const double& iLayerArea)
+      : _size (iSize), _tailBound (iTailBound) {
+      assert (_size <= MAX_SIZE);
+
+      // The layers are stacked from the base one, each having the same
+      // area (the base layer including the tail).
+      _edgeArray[0] = iLayerArea / getDensity (iDensity, iTailBound);
+      _edgeArray[1] = iTailBound;
+      for (unsigned int idx = 1; idx + 1 < _size; ++idx) {
+        _edgeArray[idx + 1] =
+          getInverseDensity (iDensity, getDensity (iDensity, _edgeArray[idx])
+                             + iLayerArea / _edgeArray[idx]);
+      }
+      _edgeArray[_size] = 0.0;
+
+      for (unsigned int idx = 0; idx < _size; ++idx) {
+        _ratioArray[idx] = _edgeArray[idx + 1] / _edgeArray[idx];
+      }
+      for (unsigned int idx = 0; idx <= _size; ++idx) {
+        _densityArray[idx] = getDensity (iDensity, _edgeArray[idx]);
+      }
+      _densityArray[_size] = 1.0;
+    }
+  };
+
+  // //////////////////////////////////////////////////////////////////////
+  ZigguratSampler::ZigguratSampler (const EN_Density& iDensity)
+    : _density (iDensity), _layers (NULL) {
+    // The layer parameters are the ones given by G. Marsaglia and
+    // W. W. Tsang (256 layers for the exponential density, 128 layers
+    // for the normal one).
+    static const Layers lExponentialLayers (EXPONENTIAL, 256,
+                                            7.697117470131487,
+                                            3.949659822581572e-3);
+    static const Layers lNormalLayers (NORMAL, 128, 3.442619855899,
+                                       9.91256303526217e-3);
+    switch (_density) {
+    case EXPONENTIAL: _layers = &lExponentialLayers; break;
+    case NORMAL: _layers = &lNormalLayers; break;
+    default: assert (false); break;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  double ZigguratSampler::generateUniform (stdair::BaseGenerator_T& ioGenerator) {
+    const double lMin = static_cast<double> (ioGenerator.min());
+    const double lRange = static_cast<double> (ioGenerator.max()) - lMin + 1.0;
+    return (static_cast<double> (ioGenerator()) - lMin) / lRange;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  double ZigguratSampler::
+  generateUniform (CounterBasedRandomGeneration& ioGenerator) {
+    return ioGenerator.generateUniform01();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  template <typename GENERATOR>
+  double ZigguratSampler::generateStandard (GENERATOR& ioGenerator) const {
+    assert (_layers != NULL);
+    const Layers& lLayers = *_layers;
+
+    // For the normal density, the sign is drawn along with the layer.
+    const unsigned int lNbOfSlots =
+      (_density == NORMAL) ? 2 * lLayers._size : lLayers._size;
+
+    while (true) {
+      // A single uniform variate gives both the layer and the position
+      // within that layer.
+      const double lPosition = generateUniform (ioGenerator) * lNbOfSlots;
+      const unsigned int lSlot = static_cast<unsigned int> (lPosition);
+      const double lFraction = lPosition - lSlot;
+      const unsigned int idx = (_density == NORMAL) ? (lSlot >> 1) : lSlot;
+      const double lSign = (_density == NORMAL && (lSlot & 1) != 0) ? -1.0 : 1.0;
+      assert (idx < lLayers._size);
+
+      // Most of the time, the point falls within the inner rectangle.
+      const double lX = lFraction * lLayers._edgeArray[idx];
+      if (lFraction < lLayers._ratioArray[idx]) {
+        return lSign * lX;
+      }
+
+      // Base layer: the point falls within the tail.
+      if (idx == 0) {
+        return lSign * generateTail (ioGenerator);
+      }
+
+      // Otherwise, the point falls within the wedge, between the inner
+      // rectangle and the density.
+      const double lY = lLayers._densityArray[idx]
+        + generateUniform (ioGenerator)
+        * (lLayers._densityArray[idx + 1] - lLayers._densityArray[idx]);
+      if (lY < Layers::getDensity (_density, lX)) {
+        return lSign * lX;
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  template <typename GENERATOR>
+  double ZigguratSampler::generateTail (GENERATOR& ioGenerator) const {
+    const double& lTailBound = _layers->_tailBound;
+
+    // The exponential distribution is memoryless.
+    if (_density == EXPONENTIAL) {
+      return lTailBound + generateStandard (ioGenerator);
+    }
+
+    // Marsaglia's method for the normal tail.
+    while (true) {
+      const double lX =
+        -std::log1p (-generateUniform (ioGenerator)) / lTailBound;
+      const double lY = -std::log1p (-generateUniform (ioGenerator));
+      if (2.0 * lY > lX * lX) {
+        return lTailBound + lX;
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  double ZigguratSampler::operator() (stdair::BaseGenerator_T& ioGenerator) const {
+    return generateStandard (ioGenerator);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  double ZigguratSampler::
+  operator() (CounterBasedRandomGeneration& ioGenerator) const {
+    return generateStandard (ioGenerator);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  double ZigguratSampler::
+  generateExponential (stdair::BaseGenerator_T& ioGenerator,
+                       const double& iRate) const {
+    assert (_density == EXPONENTIAL);
+    assert (iRate > 0.0);
+    return generateStandard (ioGenerator) / iRate;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  double ZigguratSampler::
+  generateExponential (CounterBasedRandomGeneration& ioGenerator,
+                       const double& iRate) const {
+    assert (_density == EXPONENTIAL);
+    assert (iRate > 0.0);
+    return generateStandard (ioGenerator) / iRate;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  double ZigguratSampler::generateNormal (stdair::BaseGenerator_T& ioGenerator,
+                                          const double& iMean,
+                                          const double& iStdDev) const {
+    assert (_density == NORMAL);
+    return iMean + iStdDev * generateStandard (ioGenerator);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  double ZigguratSampler::
+  generateNormal (CounterBasedRandomGeneration& ioGenerator,
+                  const double& iMean, const double& iStdDev) const {
+    assert (_density == NORMAL);
+    return iMean + iStdDev * generateStandard (ioGenerator);
+  }
+
+}
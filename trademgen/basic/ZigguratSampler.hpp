@@ -0,0 +1,115 @@
+#ifndef __TRADEMGEN_BAS_ZIGGURATSAMPLER_HPP
+#define __TRADEMGEN_BAS_ZIGGURATSAMPLER_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// StdAir
+#include <stdair/stdair_maths_types.hpp>
+
+namespace TRADEMGEN {
+
+  // Forward declarations
+  class CounterBasedRandomGeneration;
+
+  /**
+   * @brief Ziggurat sampler (as described by G. Marsaglia and
+   * W. W. Tsang) for the standard exponential and normal
+   * distributions.
+   *
+   * The density is covered by horizontal layers of equal area. Most
+   * of the time, a single uniform variate selects a layer and falls
+   * within its inner rectangle, so that neither logarithm nor square
+   * root is computed. The layers are computed once for all and shared
+   * by all the samplers, which are therefore cheap to build and to
+   * copy.
+   */
+  class ZigguratSampler {
+  public:
+    // ///////////// Type definitions //////////////
+    /**
+     * Supported densities.
+     */
+    typedef enum {
+      EXPONENTIAL = 0,
+      NORMAL,
+      LAST_VALUE
+    } EN_Density;
+
+    /**
+     * Layers of the ziggurat.
+     */
+    struct Layers;
+
+
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Draw a standard variate, i.e., an exponential variate of rate 1
+     * or a normal variate of mean 0 and standard deviation 1.
+     */
+    double operator() (stdair::BaseGenerator_T&) const;
+    double operator() (CounterBasedRandomGeneration&) const;
+
+    /**
+     * Draw an exponential variate of the given rate. The sampler must
+     * be an exponential one.
+     */
+    double generateExponential (stdair::BaseGenerator_T&,
+                                const double& iRate) const;
+    double generateExponential (CounterBasedRandomGeneration&,
+                                const double& iRate) const;
+
+    /**
+     * Draw a normal variate of the given mean and standard deviation.
+     * The sampler must be a normal one.
+     */
+    double generateNormal (stdair::BaseGenerator_T&, const double& iMean,
+                           const double& iStdDev) const;
+    double generateNormal (CounterBasedRandomGeneration&, const double& iMean,
+                           const double& iStdDev) const;
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     */
+    explicit ZigguratSampler (const EN_Density&);
+
+
+  private:
+    /**
+     * Draw a uniform variate within [0, 1).
+     */
+    static double generateUniform (stdair::BaseGenerator_T&);
+    static double generateUniform (CounterBasedRandomGeneration&);
+
+    /**
+     * Draw a standard variate from the given uniform generator.
+     */
+    template <typename GENERATOR>
+    double generateStandard (GENERATOR&) const;
+
+    /**
+     * Draw a variate within the tail, beyond the base layer.
+     */
+    template <typename GENERATOR>
+    double generateTail (GENERATOR&) const;
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Density.
+     */
+    EN_Density _density;
+
+    /**
+     * Layers (shared by all the samplers of the same density).
+     */
+    const Layers* _layers;
+  };
+
+}
+#endif // __TRADEMGEN_BAS_ZIGGURATSAMPLER_HPP
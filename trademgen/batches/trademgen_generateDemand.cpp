@@ -9,6 +9,8 @@
 #include <list>
 #include <string>
 //  //// Boost (Extended STL) ////
+// Boost Shared Pointer
+#include <boost/make_shared.hpp>
 // Boost Tokeniser
 #include <boost/tokenizer.hpp>
 // Boost Program Options
@@ -33,6 +35,8 @@
 #include <stdair/service/Logger.hpp>
 // TraDemGen
 #include <trademgen/TRADEMGEN_Service.hpp>
+#include <trademgen/bom/BookingRequestConsumer.hpp>
+#include <trademgen/bom/LogTraceSink.hpp>
 #include <trademgen/config/trademgen-paths.hpp>
 
 // Aliases for namespaces
@@ -50,6 +54,35 @@ typedef ba::accumulator_set<double,
                                       ba::tag::sum,
                                       ba::tag::variance> > stat_acc_type;
 
+/**
+ * Type definition for the (Boost) progress display.
+ */
+#if BOOST_VERSION_MACRO >= 107200
+typedef boost::timer::progress_display progress_display_type;
+#else  // if BOOST_VERSION_MACRO >= 107200
+typedef boost::progress_display progress_display_type;
+#endif // if BOOST_VERSION_MACRO >= 107200
+
+/**
+ * Consumer of the generated booking requests, which just updates the
+ * progress display (the requests are traced in the log by TraDemGen).
+ */
+class ProgressDisplayConsumer : public TRADEMGEN::BookingRequestConsumer {
+public:
+  ProgressDisplayConsumer (progress_display_type& ioProgressDisplay)
+    : _progressDisplay (ioProgressDisplay) {
+  }
+
+  bool consume (const TRADEMGEN::DemandStream&,
+                const TRADEMGEN::BookingRequestRecord&) {
+    ++_progressDisplay;
+    return true;
+  }
+
+private:
+  progress_display_type& _progressDisplay;
+};
+
 // //////// Constants //////
 /**
  * Default name and location for the log file.
@@ -296,111 +329,33 @@ void generateDemand (TRADEMGEN::TRADEMGEN_Service& ioTrademgenService,
     ioTrademgenService.getExpectedTotalNumberOfRequestsToBeGenerated();
 
   // Initialise the (Boost) progress display object
-#if BOOST_VERSION_MACRO >= 107200
-  boost::timer::progress_display
-#else  // if BOOST_VERSION_MACRO >= 107200
-  boost::progress_display
-#endif // if BOOST_VERSION_MACRO >= 107200
-	  lProgressDisplay (lExpectedNbOfEventsToBeGenerated
-                            * iNbOfRuns);
+  progress_display_type lProgressDisplay (lExpectedNbOfEventsToBeGenerated
+                                          * iNbOfRuns);
+  ProgressDisplayConsumer lProgressDisplayConsumer (lProgressDisplay);
   
   for (NbOfRuns_T runIdx = 1; runIdx <= iNbOfRuns; ++runIdx) {
     // /////////////////////////////////////////////////////
     output << "Run number: " << runIdx << std::endl;
 
     /**
-       Initialisation step.
-       <br>Generate the first event for each demand stream.
+       Generate all the requests of all the demand streams, in the
+       order of their date-times.
     */
+    const stdair::Count_T lNbOfGeneratedEvents =
+      ioTrademgenService.generateAll (lProgressDisplayConsumer,
+                                      iDemandGenerationMethod);
+
+    // Retrieve the actual number of events to be generated, as drawn
+    // for all the demand streams (some of them may fall after the
+    // preferred departure date-times, and not be generated)
     const stdair::Count_T& lActualNbOfEventsToBeGenerated =
-      ioTrademgenService.generateFirstRequests (iDemandGenerationMethod);
+      ioTrademgenService.getActualTotalNumberOfRequestsToBeGenerated();
 
     // DEBUG
     STDAIR_LOG_DEBUG ("[" << runIdx << "] Expected: "
                       << lExpectedNbOfEventsToBeGenerated << ", actual: "
-                      << lActualNbOfEventsToBeGenerated);
-      
-    /**
-       Main loop.
-       <ul>
-       <li>Pop a request and get its associated type/demand stream.</li>
-       <li>Generate the next request for the same type/demand stream.</li>
-       </ul>
-    */
-    while (ioTrademgenService.isQueueDone() == false) {
-
-      // Extract the next event from the event queue
-      stdair::EventStruct lEventStruct;
-      stdair::ProgressStatusSet lProgressStatusSet =
-        ioTrademgenService.popEvent (lEventStruct);
-      
-      // DEBUG
-      // STDAIR_LOG_DEBUG ("[" << runIdx << "] Poped event: '"
-      //                   << lEventStruct.describe() << "'.");
-      
-      // Extract the corresponding demand/booking request
-      const stdair::BookingRequestStruct& lPoppedRequest =
-        lEventStruct.getBookingRequest();
-        
-      // DEBUG
-      STDAIR_LOG_DEBUG ("[" << runIdx << "] Poped booking request: '"
-                        << lPoppedRequest.describe() << "'.");
-    
-      // Dump the request into the dedicated CSV file
-      // stdair::BomDisplay::csvDisplay (output, lPoppedRequest);
-        
-      // Retrieve the corresponding demand stream key
-      const stdair::DemandGeneratorKey_T& lDemandStreamKey =
-        lPoppedRequest.getDemandGeneratorKey();
-      
-      // Assess whether more events should be generated for that demand stream
-      const bool stillHavingRequestsToBeGenerated = ioTrademgenService.
-        stillHavingRequestsToBeGenerated (lDemandStreamKey,
-                                          lProgressStatusSet,
-                                          iDemandGenerationMethod);
-
-      // DEBUG
-      STDAIR_LOG_DEBUG (lProgressStatusSet.describe());
-      STDAIR_LOG_DEBUG ("=> [" << lDemandStreamKey << "] is now processed. "
-                        << "Still generate events for that demand stream? "
-                        << stillHavingRequestsToBeGenerated);
-    
-      // If there are still events to be generated for that demand stream,
-      // generate and add them to the event queue
-      if (stillHavingRequestsToBeGenerated == true) {
-        
-        stdair::BookingRequestPtr_T lNextRequest_ptr =
-          ioTrademgenService.generateNextRequest (lDemandStreamKey,
-                                                  iDemandGenerationMethod);
-        
-        assert (lNextRequest_ptr != NULL);
-
-        // Sanity check
-        const stdair::Duration_T lDuration =
-          lNextRequest_ptr->getRequestDateTime()
-          - lPoppedRequest.getRequestDateTime();
-        if (lDuration.total_milliseconds() < 0) {
-          STDAIR_LOG_ERROR ("[" << lDemandStreamKey
-                            << "] The date-time of the generated event ("
-                            << lNextRequest_ptr->getRequestDateTime()
-                            << ") is lower than the date-time "
-                            << "of the current event ("
-                            << lPoppedRequest.getRequestDateTime() << ")");
-          assert (false);
-        }
-
-        // DEBUG
-        STDAIR_LOG_DEBUG ("[" << lDemandStreamKey << "] Added request: '"
-                          << lNextRequest_ptr->describe()
-                          << "'. Is queue done? "
-                          << ioTrademgenService.isQueueDone());
-      }
-      // DEBUG
-      STDAIR_LOG_DEBUG ("");
-      
-      // Update the progress display
-      ++lProgressDisplay;
-    }
+                      << lActualNbOfEventsToBeGenerated << ", generated: "
+                      << lNbOfGeneratedEvents);
 
     // Add the number of events to the statistics accumulator
     lStatAccumulator (lActualNbOfEventsToBeGenerated);
@@ -472,6 +427,11 @@ int main (int argc, char* argv[]) {
   // Initialise the TraDemGen service object
   TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams, lRandomSeed);
 
+  // Notify the log of the generated booking requests, as expected by
+  // the trademgen_extractBookingRequests and
+  // trademgen_drawBookingArrivals tools
+  trademgenService.setTraceSink (boost::make_shared<TRADEMGEN::LogTraceSink>());
+
   // Check wether or not a (CSV) input file should be read
   if (isBuiltin == true) {
     // Create a sample DemandStream object, and insert it within the BOM tree
@@ -0,0 +1,148 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cstring>
+// TraDemGen
+#include <trademgen/bom/BookingRequestRecord.hpp>
+#include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/BinaryTraceSink.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  const char BinaryTraceSink::TIME_OF_REQUEST_TAG;
+  const char BinaryTraceSink::BOOKING_REQUEST_TAG;
+  const std::size_t BinaryTraceSink::DEFAULT_BUFFER_SIZE;
+  const std::size_t BinaryTraceSink::MAX_NB_OF_PENDING_BUFFERS;
+
+  // ////////////////////////////////////////////////////////////////////
+  BinaryTraceSink::BinaryTraceSink (std::ostream& ioOutputStream,
+                                    const std::size_t iBufferSize)
+    : _outputStream (ioOutputStream), _bufferSize (iBufferSize),
+      _currentBuffer (new Buffer_T), _isWriting (false), _mustStop (false) {
+    assert (_bufferSize > 0);
+    _currentBuffer->reserve (_bufferSize);
+
+    // Start the writer thread, once all the attributes are initialised
+    _writerThread = std::thread (&BinaryTraceSink::write, this);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  BinaryTraceSink::~BinaryTraceSink() {
+    flush();
+
+    {
+      std::lock_guard<std::mutex> lLock (_mutex);
+      _mustStop = true;
+    }
+    _pendingCondition.notify_one();
+    _writerThread.join();
+
+    delete _currentBuffer; _currentBuffer = NULL;
+    for (BufferList_T::iterator itBuffer = _freeBufferList.begin();
+         itBuffer != _freeBufferList.end(); ++itBuffer) {
+      delete *itBuffer;
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void BinaryTraceSink::traceTimeOfRequest (const DemandStream& iDemandStream,
+                                            const double iRefNumberOfDays) {
+    const DemandStreamHandle_T& lHandle = iDemandStream.getHandle();
+    char lBytes[sizeof (lHandle) + sizeof (iRefNumberOfDays)];
+    std::memcpy (lBytes, &lHandle, sizeof (lHandle));
+    std::memcpy (lBytes + sizeof (lHandle), &iRefNumberOfDays,
+                 sizeof (iRefNumberOfDays));
+    append (TIME_OF_REQUEST_TAG, lBytes, sizeof (lBytes));
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void BinaryTraceSink::
+  traceBookingRequest (const DemandStream&,
+                       const BookingRequestRecord& iBookingRequestRecord) {
+    append (BOOKING_REQUEST_TAG, &iBookingRequestRecord,
+            sizeof (iBookingRequestRecord));
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void BinaryTraceSink::append (const char iTag, const void* iBytes,
+                                const std::size_t iNbOfBytes) {
+    assert (_currentBuffer != NULL);
+    if (_currentBuffer->size() + 1 + iNbOfBytes > _bufferSize
+        && _currentBuffer->empty() == false) {
+      handOverCurrentBuffer();
+    }
+
+    const char* lBytes = static_cast<const char*> (iBytes);
+    _currentBuffer->push_back (iTag);
+    _currentBuffer->insert (_currentBuffer->end(), lBytes, lBytes + iNbOfBytes);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void BinaryTraceSink::handOverCurrentBuffer() {
+    std::unique_lock<std::mutex> lLock (_mutex);
+
+    // Wait for the writer thread, when it lags too much behind
+    while (_pendingBufferList.size() >= MAX_NB_OF_PENDING_BUFFERS) {
+      _writtenCondition.wait (lLock);
+    }
+
+    _pendingBufferList.push_back (_currentBuffer);
+    if (_freeBufferList.empty() == true) {
+      _currentBuffer = new Buffer_T;
+      _currentBuffer->reserve (_bufferSize);
+    } else {
+      _currentBuffer = _freeBufferList.front();
+      _freeBufferList.pop_front();
+    }
+
+    lLock.unlock();
+    _pendingCondition.notify_one();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void BinaryTraceSink::flush() {
+    if (_currentBuffer->empty() == false) {
+      handOverCurrentBuffer();
+    }
+
+    std::unique_lock<std::mutex> lLock (_mutex);
+    while (_pendingBufferList.empty() == false || _isWriting == true) {
+      _writtenCondition.wait (lLock);
+    }
+
+    // The writer thread is idle: the output stream may be used
+    _outputStream.flush();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void BinaryTraceSink::write() {
+    std::unique_lock<std::mutex> lLock (_mutex);
+    while (true) {
+      while (_pendingBufferList.empty() == true && _mustStop == false) {
+        _pendingCondition.wait (lLock);
+      }
+      if (_pendingBufferList.empty() == true) {
+        // There is nothing left to write, and the writer must stop
+        return;
+      }
+
+      Buffer_T* lBuffer_ptr = _pendingBufferList.front();
+      _pendingBufferList.pop_front();
+      _isWriting = true;
+
+      // Write the buffer without holding the lock
+      lLock.unlock();
+      _outputStream.write (&(*lBuffer_ptr)[0], lBuffer_ptr->size());
+      lBuffer_ptr->clear();
+      lLock.lock();
+
+      _isWriting = false;
+      _freeBufferList.push_back (lBuffer_ptr);
+      _writtenCondition.notify_all();
+    }
+  }
+
+}
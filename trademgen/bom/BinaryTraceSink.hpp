@@ -0,0 +1,171 @@
+#ifndef __TRADEMGEN_BOM_BINARYTRACESINK_HPP
+#define __TRADEMGEN_BOM_BINARYTRACESINK_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cstddef>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+// TraDemGen
+#include <trademgen/bom/TraceSink.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Trace sink writing the raw records into an output stream,
+   * from a background writer thread.
+   *
+   * The records are appended to an in-memory buffer which, once
+   * full, is handed over to the writer thread, so that the demand
+   * generation does not wait for the output stream (unless the
+   * writer thread lags behind by more than a few buffers).
+   *
+   * Each record is made of a one-byte tag followed by its raw bytes,
+   * in the native byte order:
+   * <ul>
+   *  <li>TIME_OF_REQUEST_TAG, followed by the handle of the demand
+   *      stream (DemandStreamHandle_T) and the reference number of
+   *      days (double);</li>
+   *  <li>BOOKING_REQUEST_TAG, followed by the BookingRequestRecord.</li>
+   * </ul>
+   *
+   * \note The records must be traced by one thread at a time.
+   */
+  class BinaryTraceSink : public TraceSink {
+  public:
+    // ///////////// Type definitions //////////////
+    /** Tags of the records. */
+    static const char TIME_OF_REQUEST_TAG = 'T';
+    static const char BOOKING_REQUEST_TAG = 'B';
+
+    /** Default size of the buffers (in bytes). */
+    static const std::size_t DEFAULT_BUFFER_SIZE = 1 << 16;
+
+    /** Maximal number of full buffers waiting for the writer thread. */
+    static const std::size_t MAX_NB_OF_PENDING_BUFFERS = 4;
+
+
+  public:
+    // /////////////////// Business Methods ///////////////////
+    /** Trace the time of a request. */
+    void traceTimeOfRequest (const DemandStream&, const double);
+
+    /** Trace a generated request. */
+    void traceBookingRequest (const DemandStream&, const BookingRequestRecord&);
+
+    /**
+     * Wait until all the records traced so far have been written into
+     * (and flushed out of) the output stream.
+     */
+    void flush();
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param std::ostream& Output stream, which must outlive the trace sink.
+     * @param const std::size_t Size of the buffers (in bytes).
+     */
+    BinaryTraceSink (std::ostream&,
+                     const std::size_t iBufferSize = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * Destructor, writing the remaining records and stopping the
+     * writer thread.
+     */
+    ~BinaryTraceSink();
+
+  private:
+    /** Default constructor. */
+    BinaryTraceSink();
+    /** Copy constructor. */
+    BinaryTraceSink (const BinaryTraceSink&);
+
+
+  private:
+    // ///////////// Type definitions //////////////
+    typedef std::vector<char> Buffer_T;
+    typedef std::deque<Buffer_T*> BufferList_T;
+
+
+  private:
+    // /////////////////// Business Methods ///////////////////
+    /**
+     * Append the given bytes to the current buffer, handing it over to
+     * the writer thread when full.
+     */
+    void append (const char, const void*, const std::size_t);
+
+    /**
+     * Hand the current buffer over to the writer thread, and take a
+     * free one instead.
+     */
+    void handOverCurrentBuffer();
+
+    /**
+     * Main loop of the writer thread.
+     */
+    void write();
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Output stream (only used by the writer thread, but when flushing).
+     */
+    std::ostream& _outputStream;
+
+    /**
+     * Size of the buffers.
+     */
+    const std::size_t _bufferSize;
+
+    /**
+     * Buffer being filled by the demand generation.
+     */
+    Buffer_T* _currentBuffer;
+
+    /**
+     * Full buffers, waiting for the writer thread.
+     */
+    BufferList_T _pendingBufferList;
+
+    /**
+     * Buffers already written, ready to be filled again.
+     */
+    BufferList_T _freeBufferList;
+
+    /**
+     * Whether the writer thread is writing a buffer.
+     */
+    bool _isWriting;
+
+    /**
+     * Whether the writer thread must stop (once the pending buffers
+     * are written).
+     */
+    bool _mustStop;
+
+    /**
+     * Synchronisation between the demand generation and the writer thread.
+     */
+    std::mutex _mutex;
+    std::condition_variable _pendingCondition;
+    std::condition_variable _writtenCondition;
+
+    /**
+     * Writer thread.
+     */
+    std::thread _writerThread;
+  };
+
+}
+#endif // __TRADEMGEN_BOM_BINARYTRACESINK_HPP
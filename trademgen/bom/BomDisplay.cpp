@@ -12,6 +12,7 @@
 #include <sevmgr/SEVMGR_Types.hpp>
 // TraDemGen
 #include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamFamily.hpp>
 #include <trademgen/bom/BomDisplay.hpp>
 
 namespace TRADEMGEN {
@@ -58,26 +59,32 @@ namespace TRADEMGEN {
     oStream << "==============================================================="
             << std::endl;
 
-    // Check whether there are DemandStream objects
+    // Check whether there are DemandStreamFamily objects
     const bool hasEventGeneratorList =
-      iSEVMGR_ServicePtr->hasEventGeneratorList<DemandStream>();
+      iSEVMGR_ServicePtr->hasEventGeneratorList<DemandStreamFamily>();
     if (hasEventGeneratorList == false) {
       return oStream.str();
     }
     
-    // Retrieve the DemandStream list
-    const DemandStreamList_T& lDemandStreamList =
-      iSEVMGR_ServicePtr->getEventGeneratorList<DemandStream>();
+    // Retrieve the DemandStreamFamily list
+    const DemandStreamFamilyList_T& lDemandStreamFamilyList =
+      iSEVMGR_ServicePtr->getEventGeneratorList<DemandStreamFamily>();
 
-    // Browse the inventories
-    for (DemandStreamList_T::const_iterator itDemandStream =
-           lDemandStreamList.begin();
-         itDemandStream != lDemandStreamList.end(); ++itDemandStream) {
-      DemandStream* lDemandStream_ptr = *itDemandStream;
-      assert (lDemandStream_ptr != NULL);
+    // Browse the families, then their demand streams (one per date)
+    for (DemandStreamFamilyList_T::const_iterator itFamily =
+           lDemandStreamFamilyList.begin();
+         itFamily != lDemandStreamFamilyList.end(); ++itFamily) {
+      const DemandStreamFamily* lDemandStreamFamily_ptr = *itFamily;
+      assert (lDemandStreamFamily_ptr != NULL);
 
-      // Display the demand stream
-      csvDisplay (oStream, *lDemandStream_ptr);
+      const DemandStreamFamily::DemandStreamList_T& lDemandStreamList =
+        lDemandStreamFamily_ptr->getDemandStreamList();
+      for (DemandStreamFamily::DemandStreamList_T::const_iterator itDemandStream =
+             lDemandStreamList.begin();
+           itDemandStream != lDemandStreamList.end(); ++itDemandStream) {
+        // Display the demand stream
+        csvDisplay (oStream, *itDemandStream);
+      }
     }
 
     return oStream.str();
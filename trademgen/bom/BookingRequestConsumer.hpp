@@ -0,0 +1,44 @@
+#ifndef __TRADEMGEN_BOM_BOOKINGREQUESTCONSUMER_HPP
+#define __TRADEMGEN_BOM_BOOKINGREQUESTCONSUMER_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// TraDemGen
+#include <trademgen/TRADEMGEN_Types.hpp>
+
+namespace TRADEMGEN {
+
+  // Forward declarations
+  class DemandStream;
+  struct BookingRequestRecord;
+
+  /**
+   * @brief Interface receiving the booking requests, in the order of
+   * their date-times, from TRADEMGEN_Service::generateAll().
+   *
+   * The requests are handed over as compact records; when needed, the
+   * full booking request structure is obtained with
+   * DemandStream::createBookingRequest().
+   */
+  class BookingRequestConsumer {
+  public:
+    /**
+     * Consume a booking request.
+     *
+     * @param const DemandStream& Demand stream having generated the request.
+     * @param const BookingRequestRecord& Record of the request.
+     * @return bool Whether the generation must go on (when false, it
+     *   stops right away).
+     */
+    virtual bool consume (const DemandStream&, const BookingRequestRecord&) = 0;
+
+    /**
+     * Destructor.
+     */
+    virtual ~BookingRequestConsumer() {
+    }
+  };
+
+}
+#endif // __TRADEMGEN_BOM_BOOKINGREQUESTCONSUMER_HPP
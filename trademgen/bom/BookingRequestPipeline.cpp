@@ -0,0 +1,132 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// TraDemGen
+#include <trademgen/bom/BookingRequestPipeline.hpp>
+#include <trademgen/bom/BookingRequestRange.hpp>
+#include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamRegistry.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  const std::size_t BookingRequestPipeline::DEFAULT_CAPACITY;
+
+  // ////////////////////////////////////////////////////////////////////
+  BookingRequestPipeline::
+  BookingRequestPipeline (const DemandStreamRegistry& iDemandStreamRegistry,
+                          const stdair::DemandGenerationMethod& iDemandGenerationMethod,
+                          const std::size_t iCapacity,
+                          const DemandStreamHandle_T iFirstHandle,
+                          const DemandStreamHandle_T iHandleStride)
+    : _demandStreamRegistry (iDemandStreamRegistry),
+      _demandGenerationMethod (iDemandGenerationMethod),
+      _firstHandle (iFirstHandle), _handleStride (iHandleStride),
+      _ringBuffer (iCapacity), _mustStop (false), _isOver (false) {
+    // The generator thread is started once everything else is ready
+    _generatorThread = std::thread (&BookingRequestPipeline::generate, this);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  BookingRequestPipeline::~BookingRequestPipeline() {
+    stop();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void BookingRequestPipeline::stop() {
+    _mustStop.store (true, std::memory_order_relaxed);
+    if (_generatorThread.joinable() == true) {
+      _generatorThread.join();
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void BookingRequestPipeline::generate() {
+    try {
+      BookingRequestRange lBookingRequestRange (_demandStreamRegistry,
+                                                _demandGenerationMethod,
+                                                _firstHandle, _handleStride);
+
+      // The generation method is dispatched once for the whole run
+      const stdair::DemandGenerationMethod::EN_DemandGenerationMethod& lENDemandGenerationMethod =
+        _demandGenerationMethod.getMethod();
+      switch (lENDemandGenerationMethod) {
+      case stdair::DemandGenerationMethod::POI_PRO:
+        generateWith<DemandStream::PoissonProcessMethod> (lBookingRequestRange);
+        break;
+      case stdair::DemandGenerationMethod::STA_ORD:
+        generateWith<DemandStream::StatisticsOrderMethod> (lBookingRequestRange);
+        break;
+      default: assert (false); break;
+      }
+
+    } catch (...) {
+      _exception = std::current_exception();
+    }
+
+    // Publish the last requests (and the exception, if any)
+    _isOver.store (true, std::memory_order_release);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  template <typename GENERATION_METHOD>
+  void BookingRequestPipeline::
+  generateWith (BookingRequestRange& ioBookingRequestRange) {
+    for ( ; ioBookingRequestRange.empty() == false;
+         ioBookingRequestRange.nextWith<GENERATION_METHOD>()) {
+      // Back-pressure: wait for the consumer to make room
+      while (_ringBuffer.tryPush (ioBookingRequestRange.front()) == false) {
+        if (_mustStop.load (std::memory_order_relaxed) == true) {
+          break;
+        }
+        std::this_thread::yield();
+      }
+
+      if (_mustStop.load (std::memory_order_relaxed) == true) {
+        break;
+      }
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  bool BookingRequestPipeline::pop (BookingRequestRecord& ioBookingRequestRecord) {
+    if (_mustStop.load (std::memory_order_relaxed) == true) {
+      return false;
+    }
+
+    while (_ringBuffer.tryPop (ioBookingRequestRecord) == false) {
+      if (_isOver.load (std::memory_order_acquire) == true) {
+        // The generator thread may have pushed its last requests right
+        // before it was over
+        if (_ringBuffer.tryPop (ioBookingRequestRecord) == true) {
+          return true;
+        }
+
+        if (_exception != NULL) {
+          std::exception_ptr lException = _exception;
+          _exception = NULL;
+          std::rethrow_exception (lException);
+        }
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const DemandStream& BookingRequestPipeline::
+  getDemandStream (const BookingRequestRecord& iBookingRequestRecord) const {
+    // The list of the demand streams is left untouched by the generation
+    const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+      _demandStreamRegistry.getDemandStreamList();
+    assert (iBookingRequestRecord._demandStreamHandle < lDemandStreamList.size());
+    const DemandStream* lDemandStream_ptr =
+      lDemandStreamList[iBookingRequestRecord._demandStreamHandle];
+    assert (lDemandStream_ptr != NULL);
+    return *lDemandStream_ptr;
+  }
+
+}
@@ -0,0 +1,175 @@
+#ifndef __TRADEMGEN_BOM_BOOKINGREQUESTPIPELINE_HPP
+#define __TRADEMGEN_BOM_BOOKINGREQUESTPIPELINE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cstddef>
+#include <atomic>
+#include <exception>
+#include <thread>
+// StdAir
+#include <stdair/basic/DemandGenerationMethod.hpp>
+// TraDemGen
+#include <trademgen/TRADEMGEN_Types.hpp>
+#include <trademgen/basic/SPSCRingBuffer.hpp>
+#include <trademgen/bom/BookingRequestRecord.hpp>
+
+namespace TRADEMGEN {
+
+  // Forward declarations
+  class BookingRequestRange;
+  class DemandStream;
+  class DemandStreamRegistry;
+
+  /**
+   * @brief Generation of the booking requests of all (or a share of)
+   * the demand streams of a registry by a dedicated generator thread,
+   * for another (consumer) thread.
+   *
+   * The generator thread iterates over a BookingRequestRange, and
+   * fills a bounded lock-free ring with the requests, in the order of
+   * their date-times; the consumer thread drains the ring with pop().
+   * When the ring is full, the generator thread waits for the consumer
+   * (back-pressure), so that it is never more than the capacity of the
+   * ring ahead.
+   *
+   * \note While the pipeline lives, the demand streams (and their
+   *       trace sinks) are used by the generator thread: the consumer
+   *       thread must stick to DemandStream::createBookingRequest().
+   *       As for BookingRequestRange, TRADEMGEN_Service::reset() must
+   *       be called before any other generation.
+   */
+  class BookingRequestPipeline {
+  public:
+    // ///////////// Type definitions //////////////
+    /** Default number of requests within the ring. */
+    static const std::size_t DEFAULT_CAPACITY = 4096;
+
+
+  public:
+    // /////////////////// Business Methods ///////////////////
+    /**
+     * Extract the next request, waiting for the generator thread when
+     * needed (to be called by the consumer thread only).
+     *
+     * \note An exception thrown by the generation is thrown again here.
+     *
+     * @param BookingRequestRecord& Record of the extracted request.
+     * @return bool Whether a request has been extracted (false once
+     *         all the requests have been extracted, or the pipeline
+     *         has been stopped).
+     */
+    bool pop (BookingRequestRecord&);
+
+    /**
+     * Get the demand stream having generated the given request.
+     */
+    const DemandStream& getDemandStream (const BookingRequestRecord&) const;
+
+    /**
+     * Stop the generator thread, which may not have generated all the
+     * requests, and wait for it. The requests not extracted yet are
+     * dropped.
+     */
+    void stop();
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor, starting the generator thread.
+     *
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     * @param const stdair::DemandGenerationMethod& Method used to
+     *        generate the date-times of the requests.
+     * @param const std::size_t Number of requests within the ring.
+     * @param const DemandStreamHandle_T Handle of the first demand
+     *        stream to be generated.
+     * @param const DemandStreamHandle_T Stride between the handles of
+     *        the demand streams to be generated (see
+     *        BookingRequestRange).
+     */
+    BookingRequestPipeline (const DemandStreamRegistry&,
+                            const stdair::DemandGenerationMethod&,
+                            const std::size_t iCapacity = DEFAULT_CAPACITY,
+                            const DemandStreamHandle_T iFirstHandle = 0,
+                            const DemandStreamHandle_T iHandleStride = 1);
+
+    /**
+     * Destructor, stopping the generator thread.
+     */
+    ~BookingRequestPipeline();
+
+  private:
+    /** Copy constructor (not implemented). */
+    BookingRequestPipeline (const BookingRequestPipeline&);
+    /** Assignment operator (not implemented). */
+    BookingRequestPipeline& operator= (const BookingRequestPipeline&);
+
+
+  private:
+    // /////////////////// Business Methods ///////////////////
+    /**
+     * Generate all the requests into the ring (body of the generator
+     * thread).
+     */
+    void generate();
+
+    /**
+     * Generate all the requests of the range into the ring, with the
+     * path specialised for the given generation method.
+     */
+    template <typename GENERATION_METHOD>
+    void generateWith (BookingRequestRange&);
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Registry of the demand streams.
+     */
+    const DemandStreamRegistry& _demandStreamRegistry;
+
+    /**
+     * Method used to generate the date-times of the requests.
+     */
+    const stdair::DemandGenerationMethod _demandGenerationMethod;
+
+    /**
+     * Handle of the first demand stream to be generated, and stride
+     * between the handles of the demand streams to be generated.
+     */
+    const DemandStreamHandle_T _firstHandle;
+    const DemandStreamHandle_T _handleStride;
+
+    /**
+     * Requests generated but not extracted yet.
+     */
+    SPSCRingBuffer<BookingRequestRecord> _ringBuffer;
+
+    /**
+     * Set by the consumer thread, so that the generator thread stops.
+     */
+    std::atomic<bool> _mustStop;
+
+    /**
+     * Set by the generator thread, once it has pushed its last request.
+     */
+    std::atomic<bool> _isOver;
+
+    /**
+     * Exception thrown by the generation, if any (written by the
+     * generator thread before it sets _isOver).
+     */
+    std::exception_ptr _exception;
+
+    /**
+     * Generator thread.
+     */
+    std::thread _generatorThread;
+  };
+
+}
+#endif // __TRADEMGEN_BOM_BOOKINGREQUESTPIPELINE_HPP
@@ -0,0 +1,165 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// TraDemGen
+#include <trademgen/bom/BookingRequestRange.hpp>
+#include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamRegistry.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  BookingRequestRange::
+  BookingRequestRange (const DemandStreamRegistry& iDemandStreamRegistry,
+                       const stdair::DemandGenerationMethod& iDemandGenerationMethod,
+                       const DemandStreamHandle_T iFirstHandle,
+                       const DemandStreamHandle_T iHandleStride)
+    : _demandStreamRegistry_ptr (&iDemandStreamRegistry),
+      _demandStream_ptr (NULL), _hasCurrentRequest (false),
+      _nextFunction (NULL) {
+    assert (iHandleStride > 0);
+
+    // Select the generation path once for the whole range
+    const stdair::DemandGenerationMethod::EN_DemandGenerationMethod& lENDemandGenerationMethod =
+      iDemandGenerationMethod.getMethod();
+    switch (lENDemandGenerationMethod) {
+    case stdair::DemandGenerationMethod::POI_PRO:
+      _nextFunction =
+        &BookingRequestRange::nextWith<DemandStream::PoissonProcessMethod>;
+      initWith<DemandStream::PoissonProcessMethod> (iFirstHandle,
+                                                    iHandleStride);
+      break;
+    case stdair::DemandGenerationMethod::STA_ORD:
+      _nextFunction =
+        &BookingRequestRange::nextWith<DemandStream::StatisticsOrderMethod>;
+      initWith<DemandStream::StatisticsOrderMethod> (iFirstHandle,
+                                                     iHandleStride);
+      break;
+    default: assert (false); break;
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  BookingRequestRange::
+  BookingRequestRange (DemandStream& ioDemandStream,
+                       const stdair::DemandGenerationMethod& iDemandGenerationMethod)
+    : _demandStreamRegistry_ptr (NULL), _demandStream_ptr (&ioDemandStream),
+      _hasCurrentRequest (false), _nextFunction (NULL) {
+
+    ioDemandStream.setBoolFirstDateTimeRequest (true);
+
+    // Select the generation path once for the whole range
+    const stdair::DemandGenerationMethod::EN_DemandGenerationMethod& lENDemandGenerationMethod =
+      iDemandGenerationMethod.getMethod();
+    switch (lENDemandGenerationMethod) {
+    case stdair::DemandGenerationMethod::POI_PRO:
+      _nextFunction =
+        &BookingRequestRange::nextWith<DemandStream::PoissonProcessMethod>;
+      _hasCurrentRequest = generateNextRequestWith<DemandStream::
+        PoissonProcessMethod> (ioDemandStream, _currentRequestRecord);
+      break;
+    case stdair::DemandGenerationMethod::STA_ORD:
+      _nextFunction =
+        &BookingRequestRange::nextWith<DemandStream::StatisticsOrderMethod>;
+      _hasCurrentRequest = generateNextRequestWith<DemandStream::
+        StatisticsOrderMethod> (ioDemandStream, _currentRequestRecord);
+      break;
+    default: assert (false); break;
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  template <typename GENERATION_METHOD>
+  void BookingRequestRange::initWith (const DemandStreamHandle_T iFirstHandle,
+                                      const DemandStreamHandle_T iHandleStride) {
+    assert (_demandStreamRegistry_ptr != NULL);
+    const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+      _demandStreamRegistry_ptr->getDemandStreamList();
+
+    // Generate the first request of each demand stream, and fill the
+    // queue with all of them at once
+    CalendarQueue::BookingRequestRecordList_T lRequestList;
+    lRequestList.reserve (lDemandStreamList.size() / iHandleStride + 1);
+    BookingRequestRecord lBookingRequestRecord;
+    for (DemandStreamHandle_T lHandle = iFirstHandle;
+         lHandle < lDemandStreamList.size(); lHandle += iHandleStride) {
+      DemandStream* lDemandStream_ptr = lDemandStreamList[lHandle];
+      assert (lDemandStream_ptr != NULL);
+
+      lDemandStream_ptr->setBoolFirstDateTimeRequest (true);
+
+      if (generateNextRequestWith<GENERATION_METHOD> (*lDemandStream_ptr,
+                                                      lBookingRequestRecord)
+          == true) {
+        lRequestList.push_back (lBookingRequestRecord);
+      }
+    }
+    _requestQueue.push (lRequestList);
+
+    pop();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  template <typename GENERATION_METHOD>
+  bool BookingRequestRange::
+  generateNextRequestWith (DemandStream& ioDemandStream,
+                           BookingRequestRecord& ioBookingRequestRecord) {
+    if (ioDemandStream.
+        stillHavingRequestsToBeGeneratedWith<GENERATION_METHOD>() == false) {
+      return false;
+    }
+
+    ioDemandStream.
+      generateNextRequestWith<GENERATION_METHOD> (ioBookingRequestRecord);
+    return ioDemandStream.
+      isBeforePreferredDepartureDateTime (ioBookingRequestRecord);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void BookingRequestRange::pop() {
+    if (_requestQueue.empty() == true) {
+      _hasCurrentRequest = false;
+      return;
+    }
+
+    _currentRequestRecord = _requestQueue.pop();
+    assert (_demandStreamRegistry_ptr != NULL);
+    _demandStream_ptr = _demandStreamRegistry_ptr->
+      getDemandStreamList()[_currentRequestRecord._demandStreamHandle];
+    _hasCurrentRequest = true;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  template <typename GENERATION_METHOD>
+  void BookingRequestRange::nextWith() {
+    assert (_hasCurrentRequest == true && _demandStream_ptr != NULL);
+    assert (_nextFunction
+            == &BookingRequestRange::nextWith<GENERATION_METHOD>);
+
+    // Over a single demand stream, the next request is the current one
+    if (_demandStreamRegistry_ptr == NULL) {
+      _hasCurrentRequest =
+        generateNextRequestWith<GENERATION_METHOD> (*_demandStream_ptr,
+                                                    _currentRequestRecord);
+      return;
+    }
+
+    BookingRequestRecord lBookingRequestRecord;
+    if (generateNextRequestWith<GENERATION_METHOD> (*_demandStream_ptr,
+                                                    lBookingRequestRecord)
+        == true) {
+      _requestQueue.push (lBookingRequestRecord);
+    }
+    pop();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  // Paths of the two generation methods
+  template void BookingRequestRange::
+  nextWith<DemandStream::StatisticsOrderMethod>();
+  template void BookingRequestRange::
+  nextWith<DemandStream::PoissonProcessMethod>();
+
+}
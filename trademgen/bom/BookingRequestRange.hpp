@@ -0,0 +1,275 @@
+#ifndef __TRADEMGEN_BOM_BOOKINGREQUESTRANGE_HPP
+#define __TRADEMGEN_BOM_BOOKINGREQUESTRANGE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+// StdAir
+#include <stdair/basic/DemandGenerationMethod.hpp>
+// TraDemGen
+#include <trademgen/TRADEMGEN_Types.hpp>
+#include <trademgen/bom/BookingRequestRecord.hpp>
+#include <trademgen/bom/CalendarQueue.hpp>
+
+namespace TRADEMGEN {
+
+  // Forward declarations
+  class DemandStream;
+  class DemandStreamRegistry;
+
+  /**
+   * @brief Range of the booking requests of either all the demand
+   * streams of a registry or a single demand stream, in the order of
+   * their date-times (the ties being broken by the handles of the
+   * demand streams).
+   *
+   * The requests are generated lazily, one at a time, as the range is
+   * iterated over: advancing the iterator generates the next request
+   * of the demand stream having generated the current one, and picks
+   * the earliest pending request. No event is created along the way,
+   * and leaving the loop early leaves the remaining requests
+   * ungenerated.
+   *
+   * Typical use:
+   * \code
+   * BookingRequestRange lRange =
+   *   trademgenService.getBookingRequestRange (lDemandGenerationMethod);
+   * for (BookingRequestRange::iterator itRequest = lRange.begin();
+   *      itRequest != lRange.end(); ++itRequest) {
+   *   const DemandStream& lDemandStream = lRange.getDemandStream();
+   *   ...
+   * }
+   * \endcode
+   *
+   * The generation path specialised for the generation method (see
+   * DemandStream::generateNextRequestWith()) is selected once, when
+   * the range is built. The loops over a whole run, knowing the
+   * method at compile time, may also advance the range with
+   * nextWith(), so that the generation of each request is not
+   * dispatched at all.
+   *
+   * \note The range is single-pass (its iterators are input iterators),
+   *       and must outlive its iterators. As the demand streams are
+   *       advanced in place, TRADEMGEN_Service::reset() must be called
+   *       before any other generation.
+   */
+  class BookingRequestRange {
+  public:
+    /**
+     * @brief Input iterator over the booking requests of the range.
+     */
+    class iterator {
+    public:
+      // ///////////// Type definitions //////////////
+      typedef std::input_iterator_tag iterator_category;
+      typedef BookingRequestRecord value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const BookingRequestRecord* pointer;
+      typedef const BookingRequestRecord& reference;
+
+    public:
+      /** Get the current request. */
+      reference operator*() const {
+        assert (_range_ptr != NULL);
+        return _range_ptr->front();
+      }
+
+      /** Get the current request. */
+      pointer operator->() const {
+        return &(**this);
+      }
+
+      /** Move to the next request. */
+      iterator& operator++() {
+        assert (_range_ptr != NULL);
+        _range_ptr->next();
+        if (_range_ptr->empty() == true) {
+          _range_ptr = NULL;
+        }
+        return *this;
+      }
+
+      /** Move to the next request. */
+      void operator++ (int) {
+        ++*this;
+      }
+
+      /** Equality (all the exhausted iterators being equal). */
+      bool operator== (const iterator& iIterator) const {
+        return (_range_ptr == iIterator._range_ptr);
+      }
+
+      /** Inequality. */
+      bool operator!= (const iterator& iIterator) const {
+        return (_range_ptr != iIterator._range_ptr);
+      }
+
+    public:
+      /**
+       * Constructor (an iterator on no range being the end iterator).
+       */
+      explicit iterator (BookingRequestRange* ioRange_ptr = NULL)
+        : _range_ptr (ioRange_ptr) {
+      }
+
+    private:
+      /**
+       * Range being iterated over, or NULL once it is exhausted.
+       */
+      BookingRequestRange* _range_ptr;
+    };
+
+
+  public:
+    // ///////////// Iterators ///////////
+    /** Get an iterator on the current request. */
+    iterator begin() {
+      return iterator ((empty() == true) ? NULL : this);
+    }
+
+    /** Get the end iterator. */
+    iterator end() {
+      return iterator();
+    }
+
+
+  public:
+    // ///////////// Getters ///////////
+    /** State whether all the requests have been generated. */
+    bool empty() const {
+      return (_hasCurrentRequest == false);
+    }
+
+    /** Get the current request (the range must not be empty). */
+    const BookingRequestRecord& front() const {
+      assert (_hasCurrentRequest == true);
+      return _currentRequestRecord;
+    }
+
+    /**
+     * Get the demand stream having generated the current request (the
+     * range must not be empty).
+     */
+    DemandStream& getDemandStream() const {
+      assert (_hasCurrentRequest == true && _demandStream_ptr != NULL);
+      return *_demandStream_ptr;
+    }
+
+
+  public:
+    // /////////////////// Business Methods ///////////////////
+    /**
+     * Generate the next request of the demand stream having generated
+     * the current one, and move to the earliest pending request (the
+     * range must not be empty).
+     */
+    void next() {
+      (this->*_nextFunction)();
+    }
+
+    /**
+     * Same as next(), with the path specialised for the given
+     * generation method (DemandStream::StatisticsOrderMethod or
+     * DemandStream::PoissonProcessMethod), which must be the one the
+     * range has been built with.
+     */
+    template <typename GENERATION_METHOD>
+    void nextWith();
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor, over all the demand streams of the registry. The
+     * first request of every demand stream is generated right away.
+     *
+     * A range may also be restricted to every iHandleStride-th demand
+     * stream, from the one of handle iFirstHandle (e.g., to share the
+     * demand streams among several generator threads).
+     */
+    BookingRequestRange (const DemandStreamRegistry&,
+                         const stdair::DemandGenerationMethod&,
+                         const DemandStreamHandle_T iFirstHandle = 0,
+                         const DemandStreamHandle_T iHandleStride = 1);
+
+    /**
+     * Constructor, over a single demand stream. Its first request is
+     * generated right away.
+     */
+    BookingRequestRange (DemandStream&, const stdair::DemandGenerationMethod&);
+
+
+  private:
+    // /////////////////// Business Methods ///////////////////
+    /**
+     * Generate the first request of each demand stream of the
+     * registry, with the given generation method.
+     */
+    template <typename GENERATION_METHOD>
+    void initWith (const DemandStreamHandle_T iFirstHandle,
+                   const DemandStreamHandle_T iHandleStride);
+
+    /**
+     * Generate the next request of the given demand stream, with the
+     * given generation method.
+     *
+     * @return bool Whether a request has been generated before the
+     *         preferred departure date-time of the demand stream (when
+     *         false, the demand stream is over).
+     */
+    template <typename GENERATION_METHOD>
+    static bool generateNextRequestWith (DemandStream&, BookingRequestRecord&);
+
+    /**
+     * Type of the (specialised) nextWith() methods.
+     */
+    typedef void (BookingRequestRange::*NextFunction_T) ();
+
+    /**
+     * Make the earliest pending request the current one.
+     */
+    void pop();
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Registry of the demand streams, or NULL for a range over a
+     * single demand stream.
+     */
+    const DemandStreamRegistry* _demandStreamRegistry_ptr;
+
+    /**
+     * Demand stream having generated the current request.
+     */
+    DemandStream* _demandStream_ptr;
+
+    /**
+     * Pending requests, at most one per demand stream (not used for a
+     * range over a single demand stream).
+     */
+    CalendarQueue _requestQueue;
+
+    /**
+     * Current request.
+     */
+    BookingRequestRecord _currentRequestRecord;
+
+    /**
+     * Whether there is a current request.
+     */
+    bool _hasCurrentRequest;
+
+    /**
+     * Path used by next(), selected once for the generation method of
+     * the range.
+     */
+    NextFunction_T _nextFunction;
+  };
+
+}
+#endif // __TRADEMGEN_BOM_BOOKINGREQUESTRANGE_HPP
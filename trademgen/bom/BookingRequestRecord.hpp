@@ -0,0 +1,74 @@
+#ifndef __TRADEMGEN_BOM_BOOKINGREQUESTRECORD_HPP
+#define __TRADEMGEN_BOM_BOOKINGREQUESTRECORD_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// Boost
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+// StdAir
+#include <stdair/stdair_demand_types.hpp>
+// TraDemGen
+#include <trademgen/TRADEMGEN_Types.hpp>
+#include <trademgen/basic/CodePool.hpp>
+#include <trademgen/basic/EpochTimeManager.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Compact (plain old data) record of a generated booking
+   * request.
+   *
+   * Only the attributes drawn for the request are stored; the ones
+   * common to all the requests of a demand stream (origin,
+   * destination, preferred departure date and cabin, party size and
+   * disutilities) are retrieved, when needed, from the demand stream
+   * thanks to its handle. The codes are the ones of the CodePool.
+   *
+   * The full stdair::BookingRequestStruct is built only on demand,
+   * with DemandStream::createBookingRequest().
+   */
+  struct BookingRequestRecord {
+    /** Date-time of the request. */
+    EpochTime_T _requestDateTime;
+
+    /** Willingness-to-pay. */
+    stdair::WTP_T _wtp;
+
+    /** Value of time. */
+    stdair::PriceValue_T _valueOfTime;
+
+    /** Handle of the demand stream having generated the request. */
+    DemandStreamHandle_T _demandStreamHandle;
+
+    /** Point-of-sale. */
+    Code_T _pos;
+
+    /** Booking channel. */
+    Code_T _channel;
+
+    /** Trip type. */
+    Code_T _tripType;
+
+    /** Frequent flyer type. */
+    Code_T _frequentFlyerType;
+
+    /** Stay duration (in days). */
+    boost::int32_t _stayDuration;
+
+    /** Preferred departure time (in seconds since midnight). */
+    boost::int32_t _preferredDepartureTime;
+
+    /** Whether the request accepts change fees. */
+    bool _changeFees;
+
+    /** Whether the request accepts non-refundable fares. */
+    bool _nonRefundable;
+  };
+
+  // The record is meant to fit within a cache line.
+  BOOST_STATIC_ASSERT (sizeof (BookingRequestRecord) <= 64);
+
+}
+#endif // __TRADEMGEN_BOM_BOOKINGREQUESTRECORD_HPP
@@ -0,0 +1,232 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <algorithm>
+// TraDemGen
+#include <trademgen/bom/CalendarQueue.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  const std::size_t CalendarQueue::MIN_NB_OF_BUCKETS;
+  const EpochTime_T CalendarQueue::DEFAULT_BUCKET_WIDTH;
+  const std::size_t CalendarQueue::NB_OF_EXPECTED_STEPS;
+  const std::size_t CalendarQueue::MAX_NB_OF_SAMPLED_ENTRIES;
+
+  // ////////////////////////////////////////////////////////////////////
+  CalendarQueue::CalendarQueue()
+    : _bucketList (MIN_NB_OF_BUCKETS), _bucketWidth (DEFAULT_BUCKET_WIDTH),
+      _size (0), _nextSequenceNumber (0), _currentBucketIndex (0),
+      _currentBucketTop (DEFAULT_BUCKET_WIDTH), _nbOfExcessSteps (0) {
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void CalendarQueue::clear() {
+    for (BucketList_T::iterator itBucket = _bucketList.begin();
+         itBucket != _bucketList.end(); ++itBucket) {
+      itBucket->clear();
+    }
+    _size = 0;
+    _nbOfExcessSteps = 0;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  std::size_t CalendarQueue::insert (const Entry& iEntry) {
+    // The bucket is sorted from the latest to the earliest entry: the
+    // entries of the later years (if any) come first, and the ones of
+    // the current day last.
+    Bucket_T& lBucket =
+      _bucketList[getBucketIndex (iEntry._record._requestDateTime)];
+    const Bucket_T::iterator itEntry =
+      std::lower_bound (lBucket.begin(), lBucket.end(), iEntry,
+                        LaterEntryPredicate());
+    const std::size_t oNbOfSteps = lBucket.end() - itEntry;
+    lBucket.insert (itEntry, iEntry);
+    ++_size;
+    return oNbOfSteps;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void CalendarQueue::account (const std::size_t iNbOfSteps) {
+    if (iNbOfSteps <= NB_OF_EXPECTED_STEPS) {
+      return;
+    }
+    _nbOfExcessSteps += iNbOfSteps - NB_OF_EXPECTED_STEPS;
+
+    // Once the excess steps have cost as much as a rebuild, the bucket
+    // width no longer fits the spread of the requests
+    if (_nbOfExcessSteps > _size + _bucketList.size()) {
+      resize (_bucketList.size());
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void CalendarQueue::setCurrentDateTime (const EpochTime_T& iDateTime) {
+    _currentBucketIndex = getBucketIndex (iDateTime);
+    _currentBucketTop = (floorDivide (iDateTime, _bucketWidth) + 1) * _bucketWidth;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void CalendarQueue::push (const BookingRequestRecord& iBookingRequestRecord) {
+    const Entry lEntry = { iBookingRequestRecord, _nextSequenceNumber++ };
+    const std::size_t lNbOfSteps = insert (lEntry);
+
+    // The next extraction must not miss a request earlier than the
+    // current day
+    const EpochTime_T& lDateTime = iBookingRequestRecord._requestDateTime;
+    if (_size == 1 || lDateTime < _currentBucketTop - _bucketWidth) {
+      setCurrentDateTime (lDateTime);
+    }
+
+    if (_size > 2 * _bucketList.size()) {
+      resize (2 * _bucketList.size());
+    } else {
+      account (lNbOfSteps);
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void CalendarQueue::
+  push (const BookingRequestRecordList_T& iBookingRequestRecordList) {
+    EntryList_T lEntryList;
+    lEntryList.reserve (_size + iBookingRequestRecordList.size());
+    collect (lEntryList);
+    for (BookingRequestRecordList_T::const_iterator itRecord =
+           iBookingRequestRecordList.begin();
+         itRecord != iBookingRequestRecordList.end(); ++itRecord) {
+      const Entry lEntry = { *itRecord, _nextSequenceNumber++ };
+      lEntryList.push_back (lEntry);
+    }
+
+    // About one entry per bucket
+    std::size_t lNbOfBuckets = MIN_NB_OF_BUCKETS;
+    while (lNbOfBuckets < lEntryList.size()) {
+      lNbOfBuckets *= 2;
+    }
+    rebuild (lEntryList, lNbOfBuckets);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  BookingRequestRecord CalendarQueue::pop() {
+    assert (_size > 0);
+    const std::size_t lNbOfBuckets = _bucketList.size();
+
+    // Browse the days of the current year, starting from the current
+    // one, until a bucket holds a request of that very day.
+    std::size_t lBucketIndex = _currentBucketIndex;
+    EpochTime_T lBucketTop = _currentBucketTop;
+    bool hasBeenFound = false;
+    std::size_t lNbOfSteps = 1;
+    for (std::size_t idx = 0; idx != lNbOfBuckets; ++idx, ++lNbOfSteps) {
+      const Bucket_T& lBucket = _bucketList[lBucketIndex];
+      if (lBucket.empty() == false
+          && lBucket.back()._record._requestDateTime < lBucketTop) {
+        hasBeenFound = true;
+        break;
+      }
+      lBucketIndex = (lBucketIndex + 1) & (lNbOfBuckets - 1);
+      lBucketTop += _bucketWidth;
+    }
+
+    if (hasBeenFound == false) {
+      // The next request is more than a year ahead: look for the
+      // earliest one among all the buckets.
+      const Entry* lEarliestEntry_ptr = NULL;
+      for (BucketList_T::const_iterator itBucket = _bucketList.begin();
+           itBucket != _bucketList.end(); ++itBucket) {
+        if (itBucket->empty() == false
+            && (lEarliestEntry_ptr == NULL
+                || lEarliestEntry_ptr->isLaterThan (itBucket->back()) == true)) {
+          lEarliestEntry_ptr = &itBucket->back();
+        }
+      }
+      assert (lEarliestEntry_ptr != NULL);
+      setCurrentDateTime (lEarliestEntry_ptr->_record._requestDateTime);
+      lBucketIndex = _currentBucketIndex;
+      lBucketTop = _currentBucketTop;
+      lNbOfSteps += lNbOfBuckets;
+    }
+
+    // Extract the earliest request of the bucket
+    Bucket_T& lBucket = _bucketList[lBucketIndex];
+    assert (lBucket.empty() == false);
+    const BookingRequestRecord oBookingRequestRecord = lBucket.back()._record;
+    lBucket.pop_back();
+    --_size;
+    _currentBucketIndex = lBucketIndex;
+    _currentBucketTop = lBucketTop;
+
+    if (lNbOfBuckets > MIN_NB_OF_BUCKETS && 2 * _size < lNbOfBuckets) {
+      resize (lNbOfBuckets / 2);
+    } else {
+      account (lNbOfSteps);
+    }
+
+    return oBookingRequestRecord;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void CalendarQueue::collect (EntryList_T& ioEntryList) {
+    for (BucketList_T::iterator itBucket = _bucketList.begin();
+         itBucket != _bucketList.end(); ++itBucket) {
+      ioEntryList.insert (ioEntryList.end(), itBucket->begin(), itBucket->end());
+      itBucket->clear();
+    }
+    _size = 0;
+    _nbOfExcessSteps = 0;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void CalendarQueue::rebuild (const EntryList_T& iEntryList,
+                               const std::size_t iNbOfBuckets) {
+    assert (_size == 0);
+
+    if (iEntryList.empty() == true) {
+      _bucketList.resize (iNbOfBuckets);
+      return;
+    }
+
+    // Derive the width of the buckets from the spread of the earliest
+    // entries (the ones to be extracted next), so that a bucket holds
+    // a few of them on average.
+    std::vector<EpochTime_T> lDateTimeList;
+    lDateTimeList.reserve (iEntryList.size());
+    for (EntryList_T::const_iterator itEntry = iEntryList.begin();
+         itEntry != iEntryList.end(); ++itEntry) {
+      lDateTimeList.push_back (itEntry->_record._requestDateTime);
+    }
+    const std::size_t lNbOfSamples =
+      std::min (lDateTimeList.size() / 2, MAX_NB_OF_SAMPLED_ENTRIES);
+    std::nth_element (lDateTimeList.begin(),
+                      lDateTimeList.begin() + lNbOfSamples,
+                      lDateTimeList.end());
+    const EpochTime_T lEarliestDateTime =
+      *std::min_element (lDateTimeList.begin(),
+                         lDateTimeList.begin() + lNbOfSamples + 1);
+    if (lNbOfSamples > 0) {
+      const EpochTime_T lSpread =
+        lDateTimeList[lNbOfSamples] - lEarliestDateTime;
+      _bucketWidth =
+        std::max (static_cast<EpochTime_T> (1),
+                  3 * lSpread / static_cast<EpochTime_T> (lNbOfSamples));
+    }
+
+    _bucketList.resize (iNbOfBuckets);
+    for (EntryList_T::const_iterator itEntry = iEntryList.begin();
+         itEntry != iEntryList.end(); ++itEntry) {
+      insert (*itEntry);
+    }
+    setCurrentDateTime (lEarliestDateTime);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void CalendarQueue::resize (const std::size_t iNbOfBuckets) {
+    EntryList_T lEntryList;
+    lEntryList.reserve (_size);
+    collect (lEntryList);
+    rebuild (lEntryList, iNbOfBuckets);
+  }
+
+}
@@ -0,0 +1,258 @@
+#ifndef __TRADEMGEN_BOM_CALENDARQUEUE_HPP
+#define __TRADEMGEN_BOM_CALENDARQUEUE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cstddef>
+#include <vector>
+// Boost
+#include <boost/cstdint.hpp>
+// TraDemGen
+#include <trademgen/basic/EpochTimeManager.hpp>
+#include <trademgen/bom/BookingRequestRecord.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Priority queue of booking requests, ordered by date-time,
+   * implemented as a calendar queue (R. Brown, 1988).
+   *
+   * The requests are spread over buckets (the "days" of the calendar),
+   * each covering a fixed span of simulated time, the bucket of a
+   * request being given by its date-time modulo the span of all the
+   * buckets (the "year"). As long as the bucket width matches the
+   * density of the requests, both the insertion and the extraction of
+   * a request take a constant (amortised) time. The number of buckets
+   * and their width are adjusted whenever the number of requests
+   * doubles or halves, and the width alone whenever the requests
+   * happen to be spread in a way no longer matching it.
+   *
+   * The requests are ordered by date-time, then by demand stream
+   * handle, then by order of insertion: the date-times are never
+   * altered, even when they collide.
+   */
+  class CalendarQueue {
+  public:
+    // ///////////// Type definitions //////////////
+    /** Order of insertion of the requests. */
+    typedef boost::uint64_t SequenceNumber_T;
+
+    /** List of booking requests. */
+    typedef std::vector<BookingRequestRecord> BookingRequestRecordList_T;
+
+    /** Minimal number of buckets. */
+    static const std::size_t MIN_NB_OF_BUCKETS = 16;
+
+    /** Width of the buckets of an empty queue (one hour). */
+    static const EpochTime_T DEFAULT_BUCKET_WIDTH = 3600000;
+
+    /**
+     * Number of steps (entries or buckets browsed) expected for an
+     * insertion or an extraction; the steps beyond it are accounted
+     * for, so as to decide when to adjust the bucket width.
+     */
+    static const std::size_t NB_OF_EXPECTED_STEPS = 4;
+
+    /**
+     * Maximal number of (earliest) entries the bucket width is derived
+     * from.
+     */
+    static const std::size_t MAX_NB_OF_SAMPLED_ENTRIES = 64;
+
+
+  public:
+    // ///////////// Getters ///////////
+    /** State whether the queue is empty. */
+    bool empty() const {
+      return (_size == 0);
+    }
+
+    /** Get the number of requests within the queue. */
+    std::size_t size() const {
+      return _size;
+    }
+
+    /** Get the number of buckets. */
+    std::size_t getNbOfBuckets() const {
+      return _bucketList.size();
+    }
+
+    /** Get the width of the buckets (in milliseconds). */
+    const EpochTime_T& getBucketWidth() const {
+      return _bucketWidth;
+    }
+
+
+  public:
+    // /////////////////// Business Methods ///////////////////
+    /**
+     * Add a request.
+     */
+    void push (const BookingRequestRecord&);
+
+    /**
+     * Add a whole list of requests at once (e.g., the first request of
+     * every demand stream), sizing the calendar for them only once.
+     */
+    void push (const BookingRequestRecordList_T&);
+
+    /**
+     * Extract the earliest request (the queue must not be empty).
+     */
+    BookingRequestRecord pop();
+
+    /**
+     * Remove all the requests.
+     */
+    void clear();
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Default constructor (empty queue).
+     */
+    CalendarQueue();
+
+
+  private:
+    // ///////////// Type definitions //////////////
+    /**
+     * Request along with its order of insertion.
+     */
+    struct Entry {
+      BookingRequestRecord _record;
+      SequenceNumber_T _sequenceNumber;
+
+      /** State whether that entry is to be extracted after the given one. */
+      bool isLaterThan (const Entry& iEntry) const {
+        if (_record._requestDateTime != iEntry._record._requestDateTime) {
+          return (_record._requestDateTime > iEntry._record._requestDateTime);
+        }
+        if (_record._demandStreamHandle != iEntry._record._demandStreamHandle) {
+          return (_record._demandStreamHandle
+                  > iEntry._record._demandStreamHandle);
+        }
+        return (_sequenceNumber > iEntry._sequenceNumber);
+      }
+    };
+
+    /**
+     * Ordering of the entries, from the latest to the earliest.
+     */
+    struct LaterEntryPredicate {
+      bool operator() (const Entry& iLhs, const Entry& iRhs) const {
+        return iLhs.isLaterThan (iRhs);
+      }
+    };
+
+    /**
+     * Bucket, sorted from the latest to the earliest entry (so that
+     * the earliest one can be removed at no cost).
+     */
+    typedef std::vector<Entry> Bucket_T;
+    typedef std::vector<Bucket_T> BucketList_T;
+
+    /** List of entries, in no specific order. */
+    typedef std::vector<Entry> EntryList_T;
+
+
+  private:
+    // /////////////////// Business Methods ///////////////////
+    /**
+     * Get the index of the bucket of the given date-time.
+     */
+    std::size_t getBucketIndex (const EpochTime_T& iDateTime) const {
+      const EpochTime_T lDayIndex = floorDivide (iDateTime, _bucketWidth);
+      return (static_cast<std::size_t> (lDayIndex) & (_bucketList.size() - 1));
+    }
+
+    /**
+     * Division rounded towards minus infinity (the date-times before
+     * 1970 being negative).
+     */
+    static EpochTime_T floorDivide (const EpochTime_T& iDividend,
+                                    const EpochTime_T& iDivisor) {
+      const EpochTime_T lQuotient = iDividend / iDivisor;
+      return (iDividend % iDivisor < 0) ? lQuotient - 1 : lQuotient;
+    }
+
+    /**
+     * Insert an entry within its bucket, without resizing.
+     *
+     * @return std::size_t Number of earlier entries within the bucket.
+     */
+    std::size_t insert (const Entry&);
+
+    /**
+     * Make the given date-time the current one, i.e., the one from
+     * which the next extraction browses the buckets.
+     */
+    void setCurrentDateTime (const EpochTime_T&);
+
+    /**
+     * Account for the number of steps taken by an insertion or an
+     * extraction, adjusting the bucket width when the excess steps
+     * have cost more than a rebuild of the calendar.
+     */
+    void account (const std::size_t iNbOfSteps);
+
+    /**
+     * Move all the entries into the given list, leaving the buckets empty.
+     */
+    void collect (EntryList_T&);
+
+    /**
+     * Rebuild the calendar with the given entries and number of
+     * buckets, the bucket width being derived from the spread of the
+     * earliest entries.
+     */
+    void rebuild (const EntryList_T&, const std::size_t iNbOfBuckets);
+
+    /**
+     * Rebuild the calendar with the given number of buckets.
+     */
+    void resize (const std::size_t iNbOfBuckets);
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Buckets (their number being a power of two).
+     */
+    BucketList_T _bucketList;
+
+    /**
+     * Width of the buckets (in milliseconds).
+     */
+    EpochTime_T _bucketWidth;
+
+    /**
+     * Number of entries.
+     */
+    std::size_t _size;
+
+    /**
+     * Next sequence number.
+     */
+    SequenceNumber_T _nextSequenceNumber;
+
+    /**
+     * Bucket from which the next extraction starts, and (exclusive)
+     * upper bound of the date-times belonging to the current day of
+     * that bucket.
+     */
+    std::size_t _currentBucketIndex;
+    EpochTime_T _currentBucketTop;
+
+    /**
+     * Number of steps taken beyond the expected ones, since the last
+     * rebuild of the calendar.
+     */
+    std::size_t _nbOfExcessSteps;
+  };
+
+}
+#endif // __TRADEMGEN_BOM_CALENDARQUEUE_HPP
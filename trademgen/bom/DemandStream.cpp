@@ -5,9 +5,6 @@
 #include <cassert>
 #include <sstream>
 #include <cmath>
-#include <iomanip>
-// Boost
-#include <boost/make_shared.hpp>
 // StdAir
 #include <stdair/basic/BasConst_General.hpp>
 #include <stdair/basic/BasConst_Inventory.hpp>
@@ -16,116 +13,168 @@
 #include <stdair/service/Logger.hpp>
 // TraDemGen
 #include <trademgen/basic/BasConst_DemandGeneration.hpp>
+#include <trademgen/basic/BookingRequestPool.hpp>
+#include <trademgen/basic/CodePool.hpp>
 #include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamFamily.hpp>
+#include <trademgen/bom/TraceSink.hpp>
 
 namespace TRADEMGEN {
 
   // ////////////////////////////////////////////////////////////////////
-  DemandStream::DemandStream()
-    : _key (stdair::DEFAULT_ORIGIN, stdair::DEFAULT_DESTINATION,
-            stdair::DEFAULT_DEPARTURE_DATE, stdair::DEFAULT_CABIN_CODE),
-      _parent (NULL),
-      _demandCharacteristics (ArrivalPatternCumulativeDistribution_T(),
-                              POSProbabilityMassFunction_T(),
-                              ChannelProbabilityMassFunction_T(),
-                              TripTypeProbabilityMassFunction_T(),
-                              StayDurationProbabilityMassFunction_T(),
-                              FrequentFlyerProbabilityMassFunction_T(),
-                              0.5, 50, 0.5, 50,
-                              PreferredDepartureTimeContinuousDistribution_T(),
-                              0.0,
-                              ValueOfTimeContinuousDistribution_T()),
-      _posProMass (DEFAULT_POS_PROBALILITY_MASS),
-      _firstDateTimeRequest (true) {
-    assert (false);
+  struct DemandStream::StatisticsOrderMethod {
+    /** Check whether enough requests have already been generated. */
+    static const bool
+    stillHavingRequestsToBeGenerated (const DemandStream& iDemandStream) {
+      const stdair::Count_T lNbOfRequestsGeneratedSoFar =
+        iDemandStream._randomGenerationContext.getNumberOfRequestsGeneratedSoFar();
+      const stdair::Count_T lRemainingNumberOfRequestsToBeGenerated =
+        iDemandStream._totalNumberOfRequestsToBeGenerated
+        - lNbOfRequestsGeneratedSoFar;
+      return (lRemainingNumberOfRequestsToBeGenerated > 0);
+    }
+
+    /** Generate the date-time of the next request. */
+    static const EpochTime_T
+    generateTimeOfRequest (DemandStream& ioDemandStream) {
+      return ioDemandStream.generateTimeOfRequestStatisticsOrder();
+    }
+  };
+
+  // ////////////////////////////////////////////////////////////////////
+  struct DemandStream::AdvancedStatisticsOrderMethod {
+    /** Generate the date-time of the (already advanced) next request. */
+    static const EpochTime_T
+    generateTimeOfRequest (DemandStream& ioDemandStream) {
+      return ioDemandStream.generateTimeOfAdvancedRequest();
+    }
+  };
+
+  // ////////////////////////////////////////////////////////////////////
+  struct DemandStream::PoissonProcessMethod {
+    /** Check whether the Poisson process has not stopped yet. */
+    static const bool
+    stillHavingRequestsToBeGenerated (const DemandStream& iDemandStream) {
+      return iDemandStream._poissonProcessState._stillHavingRequestsToBeGenerated;
+    }
+
+    /** Generate the date-time of the next request. */
+    static const EpochTime_T
+    generateTimeOfRequest (DemandStream& ioDemandStream) {
+      return ioDemandStream.generateTimeOfRequestPoissonProcess();
+    }
+  };
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStream::DemandStream (DemandStreamFamily& ioFamily,
+                              const stdair::Date_T& iPreferredDepartureDate)
+    : _family (&ioFamily), _handle (0),
+      _preferredDepartureDate (iPreferredDepartureDate),
+      _preferredDepartureDateEpochTime (EpochTimeManager::
+                                        convertIntoEpochTime (stdair::DateTime_T (iPreferredDepartureDate))),
+      _totalNumberOfRequestsToBeGenerated (0) {
+    for (unsigned int lSubStream = 0; lSubStream < NB_OF_SUB_STREAMS;
+         ++lSubStream) {
+      _drawIndexArray[lSubStream] =
+        CounterBasedRandomGeneration::getFirstDrawIndex (lSubStream);
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const DemandStream::Key_T DemandStream::getKey() const {
+    return Key_T (getOrigin(), getDestination(), _preferredDepartureDate,
+                  getPreferredCabin());
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const stdair::AirportCode_T& DemandStream::getOrigin() const {
+    return getFamily().getOrigin();
   }
 
   // ////////////////////////////////////////////////////////////////////
-  DemandStream::DemandStream (const DemandStream&)
-    : _key (stdair::DEFAULT_ORIGIN, stdair::DEFAULT_DESTINATION,
-            stdair::DEFAULT_DEPARTURE_DATE, stdair::DEFAULT_CABIN_CODE),
-      _parent (NULL),
-      _demandCharacteristics (ArrivalPatternCumulativeDistribution_T(),
-                              POSProbabilityMassFunction_T(),
-                              ChannelProbabilityMassFunction_T(),
-                              TripTypeProbabilityMassFunction_T(),
-                              StayDurationProbabilityMassFunction_T(),
-                              FrequentFlyerProbabilityMassFunction_T(),
-                              0.5, 50, 0.5, 50,
-                              PreferredDepartureTimeContinuousDistribution_T(),
-                              0.0,
-                              ValueOfTimeContinuousDistribution_T()),
-      _posProMass (DEFAULT_POS_PROBALILITY_MASS),
-      _firstDateTimeRequest (true) {
-    assert (false);
+  const stdair::AirportCode_T& DemandStream::getDestination() const {
+    return getFamily().getDestination();
   }
 
   // ////////////////////////////////////////////////////////////////////
-  DemandStream::DemandStream (const Key_T& iKey) :
-    _key (iKey) {
+  const stdair::CabinCode_T& DemandStream::getPreferredCabin() const {
+    return getFamily().getPreferredCabin();
   }
 
   // ////////////////////////////////////////////////////////////////////
-  DemandStream::~DemandStream() {
+  const TraceSink& DemandStream::getTraceSink() const {
+    return getFamily().getTraceSink();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const DemandCharacteristics& DemandStream::getDemandCharacteristics() const {
+    return getFamily().getDemandCharacteristics();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const DemandCharacteristicsPtr_T& DemandStream::
+  getDemandCharacteristicsPtr() const {
+    return getFamily().getDemandCharacteristicsPtr();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const DemandDistribution& DemandStream::getDemandDistribution() const {
+    return getFamily().getDemandDistribution();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const POSProbabilityMass_T& DemandStream::getPOSProbabilityMass() const {
+    return getFamily().getPOSProbabilityMass();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const CounterBasedRandomGeneration::StreamId_T DemandStream::
+  getStreamId() const {
+    return CounterBasedRandomGeneration::
+      generateStreamId (getFamily().getStreamId(),
+                        _preferredDepartureDate.day_number());
   }
 
   // ////////////////////////////////////////////////////////////////////
   std::string DemandStream::toString() const {
-    std::ostringstream oStr;
-    oStr << _key.toString();
-    return oStr.str();
+    return describeKey();
   }
 
   // ////////////////////////////////////////////////////////////////////
-  void DemandStream::
-  setAll (const ArrivalPatternCumulativeDistribution_T& iArrivalPattern,
-          const POSProbabilityMassFunction_T& iPOSProbMass,
-          const ChannelProbabilityMassFunction_T& iChannelProbMass,
-          const TripTypeProbabilityMassFunction_T& iTripTypeProbMass,
-          const StayDurationProbabilityMassFunction_T& iStayDurationProbMass,
-          const FrequentFlyerProbabilityMassFunction_T& iFrequentFlyerProbMass,
-          const stdair::ChangeFeesRatio_T& iChangeFeeProb,
-          const stdair::Disutility_T& iChangeFeeDisutility,
-          const stdair::NonRefundableRatio_T& iNonRefundableProb,
-          const stdair::Disutility_T& iNonRefundableDisutility,
-          const PreferredDepartureTimeContinuousDistribution_T& iPreferredDepartureTimeContinuousDistribution,
-          const stdair::WTP_T& iMinWTP,
-          const ValueOfTimeContinuousDistribution_T& iValueOfTimeContinuousDistribution,
-          const DemandDistribution& iDemandDistribution,
-          stdair::BaseGenerator_T& ioSharedGenerator,
-          const stdair::RandomSeed_T& iRequestDateTimeSeed,
-          const stdair::RandomSeed_T& iDemandCharacteristicsSeed,
-          const POSProbabilityMass_T& iDefaultPOSProbablityMass) {
-
-    setDemandCharacteristics (iArrivalPattern, iPOSProbMass,
-                              iChannelProbMass, iTripTypeProbMass,
-                              iStayDurationProbMass, iFrequentFlyerProbMass,
-                              iChangeFeeProb, iChangeFeeDisutility,
-                              iNonRefundableProb, iNonRefundableDisutility,
-                              iPreferredDepartureTimeContinuousDistribution,
-                              iMinWTP, iValueOfTimeContinuousDistribution);
-
-    setDemandDistribution (iDemandDistribution);
-    setTotalNumberOfRequestsToBeGenerated (0);
-    setRequestDateTimeRandomGeneratorSeed (iRequestDateTimeSeed);
-    setDemandCharacteristicsRandomGeneratorSeed (iDemandCharacteristicsSeed);
-    setPOSProbabilityMass (iDefaultPOSProbablityMass);
+  const stdair::DemandStreamKeyStr_T DemandStream::describeKey() const {
+    return getKey().toString();
+  }
 
-    //
-    init (ioSharedGenerator);
+  // ////////////////////////////////////////////////////////////////////
+  CounterBasedRandomGeneration DemandStream::
+  getRandomGenerator (const EN_SubStream& iSubStream) const {
+    assert (iSubStream < NB_OF_SUB_STREAMS);
+    return CounterBasedRandomGeneration (getFamily().getMasterSeed(),
+                                         getStreamId(),
+                                         _drawIndexArray[iSubStream]);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void DemandStream::
+  setDrawIndex (const EN_SubStream& iSubStream,
+                const CounterBasedRandomGeneration& iGenerator) {
+    assert (iSubStream < NB_OF_SUB_STREAMS);
+    assert (iGenerator.getStreamId() == getStreamId());
+    _drawIndexArray[iSubStream] = iGenerator.getDrawIndex();
   }
 
   // ////////////////////////////////////////////////////////////////////
   std::string DemandStream::display() const {
     std::ostringstream oStr;
 
-    oStr << "Demand stream key: " << _key.toString() << std::endl;
+    oStr << "Demand stream key: " << describeKey() << std::endl;
+    oStr << "Family: " << getFamily().describe() << std::endl;
 
     //
-    oStr << _demandCharacteristics.describe();
+    oStr << getDemandCharacteristics().describe();
 
     //
-    oStr << _demandDistribution.describe() << " => "
+    oStr << getDemandDistribution().describe() << " => "
          << _totalNumberOfRequestsToBeGenerated << " to be generated"
          << std::endl;
 
@@ -135,38 +184,52 @@ namespace TRADEMGEN {
 
     //
     oStr << "Random generator for date-time: "
-         << _requestDateTimeRandomGenerator << std::endl;
+         << getRandomGenerator (REQUEST_DATE_TIME_SUB_STREAM).describe()
+         << std::endl;
     oStr << "Random generator for demand characteristics: "
-         << _demandCharacteristicsRandomGenerator << std::endl;
+         << getRandomGenerator (DEMAND_CHARACTERISTICS_SUB_STREAM).describe()
+         << std::endl;
+    oStr << "Random generator for the number of requests: "
+         << getRandomGenerator (NUMBER_OF_REQUESTS_SUB_STREAM).describe()
+         << std::endl;
 
     //
-    oStr << _posProMass.displayProbabilityMass() << std::endl;
+    oStr << getPOSProbabilityMass().displayProbabilityMass() << std::endl;
 
     return oStr.str();
   }    
 
   // ////////////////////////////////////////////////////////////////////
-  void DemandStream::init (stdair::BaseGenerator_T& ioSharedGenerator) {
+  void DemandStream::init() {
     
-    // Generate the number of requests
-    const stdair::RealNumber_T lMu = _demandDistribution._meanNumberOfRequests;
+    // Generate the number of requests, from the dedicated sub-stream
+    // (so that it depends neither on the order in which the demand
+    // streams are created, nor on the order in which they are reset)
+    const stdair::RealNumber_T lMu = getDemandDistribution()._meanNumberOfRequests;
     const stdair::RealNumber_T lSigma =
-      _demandDistribution._stdDevNumberOfRequests;
+      getDemandDistribution()._stdDevNumberOfRequests;
 
-    stdair::NormalDistribution_T lDistrib (lMu, lSigma);
-    stdair::NormalGenerator_T lNormalGen (ioSharedGenerator, lDistrib);
-    
-    const stdair::RealNumber_T lRealNumberOfRequestsToBeGenerated =lNormalGen();
+    CounterBasedRandomGeneration lGenerator =
+      getRandomGenerator (NUMBER_OF_REQUESTS_SUB_STREAM);
+    const stdair::RealNumber_T lRealNumberOfRequestsToBeGenerated =
+      getFamily().getNormalSampler().generateNormal (lGenerator, lMu, lSigma);
+    setDrawIndex (NUMBER_OF_REQUESTS_SUB_STREAM, lGenerator);
 
     const stdair::NbOfRequests_T lIntegerNumberOfRequestsToBeGenerated = 
       std::floor (lRealNumberOfRequestsToBeGenerated + 0.5);
     
     _totalNumberOfRequestsToBeGenerated = lIntegerNumberOfRequestsToBeGenerated;
 
-    _stillHavingRequestsToBeGenerated = true;
-    _firstDateTimeRequest = true;
+    _poissonProcessState._stillHavingRequestsToBeGenerated = true;
+    _poissonProcessState._firstDateTimeRequest = true;
   }  
 
+  // ////////////////////////////////////////////////////////////////////
+  template <typename GENERATION_METHOD>
+  const bool DemandStream::stillHavingRequestsToBeGeneratedWith() const {
+    return GENERATION_METHOD::stillHavingRequestsToBeGenerated (*this);
+  }
+
   // ////////////////////////////////////////////////////////////////////
   const bool DemandStream::
   stillHavingRequestsToBeGenerated (const stdair::DemandGenerationMethod& iDemandGenerationMethod) const {
@@ -174,129 +237,98 @@ namespace TRADEMGEN {
     const stdair::DemandGenerationMethod::EN_DemandGenerationMethod& lENDemandGenerationMethod =
       iDemandGenerationMethod.getMethod();
     if (lENDemandGenerationMethod == stdair::DemandGenerationMethod::STA_ORD) {
-      bool hasStillHavingRequestsToBeGenerated = true;
-      
-      // Check whether enough requests have already been generated
-      const stdair::Count_T lNbOfRequestsGeneratedSoFar =
-        _randomGenerationContext.getNumberOfRequestsGeneratedSoFar();
-      
-      const stdair::Count_T lRemainingNumberOfRequestsToBeGenerated =
-        _totalNumberOfRequestsToBeGenerated - lNbOfRequestsGeneratedSoFar;
-      
-      if (lRemainingNumberOfRequestsToBeGenerated <= 0) {
-        hasStillHavingRequestsToBeGenerated = false;
-      }
-      
-      return hasStillHavingRequestsToBeGenerated;
+      return stillHavingRequestsToBeGeneratedWith<StatisticsOrderMethod>();
     } else {
-      return _stillHavingRequestsToBeGenerated;
+      return stillHavingRequestsToBeGeneratedWith<PoissonProcessMethod>();
     }
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::DateTime_T DemandStream::generateTimeOfRequestPoissonProcess() {
+  const EpochTime_T DemandStream::generateTimeOfRequestPoissonProcess() {
+    PoissonProcessState& lState = _poissonProcessState;
 
     // Prepare arrival pattern.
     const ContinuousFloatDuration_T& lArrivalPattern =
-      _demandCharacteristics._arrivalPattern;
-      
-    const stdair::Time_T lHardcodedReferenceDepartureTime =
-      boost::posix_time::hours (8);
-
-    // Prepare departure date time.
-    const stdair::DateTime_T lDepartureDateTime =
-      boost::posix_time::ptime (_key.getPreferredDepartureDate(),
-                                lHardcodedReferenceDepartureTime);
-
-    // If no request has been generated so far...
-    if (_firstDateTimeRequest) {
+      getDemandCharacteristics()._arrivalPattern;
+
+    // The integrated arrival rate, from the beginning of the arrival
+    // pattern, is the expected number of requests times the cumulative
+    // probability. Hence, measured on the cumulative probability, the
+    // time between two requests follows an exponential distribution,
+    // the rate of which is the expected number of requests; the
+    // request date-time is then given by the inverse cumulative
+    // distribution, whatever the number of daily rate intervals
+    // overstepped in the meantime.
+    if (lState._firstDateTimeRequest) {
       const stdair::Probability_T lProbabilityFirstRequest = 0;
 
       // Get the lower bound of the arrival pattern (correponding
       // to a cumulative probability of 0).
-      _dateTimeLastRequest =
+      const stdair::FloatDuration_T lFirstLowerBound =
         lArrivalPattern.getValue (lProbabilityFirstRequest);
+      lState._cumulativeProbabilityLastRequest =
+        lArrivalPattern.getCumulativeProbability (lFirstLowerBound);
 
-      _firstDateTimeRequest = false;
+      // The generation stops at the lower bound of the last daily rate
+      // interval (default value is -1, meaning one day before departure).
+      lState._cumulativeProbabilityUpperBound = lArrivalPattern.
+        getCumulativeProbability (DEFAULT_LAST_LOWER_BOUND_ARRIVAL_PATTERN);
+
+      lState._firstDateTimeRequest = false;
     }
 
     // Sanity check.
-    assert (_firstDateTimeRequest == false);
-
-    // If the date time of the last request is equal to the lower bound of
-    // the last daily rate interval (default value is -1, meaning one day
-    // before departure), we stopped generating request by returning a
-    // request date time after departure date time.
-    if (_dateTimeLastRequest == DEFAULT_LAST_LOWER_BOUND_ARRIVAL_PATTERN) {
-      _stillHavingRequestsToBeGenerated = false;
-
-      // Get a positive number of days.
-      const stdair::Duration_T lDifferenceBetweenDepartureAndThisLowerBound =
-        convertFloatIntoDuration (-DEFAULT_LAST_LOWER_BOUND_ARRIVAL_PATTERN);
-
-      // Calculate a request date-time after the departure date time to end
-      // the demand generation algorithm.
-      const stdair::DateTime_T oDateTimeThisRequest =
-        lDepartureDateTime + lDifferenceBetweenDepartureAndThisLowerBound;
-
-      return oDateTimeThisRequest;
+    assert (lState._firstDateTimeRequest == false);
+
+    // Draw the cumulative probability of this request.
+    const double lDemandMean = getDemandDistribution()._meanNumberOfRequests;
+    double lCumulativeProbabilityThisRequest = lState._cumulativeProbabilityUpperBound;
+    if (lDemandMean > 0.0) {
+      CounterBasedRandomGeneration lGenerator =
+        getRandomGenerator (REQUEST_DATE_TIME_SUB_STREAM);
+      lCumulativeProbabilityThisRequest = lState._cumulativeProbabilityLastRequest
+        + getFamily().getExponentialSampler().generateExponential (lGenerator,
+                                                                   lDemandMean);
+      setDrawIndex (REQUEST_DATE_TIME_SUB_STREAM, lGenerator);
     }
-    
-    // Get the upper bound of the current daily rate interval.
-    stdair::FloatDuration_T lUpperBound =
-      lArrivalPattern.getUpperBound (_dateTimeLastRequest);
-
-    // Compute the daily rate demand.
-    double lDailyRate =lArrivalPattern.getDerivativeValue(_dateTimeLastRequest);
-    // Get the expected average number of requests.
-    const double lDemandMean = _demandDistribution._meanNumberOfRequests;
-    // Multiply the daily rate by the expected average number of requests.
-    lDailyRate *= lDemandMean;
-
-    // Generate an exponential variable.
-    const stdair::FloatDuration_T lExponentialVariable =
-      _requestDateTimeRandomGenerator.generateExponential (lDailyRate);
-
-    // Compute the new date time request.
-    const stdair::FloatDuration_T lDateTimeThisRequest =
-      _dateTimeLastRequest + lExponentialVariable;
-
-    stdair::DateTime_T oDateTimeThisRequest;
 
-    // Verify if this request is in the given daily rate interval.
-    if (lDateTimeThisRequest < lUpperBound) {
+    // If the request falls beyond the lower bound of the last daily rate
+    // interval, we stopped generating request by returning a request
+    // date time after departure date time.
+    if (!(lCumulativeProbabilityThisRequest < lState._cumulativeProbabilityUpperBound)) {
+      lState._stillHavingRequestsToBeGenerated = false;
+      lState._cumulativeProbabilityLastRequest = lState._cumulativeProbabilityUpperBound;
+
+      // Calculate a request date-time after the departure date time
+      // (i.e., a positive number of days after it) to end the demand
+      // generation algorithm.
+      return convertIntoEpochTime (-DEFAULT_LAST_LOWER_BOUND_ARRIVAL_PATTERN);
+    }
 
-      // Conversion.
-      const stdair::Duration_T lDifferenceBetweenDepartureAndThisRequest =
-        convertFloatIntoDuration (lDateTimeThisRequest);
+    // Invert the cumulative distribution.
+    const stdair::FloatDuration_T lDateTimeThisRequest =
+      lArrivalPattern.getValue (lCumulativeProbabilityThisRequest);
 
-      // The request date-time is derived from departure date and arrival pattern.
-      oDateTimeThisRequest = lDepartureDateTime
-        + lDifferenceBetweenDepartureAndThisRequest;
+    // The request date-time is derived from departure date and arrival pattern.
+    const EpochTime_T oDateTimeThisRequest =
+      convertIntoEpochTime (lDateTimeThisRequest);
 
-      // Remember this date time request.
-      _dateTimeLastRequest = lDateTimeThisRequest;
+    // Remember the cumulative probability of this request.
+    lState._cumulativeProbabilityLastRequest = lCumulativeProbabilityThisRequest;
       
-      // Update the counter of requests generated so far.
-      incrementGeneratedRequestsCounter();
-
-      const double lRefDateTimeThisRequest = lDateTimeThisRequest + double(28800.001/86400.0);
-      STDAIR_LOG_NOTIFICATION (boost::gregorian::to_iso_string(_key.getPreferredDepartureDate()) << ";" << std::setprecision(10) << lRefDateTimeThisRequest);
-    } else {
-      
-      // The current request is not in the given daily rate interval.
-      // Change the daily rate.
-      _dateTimeLastRequest = lUpperBound;
+    // Update the counter of requests generated so far.
+    incrementGeneratedRequestsCounter();
 
-      // Generate a date time request in the new daily rate interval.
-      oDateTimeThisRequest = generateTimeOfRequestPoissonProcess ();
-    }
+    // TRACE
+    const double lRefDateTimeThisRequest = lDateTimeThisRequest + double(28800.001/86400.0);
+    getFamily().getTraceSink().traceTimeOfRequest (*this,
+                                                   lRefDateTimeThisRequest);
     
     return oDateTimeThisRequest;
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::DateTime_T DemandStream::generateTimeOfRequestStatisticsOrder() {
+  const EpochTime_T DemandStream::generateTimeOfRequestStatisticsOrder() {
    
     /**
      * Sequential Generation in Increasing Order.
@@ -312,6 +344,10 @@ namespace TRADEMGEN {
      * F^{-1}_{ X(k) | X(k - 1) = x(k - 1) } (y)
      *               = 1 - (1 - x(k - 1))(1 - y)^{1/(n - k + 1)}
      *
+     * In log space, with E = -log(1 - y) following an exponential
+     * distribution of rate 1:
+     * log(1 - x(k)) = log(1 - x(k - 1)) - E/(n - k + 1)
+     *
      */
 
     //
@@ -331,74 +367,65 @@ namespace TRADEMGEN {
     // Assert that there are still requests to be generated.
     assert (lRemainingNumberOfRequestsToBeGenerated > 0);
 
-    // 3) Inverse the number of requests not generated yet.
-    //    1/(n - k + 1)
-    const double lRemainingRate =
-      1.0 / static_cast<double> (lRemainingNumberOfRequestsToBeGenerated);
-   
-    // 4) Get the cumulative probality so far and take its complement.
-    //    (equal to 1 - x(k-1))
-    const stdair::Probability_T& lCumulativeProbabilitySoFar =
-      _randomGenerationContext.getCumulativeProbabilitySoFar();
-    const stdair::Probability_T lComplementOfCumulativeProbabilitySoFar =
-      1.0 - lCumulativeProbabilitySoFar;
-
-    // 5) Draw a random variable y and calculate the factor equal to 
-    //    (1 - y)^(1/(n - k + 1)).
-    const stdair::Probability_T& lVariate = _requestDateTimeRandomGenerator();
-    double lFactor = std::pow (1.0 - lVariate, lRemainingRate);
-    if (lFactor >= 1.0 - 1e-6){
-      lFactor = 1.0 - 1e-6;
-    }
+    // 3) Draw a random variable y, and advance the logarithm of the
+    //    complement of the cumulative probability so far.
+    //    (equal to log(1 - x(k-1)) + log(1 - y)/(n - k + 1))
+    CounterBasedRandomGeneration lGenerator =
+      getRandomGenerator (REQUEST_DATE_TIME_SUB_STREAM);
+    const stdair::Probability_T lVariate = lGenerator();
+    setDrawIndex (REQUEST_DATE_TIME_SUB_STREAM, lGenerator);
+    _randomGenerationContext.
+      advanceCumulativeProbabilitySoFar (lVariate,
+                                         lRemainingNumberOfRequestsToBeGenerated);
+    
+    // Update the counter of requests generated so far.
+    incrementGeneratedRequestsCounter();
+
+    return generateTimeOfAdvancedRequest();
+  }
 
-    // 6) Apply the whole formula above to calculate the cumulative probability
-    //    of the new request.
-    //    (equal to 1 - (1 - x(k-1))(1 - y)^(1/(n - k + 1)))
+  // ////////////////////////////////////////////////////////////////////
+  const EpochTime_T DemandStream::generateTimeOfAdvancedRequest() {
     const stdair::Probability_T lCumulativeProbabilityThisRequest =
-      1.0 - lComplementOfCumulativeProbabilitySoFar * lFactor;
-    
+      _randomGenerationContext.getCumulativeProbabilitySoFar();
+
     // Now that the cumulative proportion of events generated has been
     // calculated, we deduce from the arrival pattern the arrival time of the
     // k-th event.
     const stdair::FloatDuration_T lNumberOfDaysBetweenDepartureAndThisRequest =
-      _demandCharacteristics._arrivalPattern.getValue (lCumulativeProbabilityThisRequest);
-    
-    const stdair::Duration_T lDifferenceBetweenDepartureAndThisRequest =
-      convertFloatIntoDuration (lNumberOfDaysBetweenDepartureAndThisRequest);
-
-    const stdair::Time_T lHardcodedReferenceDepartureTime =
-      boost::posix_time::hours (8);
+      getDemandCharacteristics()._arrivalPattern.getValue (lCumulativeProbabilityThisRequest);
     
-    const stdair::DateTime_T lDepartureDateTime =
-      boost::posix_time::ptime (_key.getPreferredDepartureDate(),
-                                lHardcodedReferenceDepartureTime);
-
     // The request date-time is derived from departure date and arrival pattern.
-    const stdair::DateTime_T oDateTimeThisRequest =
-      lDepartureDateTime + lDifferenceBetweenDepartureAndThisRequest;
-    
-    // Update random generation context
-    _randomGenerationContext.setCumulativeProbabilitySoFar (lCumulativeProbabilityThisRequest);
-
-    // Update the counter of requests generated so far.
-    incrementGeneratedRequestsCounter();
+    const EpochTime_T oDateTimeThisRequest =
+      convertIntoEpochTime (lNumberOfDaysBetweenDepartureAndThisRequest);
 
     // DEBUG
     // STDAIR_LOG_DEBUG (lCumulativeProbabilityThisRequest << "; "
     //                   << lNumberOfDaysBetweenDepartureAndThisRequest);
 
-    // NOTIFICATION
-    double lRefNumberOfDaysBetweenDepartureAndThisRequest =
+    // TRACE
+    const double lRefNumberOfDaysBetweenDepartureAndThisRequest =
       lNumberOfDaysBetweenDepartureAndThisRequest + double(1.0/3.0);
-    STDAIR_LOG_NOTIFICATION (boost::gregorian::to_iso_string(_key.getPreferredDepartureDate()) << ";" << std::setprecision(10) << lRefNumberOfDaysBetweenDepartureAndThisRequest);
+    getFamily().getTraceSink().
+      traceTimeOfRequest (*this, lRefNumberOfDaysBetweenDepartureAndThisRequest);
     
     return oDateTimeThisRequest;
   }
 
   // ////////////////////////////////////////////////////////////////////
+  const EpochTime_T DemandStream::
+  getEpochTimeOfRequest (const stdair::Probability_T& iCumulativeProbability) const {
+    // Deduce the arrival time from the arrival pattern.
+    const stdair::FloatDuration_T lNumberOfDaysBetweenDepartureAndThisRequest =
+      getDemandCharacteristics()._arrivalPattern.getValue (iCumulativeProbability);
+
+    return convertIntoEpochTime (lNumberOfDaysBetweenDepartureAndThisRequest);
+  }
 
-  const stdair::Duration_T DemandStream::
-  convertFloatIntoDuration (const stdair::FloatDuration_T iNumberOfDays) {
+  // ////////////////////////////////////////////////////////////////////
+
+  const EpochTime_T DemandStream::
+  convertIntoEpochTime (const stdair::FloatDuration_T iNumberOfDays) const {
     
     // Convert the number of days in number of seconds + number of milliseconds
     const stdair::FloatDuration_T lNumberOfSeconds =
@@ -418,213 +445,337 @@ namespace TRADEMGEN {
     const stdair::IntDuration_T lIntNumberOfMilliseconds =
       std::floor (lNumberOfMilliseconds) + 1;
 
-    // Convert the number of seconds and milliseconds into a duration.
-    const stdair::Duration_T lDifferenceBetweenDepartureAndThisRequest =
-      boost::posix_time::seconds (lIntNumberOfSeconds)
-      + boost::posix_time::millisec (lIntNumberOfMilliseconds);
-
-    return lDifferenceBetweenDepartureAndThisRequest;
+    // Add the number of seconds and milliseconds to the reference
+    // departure date-time.
+    return _preferredDepartureDateEpochTime + DEFAULT_REFERENCE_DEPARTURE_TIME
+      + lIntNumberOfSeconds * EpochTimeManager::MILLISECONDS_IN_ONE_SECOND
+      + lIntNumberOfMilliseconds;
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::AirportCode_T DemandStream::generatePOS() {
+  const stdair::AirportCode_T DemandStream::
+  generatePOS (CounterBasedRandomGeneration& ioGenerator) {
     
     // Generate a random number between 0 and 1.
-    const stdair::Probability_T& lVariate = _demandCharacteristicsRandomGenerator();
-    const stdair::AirportCode_T& oPOS = _demandCharacteristics.getPOSValue (lVariate);
+    const stdair::Probability_T lVariate = ioGenerator();
+    const stdair::AirportCode_T& oPOS = getDemandCharacteristics().getPOSValue (lVariate);
 
     return oPOS;
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::ChannelLabel_T DemandStream::generateChannel() {
+  const stdair::ChannelLabel_T DemandStream::
+  generateChannel (CounterBasedRandomGeneration& ioGenerator) {
     // Generate a random number between 0 and 1.
     const stdair::Probability_T lVariate =
-      _demandCharacteristicsRandomGenerator();
+      ioGenerator();
 
-    return _demandCharacteristics._channelProbabilityMass.getValue (lVariate);
+    return getDemandCharacteristics().getChannelValue (lVariate);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::TripType_T DemandStream::generateTripType() {
+  const stdair::TripType_T DemandStream::
+  generateTripType (CounterBasedRandomGeneration& ioGenerator) {
     // Generate a random number between 0 and 1.
     const stdair::Probability_T lVariate =
-      _demandCharacteristicsRandomGenerator(); 
+      ioGenerator();
 
-    return _demandCharacteristics._tripTypeProbabilityMass.getValue (lVariate);
+    return getDemandCharacteristics().getTripTypeValue (lVariate);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::DayDuration_T DemandStream::generateStayDuration() {
+  const stdair::DayDuration_T DemandStream::
+  generateStayDuration (CounterBasedRandomGeneration& ioGenerator) {
     // Generate a random number between 0 and 1.
     const stdair::Probability_T lVariate =
-      _demandCharacteristicsRandomGenerator();    
+      ioGenerator();
 
-    return _demandCharacteristics._stayDurationProbabilityMass.getValue (lVariate);
+    return getDemandCharacteristics().getStayDurationValue (lVariate);
   }
   
   // ////////////////////////////////////////////////////////////////////
-  const stdair::FrequentFlyer_T DemandStream::generateFrequentFlyer() {
+  const stdair::FrequentFlyer_T DemandStream::
+  generateFrequentFlyer (CounterBasedRandomGeneration& ioGenerator) {
     // Generate a random number between 0 and 1.
     const stdair::Probability_T lVariate =
-      _demandCharacteristicsRandomGenerator();       
+      ioGenerator();
 
-    return _demandCharacteristics._frequentFlyerProbabilityMass.getValue (lVariate);
+    return getDemandCharacteristics().getFrequentFlyerValue (lVariate);
   }
   
   // ////////////////////////////////////////////////////////////////////
-  const stdair::ChangeFees_T DemandStream::generateChangeFees() {
+  const stdair::ChangeFees_T DemandStream::
+  generateChangeFees (CounterBasedRandomGeneration& ioGenerator) {
     // Generate a random number between 0 and 1.
     const stdair::Probability_T lVariate =
-      _demandCharacteristicsRandomGenerator();
-    if (lVariate < _demandCharacteristics._changeFeeProb) {
+      ioGenerator();
+    if (lVariate < getDemandCharacteristics()._changeFeeProb) {
       return true;
     }
     return false;    
   }
   
   // ////////////////////////////////////////////////////////////////////
-  const stdair::NonRefundable_T DemandStream::generateNonRefundable() {
+  const stdair::NonRefundable_T DemandStream::
+  generateNonRefundable (CounterBasedRandomGeneration& ioGenerator) {
     // Generate a random number between 0 and 1.
     const stdair::Probability_T lVariate =
-      _demandCharacteristicsRandomGenerator();
-    if (lVariate < _demandCharacteristics._nonRefundableProb) {
+      ioGenerator();
+    if (lVariate < getDemandCharacteristics()._nonRefundableProb) {
       return true;
     }
     return false;    
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::Duration_T DemandStream::generatePreferredDepartureTime() {
+  const Code_T DemandStream::
+  generatePOSCode (CounterBasedRandomGeneration& ioGenerator) {
     // Generate a random number between 0 and 1.
     const stdair::Probability_T lVariate =
-      _demandCharacteristicsRandomGenerator();     
-    const stdair::IntDuration_T lNbOfSeconds = _demandCharacteristics.
-      _preferredDepartureTimeCumulativeDistribution.getValue (lVariate);
+      ioGenerator();
 
-    const stdair::Duration_T oTime = boost::posix_time::seconds (lNbOfSeconds);
+    return getDemandCharacteristics().getPOSCode (lVariate);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const Code_T DemandStream::
+  generateChannelCode (CounterBasedRandomGeneration& ioGenerator) {
+    // Generate a random number between 0 and 1.
+    const stdair::Probability_T lVariate =
+      ioGenerator();
+
+    return getDemandCharacteristics().getChannelCode (lVariate);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const Code_T DemandStream::
+  generateTripTypeCode (CounterBasedRandomGeneration& ioGenerator) {
+    // Generate a random number between 0 and 1.
+    const stdair::Probability_T lVariate =
+      ioGenerator();
+
+    return getDemandCharacteristics().getTripTypeCode (lVariate);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const Code_T DemandStream::
+  generateFrequentFlyerCode (CounterBasedRandomGeneration& ioGenerator) {
+    // Generate a random number between 0 and 1.
+    const stdair::Probability_T lVariate =
+      ioGenerator();
+
+    return getDemandCharacteristics().getFrequentFlyerCode (lVariate);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const stdair::IntDuration_T DemandStream::
+  generatePreferredDepartureTime (CounterBasedRandomGeneration& ioGenerator) {
+    // Generate a random number between 0 and 1.
+    const stdair::Probability_T lVariate =
+      ioGenerator();
+    const stdair::IntDuration_T oNbOfSeconds = getDemandCharacteristics().
+      _preferredDepartureTimeCumulativeDistribution.getValue (lVariate);
 
-    return oTime;
+    return oNbOfSeconds;
   }
 
   // ////////////////////////////////////////////////////////////////////
   const stdair::WTP_T DemandStream::
-  generateWTP (stdair::RandomGeneration& ioGenerator,
-               const stdair::Date_T& iDepartureDate,
-               const stdair::DateTime_T& iDateTimeThisRequest,
+  generateWTP (CounterBasedRandomGeneration& ioGenerator,
+               const EpochTime_T& iDateTimeThisRequest,
                const stdair::DayDuration_T& iDurationOfStay) {
-    const stdair::Date_T lDateThisRequest = iDateTimeThisRequest.date();
-    const stdair::DateOffset_T lAP = iDepartureDate - lDateThisRequest;
-    const stdair::DayDuration_T lAPInDays = lAP.days();
+    // Advance purchase (in days)
+    const stdair::DayDuration_T lAPInDays = static_cast<stdair::DayDuration_T>
+      (EpochTimeManager::getNbOfDays (_preferredDepartureDateEpochTime)
+       - EpochTimeManager::getNbOfDays (iDateTimeThisRequest));
 
     stdair::RealNumber_T lProb = -lAPInDays;
     stdair::RealNumber_T lFrat5Coef =
-      _demandCharacteristics._frat5Pattern.getValue (lProb);
+      getDemandCharacteristics()._frat5Pattern.getValue (lProb);
 
-    const stdair::WTP_T lWTP =  _demandCharacteristics._minWTP
-      * (1.0 + (lFrat5Coef - 1.0) * log(ioGenerator()) / log(0.5));
+    // -log(y), for y drawn uniformly, is an exponential variate of rate 1.
+    const double lExponentialVariable =
+      getFamily().getExponentialSampler() (ioGenerator);
+    const stdair::WTP_T lWTP =  getDemandCharacteristics()._minWTP
+      * (1.0 + (lFrat5Coef - 1.0) * lExponentialVariable / log(2.0));
     
     return lWTP;
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::PriceValue_T DemandStream::generateValueOfTime() {
+  const stdair::PriceValue_T DemandStream::
+  generateValueOfTime (CounterBasedRandomGeneration& ioGenerator) {
     // Generate a random number between 0 and 1.
     const stdair::Probability_T lVariate =
-      _demandCharacteristicsRandomGenerator();    
+      ioGenerator();
 
-    return _demandCharacteristics._valueOfTimeCumulativeDistribution.getValue (lVariate);
+    return getDemandCharacteristics()._valueOfTimeCumulativeDistribution.getValue (lVariate);
   }
   
   // ////////////////////////////////////////////////////////////////////
   stdair::BookingRequestPtr_T DemandStream::
-  generateNextRequest (stdair::RandomGeneration& ioGenerator,
-                       const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
-
-    // Origin
-    const stdair::AirportCode_T& lOrigin = _key.getOrigin();
-    // Destination
-    const stdair::AirportCode_T& lDestination = _key.getDestination();
-    // Preferred departure date
-    const stdair::Date_T& lPreferredDepartureDate = 
-      _key.getPreferredDepartureDate();
-    // Preferred cabin
-    const stdair::CabinCode_T& lPreferredCabin = _key.getPreferredCabin();
-    // Party size
-    const stdair::NbOfSeats_T lPartySize = stdair::DEFAULT_PARTY_SIZE;
-    // POS
-    const stdair::AirportCode_T lPOS = generatePOS();
-    
-    // Compute the request date time with the correct algorithm.
-    stdair::DateTime_T lDateTimeThisRequest;
+  generateNextRequest (const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
+
+    // Generate the attributes of the request
+    BookingRequestRecord lBookingRequestRecord;
+    generateNextRequest (iDemandGenerationMethod, lBookingRequestRecord);
+
+    // TODO: move the creation of the structure out of the BOM layer
+    //  (into the command layer, e.g., within the DemandManager command).
+
+    // Create the booking request
+    return createBookingRequest (lBookingRequestRecord);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void DemandStream::
+  generateNextRequest (const stdair::DemandGenerationMethod& iDemandGenerationMethod,
+                       BookingRequestRecord& ioBookingRequestRecord) {
     const stdair::DemandGenerationMethod::EN_DemandGenerationMethod& lENDemandGenerationMethod =
       iDemandGenerationMethod.getMethod();
-    switch(lENDemandGenerationMethod) {
+    switch (lENDemandGenerationMethod) {
     case stdair::DemandGenerationMethod::POI_PRO:
-      lDateTimeThisRequest = generateTimeOfRequestPoissonProcess(); break;
+      generateNextRequestWith<PoissonProcessMethod> (ioBookingRequestRecord);
+      break;
     case stdair::DemandGenerationMethod::STA_ORD:
-      lDateTimeThisRequest = generateTimeOfRequestStatisticsOrder(); break;
+      generateNextRequestWith<StatisticsOrderMethod> (ioBookingRequestRecord);
+      break;
     default: assert (false); break;
     }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  template <typename GENERATION_METHOD>
+  void DemandStream::
+  generateNextRequestWith (BookingRequestRecord& ioBookingRequestRecord) {
+
+    // Categorical characteristics, drawn directly as codes of the
+    // CodePool.
+    CounterBasedRandomGeneration lGenerator =
+      getRandomGenerator (DEMAND_CHARACTERISTICS_SUB_STREAM);
+    Code_T lPOSCode;
+    Code_T lChannelCode;
+    Code_T lTripTypeCode;
+    stdair::DayDuration_T lStayDuration = 0;
+    Code_T lFrequentFlyerCode;
+    stdair::ChangeFees_T lChangeFees = false;
+    stdair::NonRefundable_T lNonRefundable = false;
+    if (getDemandCharacteristics().isJointCharacteristicsSampled() == true) {
+      // Draw all of them at once, from a single random number.
+      const stdair::Probability_T lVariate = lGenerator();
+      getDemandCharacteristics().
+        getJointCharacteristicCodes (lVariate, lPOSCode, lChannelCode,
+                                     lTripTypeCode, lStayDuration,
+                                     lFrequentFlyerCode, lChangeFees,
+                                     lNonRefundable);
+    } else {
+      // POS
+      lPOSCode = generatePOSCode (lGenerator);
+      // Booking channel.
+      lChannelCode = generateChannelCode (lGenerator);
+      // Trip type.
+      lTripTypeCode = generateTripTypeCode (lGenerator);
+      // Stay duration.
+      lStayDuration = generateStayDuration (lGenerator);
+      // Frequet flyer type.
+      lFrequentFlyerCode = generateFrequentFlyerCode (lGenerator);
+      // Change fees
+      lChangeFees = generateChangeFees (lGenerator);
+      // Non refundable
+      lNonRefundable = generateNonRefundable (lGenerator);
+    }
+    
+    // Compute the request date time with the given algorithm.
+    const EpochTime_T lDateTimeThisRequest =
+      GENERATION_METHOD::generateTimeOfRequest (*this);
     
-    // Booking channel.
-    const stdair::ChannelLabel_T lChannelLabel = generateChannel();
-    // Trip type.
-    const stdair::TripType_T lTripType = generateTripType();
-    // Stay duration.
-    const stdair::DayDuration_T lStayDuration = generateStayDuration();
-    // Frequet flyer type.
-    const stdair::FrequentFlyer_T lFrequentFlyer = generateFrequentFlyer();
-    // Change fees
-    const stdair::ChangeFees_T lChangeFees = generateChangeFees();
+    // Preferred departure time (in seconds).
+    const stdair::IntDuration_T lPreferredDepartureTime =
+      generatePreferredDepartureTime (lGenerator);
+    // Value of time
+    const stdair::PriceValue_T lValueOfTime = generateValueOfTime (lGenerator);
+    // WTP
+    const stdair::WTP_T lWTP =
+      generateWTP (lGenerator, lDateTimeThisRequest, lStayDuration);
+    setDrawIndex (DEMAND_CHARACTERISTICS_SUB_STREAM, lGenerator);
+
+    // Fill the record.
+    ioBookingRequestRecord._requestDateTime = lDateTimeThisRequest;
+    ioBookingRequestRecord._wtp = lWTP;
+    ioBookingRequestRecord._valueOfTime = lValueOfTime;
+    ioBookingRequestRecord._demandStreamHandle = _handle;
+    ioBookingRequestRecord._pos = lPOSCode;
+    ioBookingRequestRecord._channel = lChannelCode;
+    ioBookingRequestRecord._tripType = lTripTypeCode;
+    ioBookingRequestRecord._frequentFlyerType = lFrequentFlyerCode;
+    ioBookingRequestRecord._stayDuration = lStayDuration;
+    ioBookingRequestRecord._preferredDepartureTime =
+      static_cast<boost::int32_t> (lPreferredDepartureTime);
+    ioBookingRequestRecord._changeFees = lChangeFees;
+    ioBookingRequestRecord._nonRefundable = lNonRefundable;
+
+    // TRACE
+    getFamily().getTraceSink().traceBookingRequest (*this,
+                                                    ioBookingRequestRecord);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::BookingRequestPtr_T DemandStream::
+  createBookingRequest (const BookingRequestRecord& iBookingRequestRecord) const {
+    assert (iBookingRequestRecord._demandStreamHandle == _handle);
+
+    // Party size
+    const stdair::NbOfSeats_T lPartySize = stdair::DEFAULT_PARTY_SIZE;
     // Change fee disutility
     const stdair::Disutility_T lChangeFeeDisutility =
-      _demandCharacteristics._changeFeeDisutility;
-    // Non refundable
-    const stdair::NonRefundable_T lNonRefundable = generateNonRefundable();
+      getDemandCharacteristics()._changeFeeDisutility;
     // Non refundable disutility
     const stdair::Disutility_T lNonRefundableDisutility =
-      _demandCharacteristics._nonRefundableDisutility;
-    // Preferred departure time.
+      getDemandCharacteristics()._nonRefundableDisutility;
+    // Date-time of the request
+    const stdair::DateTime_T lDateTimeThisRequest = EpochTimeManager::
+      convertIntoDateTime (iBookingRequestRecord._requestDateTime);
+    // Preferred departure time
     const stdair::Duration_T lPreferredDepartureTime =
-      generatePreferredDepartureTime();
-    // Value of time
-    const stdair::PriceValue_T lValueOfTime = generateValueOfTime();
-    // WTP
-    const stdair::WTP_T lWTP = generateWTP (ioGenerator,lPreferredDepartureDate,
-                                            lDateTimeThisRequest,lStayDuration);
-
-    // TODO: move the creation of the structure out of the BOM layer
-    //  (into the command layer, e.g., within the DemandManager command).
-    
-    // Create the booking request
-    stdair::BookingRequestStruct lBookingRequestStruct (describeKey(), lOrigin,
-                                                        lDestination, lPOS,
-                                                        lPreferredDepartureDate,
-                                                        lDateTimeThisRequest,
-                                                        lPreferredCabin, lPartySize,
-                                                        lChannelLabel, lTripType,
-                                                        lStayDuration, lFrequentFlyer,
-                                                        lPreferredDepartureTime,
-                                                        lWTP, lValueOfTime, lChangeFees,
-                                                        lChangeFeeDisutility, lNonRefundable,
-                                                        lNonRefundableDisutility);
-  
-    stdair::BookingRequestPtr_T oBookingRequest_ptr =
-      boost::make_shared<stdair::BookingRequestStruct>  (lBookingRequestStruct);
-    
-    // DEBUG  
-    // Be careful: this specific display is mandatory to retrieve the booking 
-    // requests when parsing the demand generation log with python scripts.
-    STDAIR_LOG_NOTIFICATION ("\n[BKG] " << oBookingRequest_ptr->describe());
-    
-    return oBookingRequest_ptr;
+      boost::posix_time::seconds (iBookingRequestRecord._preferredDepartureTime);
+
+    // Build the structure in place, within its block of the pool
+    const CodePool& lCodePool = CodePool::instance();
+    return BookingRequestPool::
+      create (describeKey(), getOrigin(), getDestination(),
+              lCodePool.getString (iBookingRequestRecord._pos),
+              _preferredDepartureDate,
+              lDateTimeThisRequest, getPreferredCabin(),
+              lPartySize,
+              lCodePool.getString (iBookingRequestRecord._channel),
+              lCodePool.getString (iBookingRequestRecord._tripType),
+              iBookingRequestRecord._stayDuration,
+              lCodePool.getString (iBookingRequestRecord._frequentFlyerType),
+              lPreferredDepartureTime, iBookingRequestRecord._wtp,
+              iBookingRequestRecord._valueOfTime,
+              iBookingRequestRecord._changeFees,
+              lChangeFeeDisutility,
+              iBookingRequestRecord._nonRefundable,
+              lNonRefundableDisutility);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  void DemandStream::reset (stdair::BaseGenerator_T& ioSharedGenerator) {
+  void DemandStream::reset() {
     _randomGenerationContext.reset();
-    init (ioSharedGenerator);
+    init();
   }
 
+  // ////////////////////////////////////////////////////////////////////
+  // Generation paths of the generation methods
+  template const bool DemandStream::
+  stillHavingRequestsToBeGeneratedWith<DemandStream::StatisticsOrderMethod>() const;
+  template const bool DemandStream::
+  stillHavingRequestsToBeGeneratedWith<DemandStream::PoissonProcessMethod>() const;
+  template void DemandStream::
+  generateNextRequestWith<DemandStream::StatisticsOrderMethod> (BookingRequestRecord&);
+  template void DemandStream::
+  generateNextRequestWith<DemandStream::PoissonProcessMethod> (BookingRequestRecord&);
+  template void DemandStream::
+  generateNextRequestWith<DemandStream::AdvancedStatisticsOrderMethod> (BookingRequestRecord&);
+
 }
@@ -4,88 +4,122 @@
 // //////////////////////////////////////////////////////////////////////
 // Import section
 // //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <string>
 // StdAir
-#include <stdair/bom/BomAbstract.hpp>
 #include <stdair/bom/BookingRequestTypes.hpp>
-#include <stdair/basic/RandomGeneration.hpp>
 #include <stdair/basic/DemandGenerationMethod.hpp>
 // TraDemGen
+#include <trademgen/TRADEMGEN_Types.hpp>
+#include <trademgen/basic/CounterBasedRandomGeneration.hpp>
 #include <trademgen/basic/DemandCharacteristics.hpp>
 #include <trademgen/basic/DemandDistribution.hpp>
+#include <trademgen/basic/EpochTimeManager.hpp>
 #include <trademgen/basic/RandomGenerationContext.hpp>
+#include <trademgen/bom/BookingRequestRecord.hpp>
 #include <trademgen/bom/DemandStreamKey.hpp>
 #include <trademgen/bom/DemandStreamTypes.hpp>
 
-/// Forward declarations
-namespace stdair {
-  class FacBomManager;
-  template <typename BOM> class FacBom;
-}
-
 namespace TRADEMGEN {
+
+  // Forward declarations
+  class TraceSink;
   
   /**
-   * @brief Class modeling a demand stream.
+   * @brief Class modeling a demand stream, i.e., the generation state
+   * of a given preferred departure date of a demand row.
+   *
+   * The demand streams of a demand row are held contiguously by their
+   * family (see DemandStreamFamily), which is the event generator of
+   * the BOM tree, and which holds the configuration of the row. A
+   * demand stream only holds its preferred departure date, its number
+   * of requests and the state of its random generation; its key and
+   * random stream identifier are derived, when needed, from the ones
+   * of the family and from the date.
    */
-  class DemandStream : public stdair::BomAbstract {
-    template <typename BOM> friend class stdair::FacBom;
-    friend class stdair::FacBomManager;
+  class DemandStream {
+    friend class DemandStreamFamily;
+    friend class DemandStreamEngine;
 
   public:
     // ////////// Type definitions ////////////
     /**
-     * Definition allowing to retrieve the associated BOM key type.
+     * Definition allowing to retrieve the associated key type.
      */
     typedef DemandStreamKey Key_T;
 
+    /**
+     * Sub-streams of the random generation, i.e., independent random
+     * sequences of the demand stream (see CounterBasedRandomGeneration).
+     */
+    typedef enum {
+      REQUEST_DATE_TIME_SUB_STREAM = 0,
+      DEMAND_CHARACTERISTICS_SUB_STREAM,
+      NUMBER_OF_REQUESTS_SUB_STREAM,
+      NB_OF_SUB_STREAMS
+    } EN_SubStream;
+
 
   public:
     // ///////////// Getters ///////////
-    /** Get the key */
-    const Key_T& getKey() const {
-      return _key;
-    }
-    
-    /** Get the parent object (EventQueue). */
-    BomAbstract* const getParent() const {
-      return _parent;
-    }
+    /** Get the key (derived from the family and the date). */
+    const Key_T getKey() const;
     
     /** Get the origin (part of the primary key). */
-    const stdair::AirportCode_T& getOrigin() const {
-      return _key.getOrigin();
-    }
+    const stdair::AirportCode_T& getOrigin() const;
 
     /** Get the destination (part of the primary key). */
-    const stdair::AirportCode_T& getDestination() const {
-      return _key.getDestination();
-    }
+    const stdair::AirportCode_T& getDestination() const;
 
     /** Get the preferred departure date (part of the primary key). */
     const stdair::Date_T& getPreferredDepartureDate() const {
-      return _key.getPreferredDepartureDate();
+      return _preferredDepartureDate;
+    }
+
+    /** Get the epoch time of the preferred departure date (at midnight). */
+    const EpochTime_T& getPreferredDepartureDateEpochTime() const {
+      return _preferredDepartureDateEpochTime;
     }
     
     /** Get the preferred cabin (part of the primary key). */
-    const stdair::CabinCode_T& getPreferredCabin() const {
-      return _key.getPreferredCabin();
-    }
+    const stdair::CabinCode_T& getPreferredCabin() const;
     
-    /** Get the map of children holders. */
-    const stdair::HolderMap_T& getHolderMap() const {
-      return _holderMap;
+    /** Get the handle (index within the registry of the demand streams). */
+    const DemandStreamHandle_T& getHandle() const {
+      return _handle;
     }
-    
-    /** Get the demand characteristics. */
-    const DemandCharacteristics& getDemandCharacteristics() const {
-      return _demandCharacteristics;
+
+    /** Get the trace sink of the family (the NullTraceSink by default). */
+    const TraceSink& getTraceSink() const;
+
+    /** Get the family of the demand stream. */
+    const DemandStreamFamily& getFamily() const {
+      assert (_family != NULL);
+      return *_family;
     }
 
-    /** Get the demand distribution. */
-    const DemandDistribution& getDemandDistribution() const {
-      return _demandDistribution;
+    /**
+     * Get the family of the demand stream, through which the
+     * configuration of the whole family is altered.
+     */
+    DemandStreamFamily& getFamily() {
+      assert (_family != NULL);
+      return *_family;
     }
 
+    /** Get the demand characteristics. */
+    const DemandCharacteristics& getDemandCharacteristics() const;
+
+    /**
+     * Get the (shared) demand characteristics, as handed out by the
+     * DemandCharacteristicsPool.
+     */
+    const DemandCharacteristicsPtr_T& getDemandCharacteristicsPtr() const;
+
+    /** Get the demand distribution. */
+    const DemandDistribution& getDemandDistribution() const;
+
     /** Get the total number of requests to be generated. */
     const stdair::NbOfRequests_T& getTotalNumberOfRequestsToBeGenerated() const{
       return _totalNumberOfRequestsToBeGenerated;
@@ -93,13 +127,19 @@ namespace TRADEMGEN {
 
     /** Get the mean (expected) number of requests. */
     const stdair::NbOfRequests_T& getMeanNumberOfRequests() const {
-      return _demandDistribution._meanNumberOfRequests;
+      return getDemandDistribution()._meanNumberOfRequests;
     }
     
     /** Get the standard deviation of number of requests. */
     const stdair::StdDevValue_T& getStdDevNumberOfRequests() const {
-      return _demandDistribution._stdDevNumberOfRequests;
+      return getDemandDistribution()._stdDevNumberOfRequests;
     }
+
+    /**
+     * Get the stream identifier of the random generation, derived from
+     * the one of the family and from the preferred departure date.
+     */
+    const CounterBasedRandomGeneration::StreamId_T getStreamId() const;
     
     /** Get the number of requests generated so far. */
     const stdair::Count_T& getNumberOfRequestsGeneratedSoFar() const {
@@ -108,21 +148,19 @@ namespace TRADEMGEN {
 
     /** Get the change fee disutility. */
     const stdair::Disutility_T& getChangeFeeDisutility() const {
-      return _demandCharacteristics._changeFeeDisutility;
+      return getDemandCharacteristics()._changeFeeDisutility;
     }
 
     /** Get the non refundable disutility. */
     const stdair::Disutility_T& getNonRefundableDisutility() const {
-      return _demandCharacteristics._nonRefundableDisutility;
+      return getDemandCharacteristics()._nonRefundableDisutility;
     }
 
     /**
      * Get the default POS probablity mass, used when "row" (rest of
      * the world) is drawn.
      */
-    const POSProbabilityMass_T& getPOSProbabilityMass() const {
-      return _posProMass;
-    }
+    const POSProbabilityMass_T& getPOSProbabilityMass() const;
 
 
   public:
@@ -132,34 +170,9 @@ namespace TRADEMGEN {
       _randomGenerationContext.setNumberOfRequestsGeneratedSoFar (iCount);
     }
 
-    /** Set the demand distribution. */
-    void setDemandDistribution (const DemandDistribution& iDemandDistribution) {
-      _demandDistribution = iDemandDistribution;
-    }
-
-    /** Set the demand characteristics. */
-    void
-    setDemandCharacteristics (const ArrivalPatternCumulativeDistribution_T& iArrivalPattern,
-                              const POSProbabilityMassFunction_T& iPOSProbMass,
-                              const ChannelProbabilityMassFunction_T& iChannelProbMass,
-                              const TripTypeProbabilityMassFunction_T& iTripTypeProbMass,
-                              const StayDurationProbabilityMassFunction_T& iStayDurationProbMass,
-                              const FrequentFlyerProbabilityMassFunction_T& iFrequentFlyerProbMass,
-                              const stdair::ChangeFeesRatio_T& iChangeFeeProb,
-                              const stdair::Disutility_T& iChangeFeeDisutility,
-                              const stdair::NonRefundableRatio_T& iNonRefundableProb,
-                              const stdair::Disutility_T& iNonRefundableDisutility,
-                              const PreferredDepartureTimeContinuousDistribution_T& iPreferredDepartureTimeContinuousDistribution,
-                              const stdair::WTP_T& iMinWTP,
-                              const ValueOfTimeContinuousDistribution_T& iValueOfTimeContinuousDistribution) {
-      _demandCharacteristics =
-        DemandCharacteristics (iArrivalPattern, iPOSProbMass,
-                               iChannelProbMass, iTripTypeProbMass,
-                               iStayDurationProbMass, iFrequentFlyerProbMass,
-                               iChangeFeeProb, iChangeFeeDisutility,
-                               iNonRefundableProb, iNonRefundableDisutility,
-                               iPreferredDepartureTimeContinuousDistribution,
-                               iMinWTP, iValueOfTimeContinuousDistribution);
+    /** Set the handle (index within the registry of the demand streams). */
+    void setHandle (const DemandStreamHandle_T& iHandle) {
+      _handle = iHandle;
     }
 
     /** Set the total number of requests to be generated. */
@@ -167,52 +180,12 @@ namespace TRADEMGEN {
       _totalNumberOfRequestsToBeGenerated = iNbOfRequests;
     }
 
-    /** Set the seed of the random generator for the request datetime. */
-    void setRequestDateTimeRandomGeneratorSeed (const stdair::RandomSeed_T& iSeed) {
-      _requestDateTimeRandomGenerator.init (iSeed);
-    }
-
-    /** Set the seed of the random generator for the demand characteristics. */
-    void setDemandCharacteristicsRandomGeneratorSeed (const stdair::RandomSeed_T& iSeed) {
-      _demandCharacteristicsRandomGenerator.init (iSeed);
-    }
-
-    /**
-     * Set the default POS probablity mass, used when "row" (rest of
-     * the world) is drawn.
-     */
-    void setPOSProbabilityMass (const POSProbabilityMass_T& iProbMass) {
-      _posProMass = iProbMass;
-    }
-
-    /**
-     * Initialisation.
-     */
-    void setAll (const ArrivalPatternCumulativeDistribution_T&,
-                 const POSProbabilityMassFunction_T&,
-                 const ChannelProbabilityMassFunction_T&,
-                 const TripTypeProbabilityMassFunction_T&,
-                 const StayDurationProbabilityMassFunction_T&,
-                 const FrequentFlyerProbabilityMassFunction_T&,
-                 const stdair::ChangeFeesRatio_T&,
-                 const stdair::Disutility_T&,
-                 const stdair::NonRefundableRatio_T&,
-                 const stdair::Disutility_T&,
-                 const PreferredDepartureTimeContinuousDistribution_T&,
-                 const stdair::WTP_T&,
-                 const ValueOfTimeContinuousDistribution_T&,
-                 const DemandDistribution&,
-                 stdair::BaseGenerator_T& ioSharedGenerator,
-                 const stdair::RandomSeed_T& iRequestDateTimeSeed,
-                 const stdair::RandomSeed_T& iDemandCharacteristicsSeed,
-                 const POSProbabilityMass_T&);
-
     /**
      * Set the boolean describing if it is the first time we generate a
      * request for a demand stream.
      */
     void setBoolFirstDateTimeRequest (const bool& iFirstDateTimeRequest) {
-      _firstDateTimeRequest = iFirstDateTimeRequest;
+      _poissonProcessState._firstDateTimeRequest = iFirstDateTimeRequest;
     }
     
 
@@ -223,52 +196,99 @@ namespace TRADEMGEN {
       _randomGenerationContext.incrementGeneratedRequestsCounter();
     }
     
-    /** Check whether enough requests have already been generated. */
+    /**
+     * Check whether enough requests have already been generated.
+     *
+     * \note The method is checked at each call. When all the requests
+     *       of a run are generated with the same method, the path
+     *       specialised for that method,
+     *       stillHavingRequestsToBeGeneratedWith(), is to be preferred
+     *       (see BookingRequestRange).
+     */
     const bool stillHavingRequestsToBeGenerated (const stdair::DemandGenerationMethod& iDemandGenerationMethod) const;
 
-    /** Generate the time of the next request with poisson process. */
-    const stdair::DateTime_T generateTimeOfRequestPoissonProcess();
+    /** Generate the (epoch) time of the next request with poisson process. */
+    const EpochTime_T generateTimeOfRequestPoissonProcess();
+
+    /** Generate the (epoch) time of the next request with statistics order */
+    const EpochTime_T generateTimeOfRequestStatisticsOrder();
+
+    /**
+     * Generate the (epoch) time of the request, the cumulative
+     * probability of which has just been drawn, either by
+     * generateTimeOfRequestStatisticsOrder() or by the
+     * DemandStreamEngine.
+     */
+    const EpochTime_T generateTimeOfAdvancedRequest();
+
+    /**
+     * Get the epoch time of a request, given its cumulative probability
+     * within the arrival pattern (without any side effect, e.g., for
+     * the cumulative probabilities drawn by the DemandStreamEngine).
+     */
+    const EpochTime_T
+    getEpochTimeOfRequest (const stdair::Probability_T&) const;
+
+    /**
+     * Get a random generator positioned at the next draw of the given
+     * sub-stream. The draws are given back to the demand stream by
+     * setDrawIndex().
+     */
+    CounterBasedRandomGeneration getRandomGenerator (const EN_SubStream&) const;
 
-    /** Generate the time of the next request with statistics order */
-    const stdair::DateTime_T generateTimeOfRequestStatisticsOrder();
+    /**
+     * Move the given sub-stream to the next draw of the given random
+     * generator (obtained from getRandomGenerator()).
+     */
+    void setDrawIndex (const EN_SubStream&, const CounterBasedRandomGeneration&);
 
     /** Generate the POS. */
-    const stdair::AirportCode_T generatePOS();
+    const stdair::AirportCode_T generatePOS (CounterBasedRandomGeneration&);
 
     /** Generate the reservation channel. */
-    const stdair::ChannelLabel_T generateChannel();
+    const stdair::ChannelLabel_T generateChannel (CounterBasedRandomGeneration&);
 
     /** Generate the trip type. */
-    const stdair::TripType_T generateTripType();
+    const stdair::TripType_T generateTripType (CounterBasedRandomGeneration&);
 
     /** Generate the stay duration. */
-    const stdair::DayDuration_T generateStayDuration();
+    const stdair::DayDuration_T generateStayDuration (CounterBasedRandomGeneration&);
 
     /** Generate the frequent flyer type. */
-    const stdair::FrequentFlyer_T generateFrequentFlyer();
+    const stdair::FrequentFlyer_T generateFrequentFlyer (CounterBasedRandomGeneration&);
 
     /** Generate the change fee acceptation. */
-    const stdair::ChangeFees_T generateChangeFees();
+    const stdair::ChangeFees_T generateChangeFees (CounterBasedRandomGeneration&);
 
     /** Generate the non refundable acceptation. */
-    const stdair::NonRefundable_T generateNonRefundable();
+    const stdair::NonRefundable_T generateNonRefundable (CounterBasedRandomGeneration&);
+
+    /** Generate the code (within the CodePool) of the POS. */
+    const Code_T generatePOSCode (CounterBasedRandomGeneration&);
+
+    /** Generate the code of the reservation channel. */
+    const Code_T generateChannelCode (CounterBasedRandomGeneration&);
 
-    /** Generate the preferred departure time. */
-    const stdair::Duration_T generatePreferredDepartureTime();
+    /** Generate the code of the trip type. */
+    const Code_T generateTripTypeCode (CounterBasedRandomGeneration&);
+
+    /** Generate the code of the frequent flyer type. */
+    const Code_T generateFrequentFlyerCode (CounterBasedRandomGeneration&);
+
+    /** Generate the preferred departure time (in seconds since midnight). */
+    const stdair::IntDuration_T generatePreferredDepartureTime (CounterBasedRandomGeneration&);
     
     /** Generate the WTP. */
-    const stdair::WTP_T generateWTP (stdair::RandomGeneration&,
-                                     const stdair::Date_T&,
-                                     const stdair::DateTime_T&,
+    const stdair::WTP_T generateWTP (CounterBasedRandomGeneration&,
+                                     const EpochTime_T&,
                                      const stdair::DayDuration_T&);
 
     /** Generate the value of time. */
-    const stdair::PriceValue_T generateValueOfTime();
+    const stdair::PriceValue_T generateValueOfTime (CounterBasedRandomGeneration&);
     
     /**
      * Generate the next request.
      *
-     * @param stdair::RandomGeneration Random generator.
      * @param const stdair::DemandGenerationMethod::EN_DemandGenerationMethod
      *        Method used to generate the date time of the next
      *        booking request: statistic order or poisson process.
@@ -276,11 +296,90 @@ namespace TRADEMGEN {
      *
      */
     stdair::BookingRequestPtr_T
-    generateNextRequest (stdair::RandomGeneration&,
-                         const stdair::DemandGenerationMethod&);
+    generateNextRequest (const stdair::DemandGenerationMethod&);
+
+    /**
+     * Generate the next request, as a compact record (neither the
+     * stdair::BookingRequestStruct nor the log notification are
+     * created).
+     *
+     * The same random numbers are drawn as by the above method, so
+     * that both methods can be used interchangeably.
+     *
+     * \note As for stillHavingRequestsToBeGenerated(), the method is
+     *       checked at each call, before generateNextRequestWith() is
+     *       called.
+     */
+    void generateNextRequest (const stdair::DemandGenerationMethod&,
+                              BookingRequestRecord&);
+
+    /**
+     * Create the booking request structure corresponding to a record
+     * generated by that demand stream.
+     */
+    stdair::BookingRequestPtr_T
+    createBookingRequest (const BookingRequestRecord&) const;
+
+    /**
+     * State whether a request generated by that demand stream occurs
+     * before the preferred departure date-time (otherwise, it is not
+     * to be simulated, and the demand stream is done).
+     */
+    bool isBeforePreferredDepartureDateTime (const BookingRequestRecord& iBookingRequestRecord) const {
+      const EpochTime_T lPreferedDepartureDateTime =
+        _preferredDepartureDateEpochTime
+        + iBookingRequestRecord._preferredDepartureTime
+        * EpochTimeManager::MILLISECONDS_IN_ONE_SECOND;
+      return (iBookingRequestRecord._requestDateTime
+              < lPreferedDepartureDateTime);
+    }
 
     /** Reset all the contexts of the demand stream. */
-    void reset (stdair::BaseGenerator_T& ioSharedGenerator);
+    void reset();
+
+
+  public:
+    // ///////////// Generation methods //////////////
+    /**
+     * Generation of the request date-times by statistic orders
+     * (stdair::DemandGenerationMethod::STA_ORD).
+     */
+    struct StatisticsOrderMethod;
+
+    /**
+     * Generation of the request date-times by a Poisson process
+     * (stdair::DemandGenerationMethod::POI_PRO).
+     */
+    struct PoissonProcessMethod;
+
+    /**
+     * Generation of the request date-times by statistic orders, the
+     * cumulative probability of the next request having already been
+     * drawn (for many demand streams at once) by the
+     * DemandStreamEngine. That method is only given to
+     * generateNextRequestWith(), by the users of the engine, once the
+     * engine has stored its state back into the demand stream.
+     */
+    struct AdvancedStatisticsOrderMethod;
+
+    /**
+     * Check whether enough requests have already been generated, with
+     * the given generation method (one of the above).
+     */
+    template <typename GENERATION_METHOD>
+    const bool stillHavingRequestsToBeGeneratedWith() const;
+
+    /**
+     * Generate the next request, as a compact record, with the given
+     * generation method (one of the above).
+     *
+     * That path is instantiated once for each generation method, with
+     * the generation of the request date-time inlined; it is selected
+     * once for a whole run by BookingRequestRange (and hence by the
+     * DemandManager::generateAll() methods).
+     */
+    template <typename GENERATION_METHOD>
+    void generateNextRequestWith (BookingRequestRecord&);
        
 
   public:
@@ -306,64 +405,60 @@ namespace TRADEMGEN {
     std::string toString() const;
     
     /**
-     * Get a string describing the  key.
+     * Get a string describing the key (e.g., "SIN-BKK 2010-Feb-08 Y").
      */
-    const std::string describeKey() const {
-      return _key.toString();
-    }
+    const stdair::DemandStreamKeyStr_T describeKey() const;
 
     /**
      * Dump recursively the content of the DemandStream object.
      */
     std::string display() const;
-    const stdair::Duration_T convertFloatIntoDuration (const stdair::FloatDuration_T);
+
+    /**
+     * Get the epoch time of a request made the given (fractional)
+     * number of days from the reference departure date-time (at
+     * DEFAULT_REFERENCE_DEPARTURE_TIME). One millisecond is added, so
+     * that the next request is strictly later than the current one.
+     */
+    const EpochTime_T convertIntoEpochTime (const stdair::FloatDuration_T) const;
     
   protected:
     // ////////// Constructors and destructors /////////
     /**
-     * Main constructor.
+     * Main constructor (see DemandStreamFamily::addDemandStream()).
      */
-    DemandStream (const Key_T&);
-    /**
-     * Destructor.
-     */
-    virtual ~DemandStream();
+    DemandStream (DemandStreamFamily&, const stdair::Date_T&);
 
   private:
-    /** Default constructor. */
-    DemandStream();
-    /** Copy constructor. */
-    DemandStream (const DemandStream&);
     /** Initialisation. */
-    void init (stdair::BaseGenerator_T& ioSharedGenerator);
+    void init();
 
     
   protected:
     // ////////// Attributes //////////
     /**
-     * Primary key (string gathering the origin, destination, POS and date).
+     * Family, holding the configuration shared by the demand streams
+     * of the same demand row (demand characteristics, demand
+     * distribution, default POS probability mass and random
+     * generation).
      */
-    Key_T _key;
-    
-    /**
-     * Pointer on the parent class (EventQueue).
-     */
-    BomAbstract* _parent;
-    
+    DemandStreamFamily* _family;
+
     /**
-     * Map holding the children (not used for now).
+     * Handle (index within the registry of the demand streams).
      */
-    stdair::HolderMap_T _holderMap;
-    
+    DemandStreamHandle_T _handle;
+
     /**
-     * Demand characteristics.
+     * Preferred departure date (part of the primary key).
      */
-    DemandCharacteristics _demandCharacteristics;
+    stdair::Date_T _preferredDepartureDate;
 
     /**
-     * Demand distribution.
+     * Epoch time of the preferred departure date (at midnight),
+     * computed once for all the requests.
      */
-    DemandDistribution _demandDistribution;
+    EpochTime_T _preferredDepartureDateEpochTime;
     
     /**
      * Total number of requests to be generated.
@@ -374,27 +469,38 @@ namespace TRADEMGEN {
      * Random generation context.
      */
     RandomGenerationContext _randomGenerationContext;
-    
-    /**
-     * Random generator for request date-time.
-     */
-    stdair::RandomGeneration _requestDateTimeRandomGenerator;
-    
-    /**
-     * Random generator for demand characteristics.
-     */
-    stdair::RandomGeneration _demandCharacteristicsRandomGenerator;
 
     /**
-     * Defaut POS probablity mass, used when "row" (rest of the world)
-     * is drawn.
+     * Index of the next draw of each sub-stream.
      */
-    POSProbabilityMass_T _posProMass;
+    CounterBasedRandomGeneration::DrawIndex_T _drawIndexArray[NB_OF_SUB_STREAMS];
 
   private:
-    bool _stillHavingRequestsToBeGenerated;
-    bool _firstDateTimeRequest;
-    stdair::FloatDuration_T _dateTimeLastRequest;
+    /**
+     * State of the Poisson process, used by the PoissonProcessMethod
+     * only (the state of the generation by statistic orders is held by
+     * the random generation context).
+     */
+    struct PoissonProcessState {
+      /** Whether the Poisson process has not stopped yet. */
+      bool _stillHavingRequestsToBeGenerated;
+
+      /** Whether no request has been generated yet. */
+      bool _firstDateTimeRequest;
+
+      /**
+       * Cumulative probability, within the arrival pattern, of the
+       * last request generated by the Poisson process.
+       */
+      double _cumulativeProbabilityLastRequest;
+
+      /**
+       * Cumulative probability, within the arrival pattern, at which
+       * the Poisson process stops.
+       */
+      double _cumulativeProbabilityUpperBound;
+    };
+    PoissonProcessState _poissonProcessState;
   };
 
 }
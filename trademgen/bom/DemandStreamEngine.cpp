@@ -0,0 +1,161 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cmath>
+// TraDemGen
+#include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamFamily.hpp>
+#include <trademgen/bom/DemandStreamEngine.hpp>
+#include <trademgen/bom/DemandStreamRegistry.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  const std::size_t DemandStreamEngine::BLOCK_SIZE;
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStreamEngine::DemandStreamEngine() : _masterSeed (0) {
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void DemandStreamEngine::load (const DemandStreamRegistry& iRegistry,
+                                 const DemandStreamHandle_T iFirstHandle,
+                                 const DemandStreamHandle_T iHandleStride) {
+    assert (iHandleStride > 0);
+    const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+      iRegistry.getDemandStreamList();
+    const std::size_t lNbOfDemandStreams = lDemandStreamList.size();
+
+    // The demand streams left out are given no request to be generated
+    _remainingNumberOfRequestsArray.assign (lNbOfDemandStreams, 0);
+    _numberOfRequestsGeneratedSoFarArray.assign (lNbOfDemandStreams, 0);
+    _logComplementArray.assign (lNbOfDemandStreams, 0.0);
+    _cumulativeProbabilityArray.assign (lNbOfDemandStreams, 0.0);
+    _streamIdArray.assign (lNbOfDemandStreams, 0);
+    _drawIndexArray.assign (lNbOfDemandStreams, 0);
+
+    for (std::size_t idx = iFirstHandle; idx < lNbOfDemandStreams;
+         idx += iHandleStride) {
+      const DemandStream* lDemandStream_ptr = lDemandStreamList[idx];
+      assert (lDemandStream_ptr != NULL);
+      const DemandStream& lDemandStream = *lDemandStream_ptr;
+      const RandomGenerationContext& lContext =
+        lDemandStream._randomGenerationContext;
+
+      // All the demand streams share the same master seed.
+      if (idx == iFirstHandle) {
+        _masterSeed = lDemandStream.getFamily().getMasterSeed();
+      }
+      assert (lDemandStream.getFamily().getMasterSeed() == _masterSeed);
+
+      const stdair::Count_T& lNbOfRequestsGeneratedSoFar =
+        lContext.getNumberOfRequestsGeneratedSoFar();
+      const stdair::NbOfRequests_T& lTotalNumberOfRequests =
+        lDemandStream._totalNumberOfRequestsToBeGenerated;
+      _remainingNumberOfRequestsArray[idx] =
+        (lTotalNumberOfRequests > lNbOfRequestsGeneratedSoFar) ?
+        static_cast<stdair::Count_T> (lTotalNumberOfRequests
+                                      - lNbOfRequestsGeneratedSoFar) : 0;
+      _numberOfRequestsGeneratedSoFarArray[idx] = lNbOfRequestsGeneratedSoFar;
+      _logComplementArray[idx] =
+        lContext.getLogComplementOfCumulativeProbabilitySoFar();
+      _cumulativeProbabilityArray[idx] = lContext.getCumulativeProbabilitySoFar();
+      _streamIdArray[idx] = lDemandStream.getStreamId();
+      _drawIndexArray[idx] =
+        lDemandStream._drawIndexArray[DemandStream::REQUEST_DATE_TIME_SUB_STREAM];
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void DemandStreamEngine::store (const DemandStreamRegistry& iRegistry,
+                                  const DemandStreamHandle_T iFirstHandle,
+                                  const DemandStreamHandle_T iHandleStride) const {
+    assert (iHandleStride > 0);
+    const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+      iRegistry.getDemandStreamList();
+    assert (lDemandStreamList.size() == getNbOfDemandStreams());
+
+    for (std::size_t idx = iFirstHandle; idx < lDemandStreamList.size();
+         idx += iHandleStride) {
+      DemandStream* lDemandStream_ptr = lDemandStreamList[idx];
+      assert (lDemandStream_ptr != NULL);
+      DemandStream& lDemandStream = *lDemandStream_ptr;
+      assert (lDemandStream.getStreamId() == _streamIdArray[idx]);
+
+      RandomGenerationContext& lContext = lDemandStream._randomGenerationContext;
+      lContext.
+        setNumberOfRequestsGeneratedSoFar (_numberOfRequestsGeneratedSoFarArray[idx]);
+      lContext.setLogComplementOfCumulativeProbabilitySoFar (_logComplementArray[idx]);
+      lDemandStream._drawIndexArray[DemandStream::REQUEST_DATE_TIME_SUB_STREAM] =
+        _drawIndexArray[idx];
+    }
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStreamHandle_T DemandStreamEngine::
+  advance (const DemandStreamHandle_T& iBegin, const DemandStreamHandle_T& iEnd) {
+    assert (iBegin <= iEnd && iEnd <= getNbOfDemandStreams());
+
+    DemandStreamHandle_T oNbOfAdvancedDemandStreams = 0;
+    DemandStreamHandle_T lHandleArray[BLOCK_SIZE];
+    CounterBasedRandomGeneration::StreamId_T lStreamIdArray[BLOCK_SIZE];
+    CounterBasedRandomGeneration::DrawIndex_T lDrawIndexArray[BLOCK_SIZE];
+    stdair::RealNumber_T lVariateArray[BLOCK_SIZE];
+
+    DemandStreamHandle_T lHandle = iBegin;
+    while (lHandle < iEnd) {
+      // 1) Gather the demand streams still having requests to be
+      //    generated, up to a block of them.
+      std::size_t lBlockSize = 0;
+      for ( ; lHandle < iEnd && lBlockSize < BLOCK_SIZE; ++lHandle) {
+        if (_remainingNumberOfRequestsArray[lHandle] == 0) {
+          continue;
+        }
+        lHandleArray[lBlockSize] = lHandle;
+        lStreamIdArray[lBlockSize] = _streamIdArray[lHandle];
+        lDrawIndexArray[lBlockSize] = _drawIndexArray[lHandle];
+        ++lBlockSize;
+      }
+
+      // 2) Draw the uniform variates of the whole block at once.
+      CounterBasedRandomGeneration::generateUniforms01 (_masterSeed,
+                                                        lStreamIdArray,
+                                                        lDrawIndexArray,
+                                                        lVariateArray,
+                                                        lBlockSize);
+
+      // 3) Advance the order statistics, exactly as done by
+      //    DemandStream::generateTimeOfRequestStatisticsOrder():
+      //    log(1 - x(k)) = log(1 - x(k - 1)) - E/(n - k + 1)
+      for (std::size_t idx = 0; idx < lBlockSize; ++idx) {
+        const DemandStreamHandle_T& lBlockHandle = lHandleArray[idx];
+        stdair::Count_T& lRemainingNumberOfRequests =
+          _remainingNumberOfRequestsArray[lBlockHandle];
+        double& lLogComplement = _logComplementArray[lBlockHandle];
+
+        lLogComplement = RandomGenerationContext::
+          getNextLogComplement (lLogComplement, lVariateArray[idx],
+                                lRemainingNumberOfRequests);
+        _cumulativeProbabilityArray[lBlockHandle] = -std::expm1 (lLogComplement);
+
+        --lRemainingNumberOfRequests;
+        ++_numberOfRequestsGeneratedSoFarArray[lBlockHandle];
+        ++_drawIndexArray[lBlockHandle];
+      }
+      oNbOfAdvancedDemandStreams += lBlockSize;
+    }
+    return oNbOfAdvancedDemandStreams;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const EpochTime_T DemandStreamEngine::
+  getEpochTimeOfRequest (const DemandStreamRegistry& iRegistry,
+                         const DemandStreamHandle_T& iHandle) const {
+    assert (iHandle < _cumulativeProbabilityArray.size());
+    const DemandStream& lDemandStream = iRegistry.getDemandStream (iHandle);
+    return lDemandStream.getEpochTimeOfRequest (_cumulativeProbabilityArray[iHandle]);
+  }
+
+}
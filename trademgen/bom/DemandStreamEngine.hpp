@@ -0,0 +1,197 @@
+#ifndef __TRADEMGEN_BOM_DEMANDSTREAMENGINE_HPP
+#define __TRADEMGEN_BOM_DEMANDSTREAMENGINE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cstddef>
+#include <vector>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_maths_types.hpp>
+// TraDemGen
+#include <trademgen/TRADEMGEN_Types.hpp>
+#include <trademgen/basic/CounterBasedRandomGeneration.hpp>
+#include <trademgen/basic/EpochTimeManager.hpp>
+
+namespace TRADEMGEN {
+
+  // Forward declarations
+  class DemandStreamRegistry;
+
+  /**
+   * @brief Engine advancing many demand streams at once, with the
+   * sequential generation in increasing order (statistics order).
+   *
+   * The state needed at each step (number of remaining requests,
+   * logarithm of the complement of the last cumulative probability and
+   * position of the request date-time random sub-stream) is gathered,
+   * for all the demand streams, within contiguous arrays indexed by the
+   * handles of the demand streams. The DemandStream objects still hold
+   * the configuration (e.g., the arrival pattern), and are given the
+   * state back by store().
+   *
+   * The engine is an explicit (opt-in) API: neither BookingRequestRange
+   * nor TRADEMGEN_Service::generateAll() and the like use it, as it
+   * only pays off when many steps are drawn ahead for many demand
+   * streams. The caller loads the demand streams, advances them as
+   * many times as needed (reading the request date-times with
+   * getEpochTimeOfRequest()), then stores their state back; the last
+   * advanced request of a demand stream may then be generated with
+   * DemandStream::AdvancedStatisticsOrderMethod.
+   *
+   * The uniform variates are drawn from the same counter-based
+   * random sub-streams (i.e., the same streams and draw indexes) as
+   * DemandStream::generateTimeOfRequestStatisticsOrder(), so that the
+   * engine yields exactly the same cumulative probabilities.
+   */
+  class DemandStreamEngine {
+  public:
+    // ///////////// Type definitions //////////////
+    /**
+     * Number of demand streams processed at once.
+     */
+    static const std::size_t BLOCK_SIZE = 256;
+
+
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Gather the state of the demand streams of the registry.
+     *
+     * The engine may be restricted to every iHandleStride-th demand
+     * stream, from the one of handle iFirstHandle (e.g., to the demand
+     * streams of a BookingRequestRange shared among several threads):
+     * the other demand streams are neither read nor advanced.
+     */
+    void load (const DemandStreamRegistry&,
+               const DemandStreamHandle_T iFirstHandle = 0,
+               const DemandStreamHandle_T iHandleStride = 1);
+
+    /**
+     * Give the state back to the demand streams of the registry (which
+     * must be the one given to load(), along with the same handles).
+     */
+    void store (const DemandStreamRegistry&,
+                const DemandStreamHandle_T iFirstHandle = 0,
+                const DemandStreamHandle_T iHandleStride = 1) const;
+
+    /**
+     * Generate the cumulative probability of the next request of each
+     * demand stream, within the given range of handles, still having
+     * requests to be generated. The other demand streams are left
+     * untouched.
+     *
+     * @return DemandStreamHandle_T The number of demand streams which
+     *         have been advanced.
+     */
+    DemandStreamHandle_T advance (const DemandStreamHandle_T& iBegin,
+                                  const DemandStreamHandle_T& iEnd);
+
+    /**
+     * Same as advance(), for all the demand streams.
+     */
+    DemandStreamHandle_T advance() {
+      return advance (0, getNbOfDemandStreams());
+    }
+
+    /**
+     * Get the (epoch) date-time of the last request generated for the
+     * given demand stream (i.e., the one corresponding to its
+     * cumulative probability).
+     */
+    const EpochTime_T
+    getEpochTimeOfRequest (const DemandStreamRegistry&,
+                           const DemandStreamHandle_T&) const;
+
+
+  public:
+    // ////////// Getters /////////
+    /**
+     * Get the number of demand streams.
+     */
+    DemandStreamHandle_T getNbOfDemandStreams() const {
+      return _remainingNumberOfRequestsArray.size();
+    }
+
+    /**
+     * State whether the given demand stream still has requests to be
+     * generated.
+     */
+    bool stillHavingRequestsToBeGenerated (const DemandStreamHandle_T& iHandle) const {
+      assert (iHandle < _remainingNumberOfRequestsArray.size());
+      return (_remainingNumberOfRequestsArray[iHandle] > 0);
+    }
+
+    /**
+     * Get the number of requests generated so far for the given demand
+     * stream.
+     */
+    const stdair::Count_T&
+    getNumberOfRequestsGeneratedSoFar (const DemandStreamHandle_T& iHandle) const {
+      assert (iHandle < _numberOfRequestsGeneratedSoFarArray.size());
+      return _numberOfRequestsGeneratedSoFarArray[iHandle];
+    }
+
+    /**
+     * Get the cumulative probability of the last request generated for
+     * the given demand stream.
+     */
+    const stdair::Probability_T&
+    getCumulativeProbability (const DemandStreamHandle_T& iHandle) const {
+      assert (iHandle < _cumulativeProbabilityArray.size());
+      return _cumulativeProbabilityArray[iHandle];
+    }
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Default constructor (no demand stream).
+     */
+    DemandStreamEngine();
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Master seed, shared by all the demand streams.
+     */
+    stdair::RandomSeed_T _masterSeed;
+
+    /**
+     * Numbers of requests still to be generated.
+     */
+    std::vector<stdair::Count_T> _remainingNumberOfRequestsArray;
+
+    /**
+     * Numbers of requests generated so far.
+     */
+    std::vector<stdair::Count_T> _numberOfRequestsGeneratedSoFarArray;
+
+    /**
+     * Logarithms of the complements of the cumulative probabilities of
+     * the last requests.
+     */
+    std::vector<double> _logComplementArray;
+
+    /**
+     * Cumulative probabilities of the last requests.
+     */
+    std::vector<stdair::Probability_T> _cumulativeProbabilityArray;
+
+    /**
+     * Stream identifiers of the demand streams.
+     */
+    std::vector<CounterBasedRandomGeneration::StreamId_T> _streamIdArray;
+
+    /**
+     * Next draw indexes of the request date-time random sub-streams.
+     */
+    std::vector<CounterBasedRandomGeneration::DrawIndex_T> _drawIndexArray;
+  };
+
+}
+#endif // __TRADEMGEN_BOM_DEMANDSTREAMENGINE_HPP
@@ -0,0 +1,95 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <sstream>
+// StdAir
+#include <stdair/basic/BasConst_General.hpp>
+#include <stdair/basic/BasConst_Inventory.hpp>
+#include <stdair/basic/BasConst_Request.hpp>
+// TraDemGen
+#include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamFamily.hpp>
+#include <trademgen/bom/TraceSink.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStreamFamily::DemandStreamFamily()
+    : _key (stdair::DEFAULT_ORIGIN, stdair::DEFAULT_DESTINATION,
+            stdair::DEFAULT_DEPARTURE_DATE, stdair::DEFAULT_CABIN_CODE),
+      _parent (NULL), _masterSeed (0), _streamId (0), _traceSink (NULL),
+      _exponentialSampler (ZigguratSampler::EXPONENTIAL),
+      _normalSampler (ZigguratSampler::NORMAL) {
+    assert (false);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStreamFamily::DemandStreamFamily (const DemandStreamFamily&)
+    : _key (stdair::DEFAULT_ORIGIN, stdair::DEFAULT_DESTINATION,
+            stdair::DEFAULT_DEPARTURE_DATE, stdair::DEFAULT_CABIN_CODE),
+      _parent (NULL), _masterSeed (0), _streamId (0), _traceSink (NULL),
+      _exponentialSampler (ZigguratSampler::EXPONENTIAL),
+      _normalSampler (ZigguratSampler::NORMAL) {
+    assert (false);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStreamFamily::DemandStreamFamily (const Key_T& iKey)
+    : _key (iKey), _parent (NULL), _masterSeed (0),
+      _streamId (CounterBasedRandomGeneration::
+                 generateStreamId (iKey.getOrigin() + "-"
+                                   + iKey.getDestination() + " "
+                                   + iKey.getPreferredCabin())),
+      _traceSink (&NullTraceSink::instance()),
+      _exponentialSampler (ZigguratSampler::EXPONENTIAL),
+      _normalSampler (ZigguratSampler::NORMAL) {
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStreamFamily::~DemandStreamFamily() {
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void DemandStreamFamily::
+  setAll (const DemandCharacteristicsPtr_T& iDemandCharacteristics_ptr,
+          const DemandDistribution& iDemandDistribution,
+          const stdair::RandomSeed_T& iMasterSeed,
+          const POSProbabilityMass_T& iDefaultPOSProbablityMass) {
+    setDemandCharacteristics (iDemandCharacteristics_ptr);
+    setDemandDistribution (iDemandDistribution);
+    setPOSProbabilityMass (iDefaultPOSProbablityMass);
+    _masterSeed = iMasterSeed;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStream& DemandStreamFamily::
+  addDemandStream (const stdair::Date_T& iPreferredDepartureDate) {
+    assert (_demandStreamList.empty() == true
+            ? iPreferredDepartureDate == _key.getPreferredDepartureDate()
+            : _demandStreamList.back().getPreferredDepartureDate()
+            < iPreferredDepartureDate);
+
+    _demandStreamList.push_back (DemandStream (*this, iPreferredDepartureDate));
+
+    DemandStream& lDemandStream = _demandStreamList.back();
+    lDemandStream.init();
+    return lDemandStream;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  std::string DemandStreamFamily::toString() const {
+    return describeKey();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const std::string DemandStreamFamily::describe() const {
+    std::ostringstream oStr;
+    oStr << getOrigin() << "-" << getDestination() << " "
+         << getPreferredCabin() << " (" << _demandStreamList.size()
+         << " demand streams)";
+    return oStr.str();
+  }
+
+}
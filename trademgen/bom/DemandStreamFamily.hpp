@@ -0,0 +1,352 @@
+#ifndef __TRADEMGEN_BOM_DEMANDSTREAMFAMILY_HPP
+#define __TRADEMGEN_BOM_DEMANDSTREAMFAMILY_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <string>
+#include <vector>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/bom/BomAbstract.hpp>
+// TraDemGen
+#include <trademgen/basic/CodePool.hpp>
+#include <trademgen/basic/CounterBasedRandomGeneration.hpp>
+#include <trademgen/basic/DemandCharacteristics.hpp>
+#include <trademgen/basic/DemandCharacteristicsTypes.hpp>
+#include <trademgen/basic/DemandDistribution.hpp>
+#include <trademgen/basic/ZigguratSampler.hpp>
+#include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamKey.hpp>
+#include <trademgen/bom/TraceSink.hpp>
+
+/// Forward declarations
+namespace stdair {
+  class FacBomManager;
+  template <typename BOM> class FacBom;
+}
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Family of demand streams, i.e., the demand streams derived
+   * from a given demand row, which differ only by their preferred
+   * departure dates.
+   *
+   * The family is the event generator of the demand row (it is the
+   * object added to the BOM tree and known by SEvMgr). It holds, once
+   * for all the dates, the configuration of the row (demand
+   * characteristics, demand distribution, default POS probability
+   * mass, master seed and trace sink), along with the contiguous
+   * (per-date) generation states of its demand streams.
+   *
+   * The family is identified by the key of its first demand stream:
+   * as the demand streams of a family have increasing dates, the key
+   * is unique as long as the ones of the demand streams are.
+   */
+  class DemandStreamFamily : public stdair::BomAbstract {
+    template <typename BOM> friend class stdair::FacBom;
+    friend class stdair::FacBomManager;
+
+  public:
+    // ///////////// Type definitions //////////////
+    /**
+     * Definition allowing to retrieve the associated BOM key type.
+     */
+    typedef DemandStreamKey Key_T;
+
+    /**
+     * Demand streams of the family, in the order of their preferred
+     * departure dates.
+     */
+    typedef std::vector<DemandStream> DemandStreamList_T;
+
+
+  public:
+    // ///////////// Getters ///////////
+    /** Get the key (the one of the first demand stream). */
+    const Key_T& getKey() const {
+      return _key;
+    }
+
+    /** Get the parent object (EventQueue). */
+    BomAbstract* const getParent() const {
+      return _parent;
+    }
+
+    /** Get the map of children holders. */
+    const stdair::HolderMap_T& getHolderMap() const {
+      return _holderMap;
+    }
+
+    /** Get the origin. */
+    const stdair::AirportCode_T& getOrigin() const {
+      return _key.getOrigin();
+    }
+
+    /** Get the destination. */
+    const stdair::AirportCode_T& getDestination() const {
+      return _key.getDestination();
+    }
+
+    /** Get the preferred cabin. */
+    const stdair::CabinCode_T& getPreferredCabin() const {
+      return _key.getPreferredCabin();
+    }
+
+    /** Get the demand characteristics. */
+    const DemandCharacteristics& getDemandCharacteristics() const {
+      assert (_demandCharacteristics != NULL);
+      return *_demandCharacteristics;
+    }
+
+    /**
+     * Get the (shared) demand characteristics, as handed out by the
+     * DemandCharacteristicsPool.
+     */
+    const DemandCharacteristicsPtr_T& getDemandCharacteristicsPtr() const {
+      return _demandCharacteristics;
+    }
+
+    /** Get the demand distribution. */
+    const DemandDistribution& getDemandDistribution() const {
+      return _demandDistribution;
+    }
+
+    /**
+     * Get the default POS probablity mass, used when "row" (rest of
+     * the world) is drawn.
+     */
+    const POSProbabilityMass_T& getPOSProbabilityMass() const {
+      return _posProMass;
+    }
+
+    /** Get the master seed of the random generation. */
+    const stdair::RandomSeed_T& getMasterSeed() const {
+      return _masterSeed;
+    }
+
+    /**
+     * Get the stream identifier of the random generation of the demand
+     * row, from which the ones of the demand streams are derived.
+     */
+    const CounterBasedRandomGeneration::StreamId_T& getStreamId() const {
+      return _streamId;
+    }
+
+    /**
+     * Get the trace sink (the NullTraceSink by default). The trace
+     * sink is not part of the state of the family: it may be called
+     * from a const family.
+     */
+    TraceSink& getTraceSink() const {
+      assert (_traceSink != NULL);
+      return *_traceSink;
+    }
+
+    /** Get the sampler of the exponential variates. */
+    const ZigguratSampler& getExponentialSampler() const {
+      return _exponentialSampler;
+    }
+
+    /** Get the sampler of the normal variates. */
+    const ZigguratSampler& getNormalSampler() const {
+      return _normalSampler;
+    }
+
+    /** Get the demand streams of the family. */
+    const DemandStreamList_T& getDemandStreamList() const {
+      return _demandStreamList;
+    }
+
+    /** Get the demand streams of the family. */
+    DemandStreamList_T& getDemandStreamList() {
+      return _demandStreamList;
+    }
+
+
+  public:
+    // //////////////// Setters //////////////////
+    /** Set the (shared) demand characteristics of the whole family. */
+    void setDemandCharacteristics (const DemandCharacteristicsPtr_T& iDemandCharacteristics_ptr) {
+      assert (iDemandCharacteristics_ptr != NULL);
+      _demandCharacteristics = iDemandCharacteristics_ptr;
+    }
+
+    /** Set the demand distribution of the whole family. */
+    void setDemandDistribution (const DemandDistribution& iDemandDistribution) {
+      _demandDistribution = iDemandDistribution;
+    }
+
+    /** Set the default POS probablity mass of the whole family. */
+    void setPOSProbabilityMass (const POSProbabilityMass_T& iProbMass) {
+      _posProMass = iProbMass;
+    }
+
+    /**
+     * Set the trace sink, receiving the records of the requests
+     * generated by the whole family (it must outlive the family, or be
+     * replaced before being destroyed).
+     */
+    void setTraceSink (TraceSink& ioTraceSink) {
+      _traceSink = &ioTraceSink;
+    }
+
+    /**
+     * Initialisation, before any demand stream is added.
+     */
+    void setAll (const DemandCharacteristicsPtr_T&,
+                 const DemandDistribution&,
+                 const stdair::RandomSeed_T& iMasterSeed,
+                 const POSProbabilityMass_T&);
+
+
+  public:
+    // /////////////////// Business Methods ///////////////////
+    /**
+     * Add the demand stream of the given preferred departure date
+     * (later than the ones already within the family, the first one
+     * being the date of the key of the family), and draw its number of
+     * requests.
+     *
+     * \note The demand streams are held contiguously by the family:
+     *       adding one may move the others. Hence, all the demand
+     *       streams of a family are to be added before the demand
+     *       streams are registered (see DemandStreamRegistry).
+     *
+     * @return DemandStream& The newly added demand stream.
+     */
+    DemandStream& addDemandStream (const stdair::Date_T&);
+
+    /**
+     * Reserve the room for the given number of demand streams.
+     */
+    void reserve (const std::size_t iNbOfDemandStreams) {
+      _demandStreamList.reserve (iNbOfDemandStreams);
+    }
+
+
+  public:
+    // ////////////////// Display support methods //////////////
+    /**
+     * Dump a Business Object into an output stream.
+     * @param ostream& the output stream.
+     */
+    void toStream (std::ostream& ioOut) const {
+      ioOut << toString();
+    }
+
+    /**
+     * Read a Business Object from an input stream.
+     * @param istream& the input stream.
+     */
+    void fromStream (std::istream& ioIn) {
+    }
+
+    /**
+     * Get the serialised version of the Business Object.
+     */
+    std::string toString() const;
+
+    /**
+     * Get a string describing the key.
+     */
+    const std::string describeKey() const {
+      return _key.toString();
+    }
+
+    /**
+     * Get a short description of the family.
+     */
+    const std::string describe() const;
+
+
+  protected:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Main constructor (the family has no demand stream yet).
+     */
+    DemandStreamFamily (const Key_T&);
+    /**
+     * Destructor.
+     */
+    virtual ~DemandStreamFamily();
+
+  private:
+    /** Default constructor. */
+    DemandStreamFamily();
+    /** Copy constructor. */
+    DemandStreamFamily (const DemandStreamFamily&);
+
+
+  protected:
+    // ////////// Attributes //////////
+    /**
+     * Primary key (the one of the first demand stream).
+     */
+    Key_T _key;
+
+    /**
+     * Pointer on the parent class (EventQueue).
+     */
+    BomAbstract* _parent;
+
+    /**
+     * Map holding the children (not used for now).
+     */
+    stdair::HolderMap_T _holderMap;
+
+    /**
+     * Demand characteristics (shared with the other demand rows
+     * having the same ones).
+     */
+    DemandCharacteristicsPtr_T _demandCharacteristics;
+
+    /**
+     * Demand distribution.
+     */
+    DemandDistribution _demandDistribution;
+
+    /**
+     * Defaut POS probablity mass, used when "row" (rest of the world)
+     * is drawn.
+     */
+    POSProbabilityMass_T _posProMass;
+
+    /**
+     * Master seed of the random generation.
+     */
+    stdair::RandomSeed_T _masterSeed;
+
+    /**
+     * Stream identifier of the random generation (derived from the
+     * origin, destination and preferred cabin).
+     */
+    CounterBasedRandomGeneration::StreamId_T _streamId;
+
+    /**
+     * Trace sink (the NullTraceSink by default).
+     */
+    TraceSink* _traceSink;
+
+    /**
+     * Sampler for the exponential variates (inter-arrival times of the
+     * Poisson process and WTP).
+     */
+    ZigguratSampler _exponentialSampler;
+
+    /**
+     * Sampler for the normal variates (number of requests).
+     */
+    ZigguratSampler _normalSampler;
+
+    /**
+     * Demand streams of the family.
+     */
+    DemandStreamList_T _demandStreamList;
+  };
+
+}
+#endif // __TRADEMGEN_BOM_DEMANDSTREAMFAMILY_HPP
@@ -4,6 +4,8 @@
 // STL
 #include <cassert>
 #include <sstream>
+// Boost
+#include <boost/functional/hash.hpp>
 // StdAir
 #include <stdair/basic/BasConst_Inventory.hpp>
 // TraDemGen
@@ -13,10 +15,10 @@ namespace TRADEMGEN {
 
   // ////////////////////////////////////////////////////////////////////
   DemandStreamKey::DemandStreamKey()
-    : _origin (stdair::DEFAULT_ORIGIN),
-      _destination (stdair::DEFAULT_DESTINATION),
+    : _origin (CodePool::instance().intern (stdair::DEFAULT_ORIGIN)),
+      _destination (CodePool::instance().intern (stdair::DEFAULT_DESTINATION)),
       _preferredDepartureDate (stdair::DEFAULT_DEPARTURE_DATE),
-      _preferredCabin (stdair::DEFAULT_CABIN_CODE) {
+      _preferredCabin (CodePool::instance().intern (stdair::DEFAULT_CABIN_CODE)) {
     assert (false);
   }
   
@@ -26,9 +28,10 @@ namespace TRADEMGEN {
                    const stdair::AirportCode_T& iDestination,
                    const stdair::Date_T& iPreferredDepartureDate,
                    const stdair::CabinCode_T& iPreferredCabin)
-    : _origin (iOrigin), _destination (iDestination),
+    : _origin (CodePool::instance().intern (iOrigin)),
+      _destination (CodePool::instance().intern (iDestination)),
       _preferredDepartureDate (iPreferredDepartureDate),
-      _preferredCabin (iPreferredCabin) {
+      _preferredCabin (CodePool::instance().intern (iPreferredCabin)) {
   }
 
   // ////////////////////////////////////////////////////////////////////
@@ -42,6 +45,24 @@ namespace TRADEMGEN {
   DemandStreamKey::~DemandStreamKey () {
   }
 
+  // ////////////////////////////////////////////////////////////////////
+  bool DemandStreamKey::operator== (const DemandStreamKey& iKey) const {
+    return (_origin == iKey._origin && _destination == iKey._destination
+            && _preferredDepartureDate == iKey._preferredDepartureDate
+            && _preferredCabin == iKey._preferredCabin);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  std::size_t DemandStreamKey::getHashValue() const {
+    std::size_t oHashValue = 0;
+    boost::hash_combine (oHashValue, _origin);
+    boost::hash_combine (oHashValue, _destination);
+    boost::hash_combine (oHashValue,
+                         _preferredDepartureDate.day_number());
+    boost::hash_combine (oHashValue, _preferredCabin);
+    return oHashValue;
+  }
+
   // ////////////////////////////////////////////////////////////////////
   void DemandStreamKey::toStream (std::ostream& ioOut) const {
     ioOut << "DemandStreamKey: " << toString();
@@ -54,8 +75,8 @@ namespace TRADEMGEN {
   // ////////////////////////////////////////////////////////////////////
   const std::string DemandStreamKey::toString() const {
     std::ostringstream oStr;
-    oStr << _origin << "-" << _destination << " " << _preferredDepartureDate
-         << " " << _preferredCabin;
+    oStr << getOrigin() << "-" << getDestination() << " "
+         << _preferredDepartureDate << " " << getPreferredCabin();
     return oStr.str();
   }
 
@@ -8,6 +8,8 @@
 #include <stdair/stdair_basic_types.hpp>
 #include <stdair/stdair_date_time_types.hpp>
 #include <stdair/bom/KeyAbstract.hpp>
+// TraDemGen
+#include <trademgen/basic/CodePool.hpp>
 
 namespace TRADEMGEN {
 
@@ -16,6 +18,9 @@ namespace TRADEMGEN {
    * airports/cities (origin and destination), a preferred departure
    * date and a preferred cabin. Those attributes correspond to a the
    * travel requirements of a simulated traveller.
+   *
+   * The airport and cabin codes are stored as codes of the CodePool,
+   * so that the keys are compact, and compared and hashed as integers.
    */
   struct DemandStreamKey : public stdair::KeyAbstract {
 
@@ -41,12 +46,12 @@ namespace TRADEMGEN {
     // /////////// Getters //////////
     /** Get the origin. */
     const stdair::AirportCode_T& getOrigin() const {
-      return _origin;
+      return CodePool::instance().getString (_origin);
     }
 
     /** Get the destination. */
     const stdair::AirportCode_T& getDestination() const {
-      return _destination;
+      return CodePool::instance().getString (_destination);
     }
 
     /** Get the preferred departure date. */
@@ -56,9 +61,32 @@ namespace TRADEMGEN {
     
     /** Get the preferred cabin. */
     const stdair::CabinCode_T& getPreferredCabin() const {
+      return CodePool::instance().getString (_preferredCabin);
+    }
+
+    /** Get the (interned) code of the origin. */
+    const Code_T& getOriginCode() const {
+      return _origin;
+    }
+
+    /** Get the (interned) code of the destination. */
+    const Code_T& getDestinationCode() const {
+      return _destination;
+    }
+
+    /** Get the (interned) code of the preferred cabin. */
+    const Code_T& getPreferredCabinCode() const {
       return _preferredCabin;
     }
 
+
+    // /////////// Business methods //////////
+    /** Equality operator (on the codes and the date only). */
+    bool operator== (const DemandStreamKey&) const;
+
+    /** Get the hash value of the key (on the codes and the date only). */
+    std::size_t getHashValue() const;
+
     
     // /////////// Display support methods /////////
     /** Dump a Business Object Key into an output stream.
@@ -79,17 +107,17 @@ namespace TRADEMGEN {
 
   private:
     // ///////////////// Attributes ///////////////
-    /** Required origin airport/city. */
-    stdair::AirportCode_T _origin;
+    /** Required origin airport/city (interned code). */
+    Code_T _origin;
 
-    /** Required destination airport/city. */
-    stdair::AirportCode_T _destination;
+    /** Required destination airport/city (interned code). */
+    Code_T _destination;
 
     /** Preferred departure date. */
     stdair::Date_T _preferredDepartureDate;
 
-    /** Preferred cabin. */
-    stdair::CabinCode_T _preferredCabin;
+    /** Preferred cabin (interned code). */
+    Code_T _preferredCabin;
   };
 
 }
@@ -0,0 +1,76 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <sstream>
+// TraDemGen
+#include <trademgen/TRADEMGEN_Exceptions.hpp>
+#include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamRegistry.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStreamRegistry::DemandStreamRegistry() {
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStreamHandle_T DemandStreamRegistry::
+  registerDemandStream (DemandStream& ioDemandStream) {
+    const DemandStreamHandle_T oHandle = _demandStreamList.size();
+    const stdair::DemandStreamKeyStr_T lKey (ioDemandStream.describeKey());
+
+    const bool hasInsertBeenSuccessful = _demandStreamHandleMap.
+      insert (DemandStreamHandleMap_T::value_type (lKey, oHandle)).second;
+    assert (hasInsertBeenSuccessful == true);
+
+    _demandStreamList.push_back (&ioDemandStream);
+    _demandStreamKeyList.push_back (lKey);
+    ioDemandStream.setHandle (oHandle);
+    return oHandle;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void DemandStreamRegistry::clear() {
+    _demandStreamList.clear();
+    _demandStreamKeyList.clear();
+    _demandStreamHandleMap.clear();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStream& DemandStreamRegistry::
+  getDemandStream (const DemandStreamHandle_T& iHandle) const {
+    if (iHandle >= _demandStreamList.size()) {
+      std::ostringstream oStr;
+      oStr << "No demand stream has been registered with the handle "
+           << iHandle << " (" << _demandStreamList.size()
+           << " demand streams are registered)";
+      throw IndexOutOfRangeException (oStr.str());
+    }
+    DemandStream* lDemandStream_ptr = _demandStreamList[iHandle];
+    assert (lDemandStream_ptr != NULL);
+    return *lDemandStream_ptr;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  bool DemandStreamRegistry::
+  hasDemandStream (const stdair::DemandStreamKeyStr_T& iKey) const {
+    return (_demandStreamHandleMap.find (iKey) != _demandStreamHandleMap.end());
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const DemandStreamHandle_T& DemandStreamRegistry::
+  getDemandStreamHandle (const stdair::DemandStreamKeyStr_T& iKey) const {
+    DemandStreamHandleMap_T::const_iterator itHandle =
+      _demandStreamHandleMap.find (iKey);
+    if (itHandle == _demandStreamHandleMap.end()) {
+      std::ostringstream oStr;
+      oStr << "No demand stream has been registered with the key '"
+           << iKey << "'";
+      throw DemandStreamNotFoundException (oStr.str());
+    }
+    return itHandle->second;
+  }
+
+}
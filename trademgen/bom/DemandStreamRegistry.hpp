@@ -0,0 +1,147 @@
+#ifndef __TRADEMGEN_BOM_DEMANDSTREAMREGISTRY_HPP
+#define __TRADEMGEN_BOM_DEMANDSTREAMREGISTRY_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <string>
+#include <vector>
+// Boost
+#include <boost/unordered_map.hpp>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+// TraDemGen
+#include <trademgen/TRADEMGEN_Types.hpp>
+
+namespace TRADEMGEN {
+
+  // Forward declarations
+  class DemandStream;
+
+  /**
+   * @brief Registry of the demand streams, indexed by their (dense)
+   * handles.
+   *
+   * The demand streams are stored contiguously, in the order of their
+   * registration, so that retrieving a demand stream from its handle
+   * is a mere array index. The (string) keys are resolved into
+   * handles through a hash map, which is only needed when the caller
+   * knows the key alone.
+   */
+  class DemandStreamRegistry {
+  public:
+    // ///////////// Type definitions //////////////
+    /**
+     * List of the demand streams, indexed by their handles.
+     */
+    typedef std::vector<DemandStream*> DemandStreamList_T;
+
+    /**
+     * List of the demand stream keys, indexed by the handles.
+     */
+    typedef std::vector<stdair::DemandStreamKeyStr_T> DemandStreamKeyList_T;
+
+    /**
+     * Map from the demand stream keys to their handles.
+     */
+    typedef boost::unordered_map<stdair::DemandStreamKeyStr_T,
+                                 DemandStreamHandle_T> DemandStreamHandleMap_T;
+
+
+  public:
+    // /////////////// Business Methods //////////
+    /**
+     * Register the given demand stream, and give it the next handle.
+     *
+     * @return DemandStreamHandle_T The handle of the demand stream.
+     */
+    DemandStreamHandle_T registerDemandStream (DemandStream&);
+
+    /**
+     * Unregister all the demand streams.
+     */
+    void clear();
+
+
+  public:
+    // ////////// Getters /////////
+    /**
+     * Get the number of registered demand streams (which is also the
+     * handle to be given to the next registered one).
+     */
+    DemandStreamHandle_T getNbOfDemandStreams() const {
+      return _demandStreamList.size();
+    }
+
+    /**
+     * Get the demand streams, indexed by their handles.
+     */
+    const DemandStreamList_T& getDemandStreamList() const {
+      return _demandStreamList;
+    }
+
+    /**
+     * Get the demand stream corresponding to the given handle.
+     *
+     * \note An IndexOutOfRangeException is thrown when no demand
+     *       stream has been registered with that handle.
+     */
+    DemandStream& getDemandStream (const DemandStreamHandle_T&) const;
+
+    /**
+     * Get the key of the demand stream corresponding to the given
+     * handle.
+     */
+    const stdair::DemandStreamKeyStr_T&
+    getDemandStreamKey (const DemandStreamHandle_T& iHandle) const {
+      assert (iHandle < _demandStreamKeyList.size());
+      return _demandStreamKeyList[iHandle];
+    }
+
+    /**
+     * State whether a demand stream has been registered with the
+     * given key.
+     */
+    bool hasDemandStream (const stdair::DemandStreamKeyStr_T&) const;
+
+    /**
+     * Get the handle of the demand stream corresponding to the given
+     * key.
+     *
+     * \note A DemandStreamNotFoundException is thrown when no demand
+     *       stream has been registered with that key.
+     */
+    const DemandStreamHandle_T&
+    getDemandStreamHandle (const stdair::DemandStreamKeyStr_T&) const;
+
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Default constructor (empty registry).
+     */
+    DemandStreamRegistry();
+
+
+  private:
+    // ////////// Attributes //////////
+    /**
+     * Demand streams, indexed by their handles.
+     */
+    DemandStreamList_T _demandStreamList;
+
+    /**
+     * Keys of the demand streams, indexed by their handles.
+     */
+    DemandStreamKeyList_T _demandStreamKeyList;
+
+    /**
+     * Handles of the demand streams, indexed by their keys.
+     */
+    DemandStreamHandleMap_T _demandStreamHandleMap;
+  };
+
+}
+#endif // __TRADEMGEN_BOM_DEMANDSTREAMREGISTRY_HPP
@@ -14,12 +14,16 @@ namespace TRADEMGEN {
 
   // Forward declarations.
   class DemandStream;
+  class DemandStreamFamily;
   
   /** Define the airline feature list. */
   typedef std::list<DemandStream*> DemandStreamList_T;
 
   /** Define the airline feature map. */
   typedef std::map<const stdair::MapKey_T, DemandStream*> DemandStreamMap_T;
+
+  /** Define the list of the families of demand streams. */
+  typedef std::list<DemandStreamFamily*> DemandStreamFamilyList_T;
   
 }
 #endif // __TRADEMGEN_BOM_DEMANDSTREAMTYPES_HPP
@@ -0,0 +1,69 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <iomanip>
+#include <sstream>
+// Boost
+#include <boost/date_time/gregorian/gregorian.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+// StdAir
+#include <stdair/basic/BasConst_General.hpp>
+#include <stdair/service/Logger.hpp>
+// TraDemGen
+#include <trademgen/basic/CodePool.hpp>
+#include <trademgen/basic/DemandCharacteristics.hpp>
+#include <trademgen/basic/EpochTimeManager.hpp>
+#include <trademgen/bom/BookingRequestRecord.hpp>
+#include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/LogTraceSink.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  void LogTraceSink::
+  traceTimeOfRequest (const DemandStream& iDemandStream,
+                      const double iRefNumberOfDays) {
+    STDAIR_LOG_NOTIFICATION (boost::gregorian::to_iso_string(iDemandStream.getPreferredDepartureDate()) << ";" << std::setprecision(10) << iRefNumberOfDays);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void LogTraceSink::
+  traceBookingRequest (const DemandStream& iDemandStream,
+                       const BookingRequestRecord& iBookingRequestRecord) {
+    const CodePool& lCodePool = CodePool::instance();
+    const DemandStreamKey& lKey = iDemandStream.getKey();
+    const DemandCharacteristics& lDemandCharacteristics =
+      iDemandStream.getDemandCharacteristics();
+
+    // Same display as stdair::BookingRequestStruct::describe(), formatted
+    // straight from the record (so that no booking request gets built),
+    // in its own stream (so that it does not inherit the formatting of
+    // the log stream).
+    std::ostringstream oStr;
+    oStr << "At "
+         << EpochTimeManager::convertIntoDateTime (iBookingRequestRecord._requestDateTime)
+         << ", for (" << lCodePool.getString (iBookingRequestRecord._pos)
+         << ", " << lCodePool.getString (iBookingRequestRecord._channel)
+         << ") " << lKey.getOrigin() << "-" << lKey.getDestination()
+         << " (" << lCodePool.getString (iBookingRequestRecord._tripType)
+         << ") " << lKey.getPreferredDepartureDate()
+         << " (" << iBookingRequestRecord._stayDuration << " days) "
+         << boost::posix_time::seconds (iBookingRequestRecord._preferredDepartureTime)
+         << " " << lKey.getPreferredCabin()
+         << " " << stdair::DEFAULT_PARTY_SIZE
+         << " " << lCodePool.getString (iBookingRequestRecord._frequentFlyerType)
+         << " " << iBookingRequestRecord._wtp
+         << " " << iBookingRequestRecord._valueOfTime
+         << " " << iBookingRequestRecord._changeFees
+         << " " << lDemandCharacteristics._changeFeeDisutility
+         << " " << iBookingRequestRecord._nonRefundable
+         << " " << lDemandCharacteristics._nonRefundableDisutility;
+
+    // Be careful: this specific display is mandatory to retrieve the booking 
+    // requests when parsing the demand generation log with python scripts.
+    STDAIR_LOG_NOTIFICATION ("\n[BKG] " << oStr.str());
+  }
+
+}
@@ -0,0 +1,37 @@
+#ifndef __TRADEMGEN_BOM_LOGTRACESINK_HPP
+#define __TRADEMGEN_BOM_LOGTRACESINK_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// TraDemGen
+#include <trademgen/bom/TraceSink.hpp>
+
+namespace TRADEMGEN {
+
+  /**
+   * @brief Trace sink notifying the StdAir log of every request.
+   *
+   * The log lines are the ones parsed by the demand generation tools
+   * (e.g., the "[BKG]" lines extracted by
+   * trademgen_extractBookingRequests); they are formatted only when
+   * that trace sink is in use.
+   */
+  class LogTraceSink : public TraceSink {
+  public:
+    /**
+     * Log the preferred departure date along with the (reference)
+     * number of days.
+     */
+    void traceTimeOfRequest (const DemandStream&, const double);
+
+    /**
+     * Log the description of the corresponding booking request, in the
+     * format of stdair::BookingRequestStruct::describe(), straight from
+     * the record (no booking request structure is built).
+     */
+    void traceBookingRequest (const DemandStream&, const BookingRequestRecord&);
+  };
+
+}
+#endif // __TRADEMGEN_BOM_LOGTRACESINK_HPP
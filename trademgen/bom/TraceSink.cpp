@@ -0,0 +1,15 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// TraDemGen
+#include <trademgen/bom/TraceSink.hpp>
+
+namespace TRADEMGEN {
+
+  // ////////////////////////////////////////////////////////////////////
+  NullTraceSink& NullTraceSink::instance() {
+    static NullTraceSink lNullTraceSink;
+    return lNullTraceSink;
+  }
+
+}
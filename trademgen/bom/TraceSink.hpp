@@ -0,0 +1,82 @@
+#ifndef __TRADEMGEN_BOM_TRACESINK_HPP
+#define __TRADEMGEN_BOM_TRACESINK_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// TraDemGen
+#include <trademgen/TRADEMGEN_Types.hpp>
+
+namespace TRADEMGEN {
+
+  // Forward declarations
+  class DemandStream;
+  struct BookingRequestRecord;
+
+  /**
+   * @brief Interface receiving the trace of the demand generation,
+   * i.e., the typed records of the generated requests.
+   *
+   * The demand streams hand their records over to the trace sink
+   * as they are generated, without formatting anything; it is up to
+   * the trace sink to format, store or ignore them. By default, the
+   * demand streams trace into the NullTraceSink, which ignores
+   * everything.
+   */
+  class TraceSink {
+  public:
+    /**
+     * Trace the time of a request, as drawn from the arrival pattern.
+     *
+     * @param const DemandStream& Demand stream having drawn the request.
+     * @param const double Reference number of days
+     *        between the departure and the request (the same reference
+     *        as the one given to the drawing tools).
+     */
+    virtual void traceTimeOfRequest (const DemandStream&, const double) = 0;
+
+    /**
+     * Trace a (fully) generated request.
+     *
+     * @param const DemandStream& Demand stream having generated the request.
+     * @param const BookingRequestRecord& Record of the request.
+     */
+    virtual void traceBookingRequest (const DemandStream&,
+                                      const BookingRequestRecord&) = 0;
+
+    /**
+     * Make sure that everything traced so far has reached its
+     * destination.
+     */
+    virtual void flush() {
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~TraceSink() {
+    }
+  };
+
+  /**
+   * @brief Trace sink ignoring everything, used by default.
+   */
+  class NullTraceSink : public TraceSink {
+  public:
+    /**
+     * Shared instance, used by default by the demand streams.
+     */
+    static NullTraceSink& instance();
+
+    /** Ignore the time of the request. */
+    void traceTimeOfRequest (const DemandStream&, const double) {
+    }
+
+    /** Ignore the request. */
+    void traceBookingRequest (const DemandStream&,
+                              const BookingRequestRecord&) {
+    }
+  };
+
+}
+#endif // __TRADEMGEN_BOM_TRACESINK_HPP
@@ -3,6 +3,11 @@
 // //////////////////////////////////////////////////////////////////////
 // STL
 #include <cassert>
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <vector>
 // Boost
 #include <boost/make_shared.hpp>
 // StdAir
@@ -19,10 +24,18 @@
 // SEvMgr
 #include <sevmgr/SEVMGR_Service.hpp>
 // TraDemGen
+#include <trademgen/TRADEMGEN_Exceptions.hpp>
 #include <trademgen/basic/DemandCharacteristics.hpp>
+#include <trademgen/basic/DemandCharacteristicsPool.hpp>
 #include <trademgen/basic/DemandDistribution.hpp>
+#include <trademgen/bom/BookingRequestConsumer.hpp>
+#include <trademgen/bom/BookingRequestPipeline.hpp>
+#include <trademgen/bom/BookingRequestRange.hpp>
+#include <trademgen/bom/CalendarQueue.hpp>
 #include <trademgen/bom/DemandStruct.hpp>
 #include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamFamily.hpp>
+#include <trademgen/bom/DemandStreamRegistry.hpp>
 #include <trademgen/command/DemandManager.hpp>
 
 namespace TRADEMGEN {
@@ -30,7 +43,7 @@ namespace TRADEMGEN {
   // //////////////////////////////////////////////////////////////////////
   void DemandManager::
   buildSampleBomStd (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                     stdair::RandomGeneration& ioSharedGenerator,
+                     const stdair::RandomSeed_T& iMasterSeed,
                      const POSProbabilityMass_T& iPOSProbMass) {
     // Sanity check
     assert (ioSEVMGR_ServicePtr != NULL);
@@ -53,11 +66,6 @@ namespace TRADEMGEN {
     const stdair::StdDevValue_T lDemandStdDev (1.0);
     const DemandDistribution lDemandDistribution (lDemandMean, lDemandStdDev);
     
-    // Seed
-    const stdair::RandomSeed_T& lRequestDateTimeSeed =
-      generateSeed (ioSharedGenerator);
-    const stdair::RandomSeed_T& lDemandCharacteristicsSeed =
-      generateSeed (ioSharedGenerator);
 
     //
     ArrivalPatternCumulativeDistribution_T lDTDProbDist;
@@ -163,9 +171,7 @@ namespace TRADEMGEN {
                           lNonRefundable, lNonRefundableDisutility,
                           lPrefDepTimeProbDist,
                           lWTP, lTimeValueProbDist, lDemandDistribution,
-                          ioSharedGenerator.getBaseGenerator(),
-                          lRequestDateTimeSeed,
-                          lDemandCharacteristicsSeed, iPOSProbMass);
+                          iMasterSeed, iPOSProbMass);
 
     // Calculate the expected total number of events for the current
     // demand stream
@@ -197,48 +203,108 @@ namespace TRADEMGEN {
    const stdair::WTP_T& iMinWTP,
    const ValueOfTimeContinuousDistribution_T& iValueOfTimeContinuousDistribution,
    const DemandDistribution& iDemandDistribution,
-   stdair::BaseGenerator_T&  ioSharedGenerator,
-   const stdair::RandomSeed_T& iRequestDateTimeSeed,
-   const stdair::RandomSeed_T& iDemandCharacteristicsSeed,
+   const stdair::RandomSeed_T& iMasterSeed,
    const POSProbabilityMass_T& iDefaultPOSProbablityMass) {
 
     // Sanity check
     assert (ioSEVMGR_ServicePtr != NULL);
 
-	// 
-    DemandStream& oDemandStream =
-      stdair::FacBom<DemandStream>::instance().create (iKey);
+    // The demand characteristics are shared with the other demand rows
+    // having the same ones.
+    const DemandCharacteristics lDemandCharacteristics (iArrivalPattern,
+                                                        iPOSProbMass,
+                                                        iChannelProbMass,
+                                                        iTripTypeProbMass,
+                                                        iStayDurationProbMass,
+                                                        iFrequentFlyerProbMass,
+                                                        iChangeFeeProb,
+                                                        iChangeFeeDisutility,
+                                                        iNonRefundableProb,
+                                                        iNonRefundableDisutility,
+                                                        iPreferredDepartureTimeContinuousDistribution,
+                                                        iMinWTP,
+                                                        iValueOfTimeContinuousDistribution);
+    const DemandCharacteristicsPtr_T lDemandCharacteristics_ptr =
+      DemandCharacteristicsPool::instance().intern (lDemandCharacteristics);
+
+    return createDemandStream (ioSEVMGR_ServicePtr, iKey,
+                               lDemandCharacteristics_ptr, iDemandDistribution,
+                               iMasterSeed, iDefaultPOSProbablityMass);
+  }
 
-    oDemandStream.setAll (iArrivalPattern, iPOSProbMass,
-                          iChannelProbMass, iTripTypeProbMass,
-                          iStayDurationProbMass, iFrequentFlyerProbMass,
-                          iChangeFeeProb, iChangeFeeDisutility,
-                          iNonRefundableProb, iNonRefundableDisutility,
-                          iPreferredDepartureTimeContinuousDistribution,
-                          iMinWTP, iValueOfTimeContinuousDistribution,
-                          iDemandDistribution, ioSharedGenerator,
-                          iRequestDateTimeSeed, iDemandCharacteristicsSeed,
-                          iDefaultPOSProbablityMass);
+  // //////////////////////////////////////////////////////////////////////
+  DemandStream& DemandManager::createDemandStream
+  (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
+   const DemandStreamKey& iKey,
+   const DemandCharacteristicsPtr_T& iDemandCharacteristics_ptr,
+   const DemandDistribution& iDemandDistribution,
+   const stdair::RandomSeed_T& iMasterSeed,
+   const POSProbabilityMass_T& iDefaultPOSProbablityMass) {
 
-    ioSEVMGR_ServicePtr->addEventGenerator (oDemandStream);
+    // The demand stream is the single date of its family
+    DemandStreamFamily& lDemandStreamFamily =
+      createDemandStreamFamily (ioSEVMGR_ServicePtr, iKey,
+                                iDemandCharacteristics_ptr, iDemandDistribution,
+                                iMasterSeed, iDefaultPOSProbablityMass);
 
-    return oDemandStream;
+    return lDemandStreamFamily.
+      addDemandStream (iKey.getPreferredDepartureDate());
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  DemandStreamFamily& DemandManager::createDemandStreamFamily
+  (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
+   const DemandStreamKey& iKey,
+   const DemandCharacteristicsPtr_T& iDemandCharacteristics_ptr,
+   const DemandDistribution& iDemandDistribution,
+   const stdair::RandomSeed_T& iMasterSeed,
+   const POSProbabilityMass_T& iDefaultPOSProbablityMass) {
+
+    // Sanity check
+    assert (ioSEVMGR_ServicePtr != NULL);
+
+    // 
+    DemandStreamFamily& oDemandStreamFamily =
+      stdair::FacBom<DemandStreamFamily>::instance().create (iKey);
+
+    oDemandStreamFamily.setAll (iDemandCharacteristics_ptr,
+                                iDemandDistribution, iMasterSeed,
+                                iDefaultPOSProbablityMass);
+
+    ioSEVMGR_ServicePtr->addEventGenerator (oDemandStreamFamily);
+
+    return oDemandStreamFamily;
   }
     
   // //////////////////////////////////////////////////////////////////////
   void DemandManager::
   createDemandCharacteristics (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                               stdair::RandomGeneration& ioSharedGenerator,
+                               const stdair::RandomSeed_T& iMasterSeed,
                                const POSProbabilityMass_T& iPOSProbMass,
                                const DemandStruct& iDemand) {
     // Sanity check
     assert (ioSEVMGR_ServicePtr != NULL);
-	
-    //
-    stdair::BaseGenerator_T& lSharedGenerator =
-      ioSharedGenerator.getBaseGenerator();
-    
-    // Parse the date period and DoW and generate demand characteristics.
+
+    // The demand characteristics are the same for all the dates, and
+    // shared with the other demand rows having the same ones.
+    const DemandCharacteristics lDemandCharacteristics (iDemand._dtdProbDist,
+                                                        iDemand._posProbDist,
+                                                        iDemand._channelProbDist,
+                                                        iDemand._tripProbDist,
+                                                        iDemand._stayProbDist,
+                                                        iDemand._ffProbDist,
+                                                        iDemand._changeFeeProb,
+                                                        iDemand._changeFeeDisutility,
+                                                        iDemand._nonRefundableProb,
+                                                        iDemand._nonRefundableDisutility,
+                                                        iDemand._prefDepTimeProbDist,
+                                                        iDemand._minWTP,
+                                                        iDemand._timeValueProbDist);
+    const DemandCharacteristicsPtr_T lDemandCharacteristics_ptr =
+      DemandCharacteristicsPool::instance().intern (lDemandCharacteristics);
+
+    // Parse the date period and DoW, so as to retrieve the active dates.
+    std::vector<stdair::Date_T> lDateList;
     const stdair::DatePeriod_T lDateRange = iDemand._dateRange;
     for (boost::gregorian::day_iterator itDate = lDateRange.begin();
          itDate != lDateRange.end(); ++itDate) {
@@ -254,120 +320,142 @@ namespace TRADEMGEN {
       const bool isDoWActive = lDoWList.getStandardDayOfWeek (currentDoW);
 
       if (isDoWActive == true) {
-        const DemandStreamKey lDemandStreamKey (iDemand._origin,
-                                                iDemand._destination,
-                                                currentDate,
-                                                iDemand._prefCabin);
-        // DEBUG
-        // STDAIR_LOG_DEBUG ("Demand stream key: " << lDemandStreamKey.describe());
-        
-        //
-        const DemandDistribution lDemandDistribution (iDemand._demandMean,
-                                                      iDemand._demandStdDev);
-        
-        // Seed
-        const stdair::RandomSeed_T& lRequestDateTimeSeed =
-          generateSeed (ioSharedGenerator);
-        const stdair::RandomSeed_T& lDemandCharacteristicsSeed =
-          generateSeed (ioSharedGenerator);
-        
-        // Delegate the call to the dedicated command
-        DemandStream& lDemandStream = 
-          createDemandStream (ioSEVMGR_ServicePtr, lDemandStreamKey,
-                              iDemand._dtdProbDist, iDemand._posProbDist,
-                              iDemand._channelProbDist,
-                              iDemand._tripProbDist,
-                              iDemand._stayProbDist, iDemand._ffProbDist,
-                              iDemand._changeFeeProb,
-                              iDemand._changeFeeDisutility,
-                              iDemand._nonRefundableProb,
-                              iDemand._nonRefundableDisutility,
-                              iDemand._prefDepTimeProbDist,
-                              iDemand._minWTP,
-                              iDemand._timeValueProbDist,
-                              lDemandDistribution, lSharedGenerator,
-                              lRequestDateTimeSeed,
-                              lDemandCharacteristicsSeed,
-                              iPOSProbMass);
-        
-        // Calculate the expected total number of events for the current
-        // demand stream
-        const stdair::NbOfRequests_T& lExpectedTotalNbOfEvents =
-          lDemandStream.getMeanNumberOfRequests();
-        
-        /**
-         * Initialise the progress statuses, one specific to the
-         * booking request type.
-         */
-        ioSEVMGR_ServicePtr->addStatus (stdair::EventType::BKG_REQ,
-                                        lExpectedTotalNbOfEvents);
+        lDateList.push_back (currentDate);
       }
     }
-  }
 
-  // ////////////////////////////////////////////////////////////////////
-  stdair::RandomSeed_T DemandManager::
-  generateSeed (stdair::RandomGeneration& ioSharedGenerator) {
-    stdair::RealNumber_T lVariateUnif = ioSharedGenerator() * 1e9;
-    stdair::RandomSeed_T oSeed = static_cast<stdair::RandomSeed_T>(lVariateUnif);
-    return oSeed;
+    if (lDateList.empty() == true) {
+      return;
+    }
+
+    // The demand row is a single event generator, i.e., the family of
+    // its demand streams (one per active date), identified by the key
+    // of the first one.
+    const DemandStreamKey lDemandStreamKey (iDemand._origin,
+                                            iDemand._destination,
+                                            lDateList.front(),
+                                            iDemand._prefCabin);
+    // DEBUG
+    // STDAIR_LOG_DEBUG ("Demand stream key: " << lDemandStreamKey.describe());
+
+    const DemandDistribution lDemandDistribution (iDemand._demandMean,
+                                                  iDemand._demandStdDev);
+    DemandStreamFamily& lDemandStreamFamily =
+      createDemandStreamFamily (ioSEVMGR_ServicePtr, lDemandStreamKey,
+                                lDemandCharacteristics_ptr,
+                                lDemandDistribution, iMasterSeed,
+                                iPOSProbMass);
+
+    lDemandStreamFamily.reserve (lDateList.size());
+    stdair::NbOfRequests_T lExpectedTotalNbOfEvents = 0;
+    for (std::vector<stdair::Date_T>::const_iterator itDate = lDateList.begin();
+         itDate != lDateList.end(); ++itDate) {
+      const DemandStream& lDemandStream =
+        lDemandStreamFamily.addDemandStream (*itDate);
+
+      // Calculate the expected total number of events for the current
+      // demand stream
+      lExpectedTotalNbOfEvents += lDemandStream.getMeanNumberOfRequests();
+    }
+        
+    /**
+     * Initialise the progress statuses, one specific to the
+     * booking request type.
+     */
+    ioSEVMGR_ServicePtr->addStatus (stdair::EventType::BKG_REQ,
+                                    lExpectedTotalNbOfEvents);
   }
-  
+
   // ////////////////////////////////////////////////////////////////////
   const bool DemandManager::
-  stillHavingRequestsToBeGenerated (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
+  stillHavingRequestsToBeGenerated (const DemandStreamRegistry& iDemandStreamRegistry,
                                     const stdair::DemandStreamKeyStr_T& iKey,
                                     stdair::ProgressStatusSet& ioPSS,
                                     const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
-    // Sanity check
-    assert (ioSEVMGR_ServicePtr != NULL);
-    
     // Retrieve the DemandStream which corresponds to the given key.
+    const DemandStream& lDemandStream = iDemandStreamRegistry.
+      getDemandStream (iDemandStreamRegistry.getDemandStreamHandle (iKey));
+
+    return stillHavingRequestsToBeGenerated (lDemandStream, iKey, ioPSS,
+                                             iDemandGenerationMethod);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const bool DemandManager::
+  stillHavingRequestsToBeGenerated (const DemandStreamRegistry& iDemandStreamRegistry,
+                                    const DemandStreamHandle_T& iHandle,
+                                    stdair::ProgressStatusSet& ioPSS,
+                                    const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
+    // Retrieve the DemandStream which corresponds to the given handle.
     const DemandStream& lDemandStream =
-      ioSEVMGR_ServicePtr->getEventGenerator<DemandStream,stdair::DemandStreamKeyStr_T>(iKey);
+      iDemandStreamRegistry.getDemandStream (iHandle);
+
+    return stillHavingRequestsToBeGenerated (lDemandStream,
+                                             iDemandStreamRegistry.getDemandStreamKey (iHandle),
+                                             ioPSS, iDemandGenerationMethod);
+  }
 
+  // ////////////////////////////////////////////////////////////////////
+  const bool DemandManager::
+  stillHavingRequestsToBeGenerated (const DemandStream& iDemandStream,
+                                    const stdair::DemandStreamKeyStr_T& iKey,
+                                    stdair::ProgressStatusSet& ioPSS,
+                                    const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
     // Retrieve the progress status of the demand stream.
     stdair::ProgressStatus
-      lProgressStatus (lDemandStream.getNumberOfRequestsGeneratedSoFar(),
-                       lDemandStream.getMeanNumberOfRequests(),
-                       lDemandStream.getTotalNumberOfRequestsToBeGenerated());
+      lProgressStatus (iDemandStream.getNumberOfRequestsGeneratedSoFar(),
+                       iDemandStream.getMeanNumberOfRequests(),
+                       iDemandStream.getTotalNumberOfRequestsToBeGenerated());
     ioPSS.setSpecificGeneratorStatus (lProgressStatus, iKey);
     
-    return lDemandStream.stillHavingRequestsToBeGenerated (iDemandGenerationMethod);
+    return iDemandStream.stillHavingRequestsToBeGenerated (iDemandGenerationMethod);
   }
 
   // ////////////////////////////////////////////////////////////////////
   stdair::BookingRequestPtr_T DemandManager::
   generateNextRequest (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                       stdair::RandomGeneration& ioGenerator,
+                       const DemandStreamRegistry& iDemandStreamRegistry,
                        const stdair::DemandStreamKeyStr_T& iKey,
                        const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
-    // Sanity check
-    assert (ioSEVMGR_ServicePtr != NULL);
-
     // Retrieve the DemandStream which corresponds to the given key.
+    DemandStream& lDemandStream = iDemandStreamRegistry.
+      getDemandStream (iDemandStreamRegistry.getDemandStreamHandle (iKey));
+
+    return generateNextRequest (ioSEVMGR_ServicePtr, lDemandStream,
+                                iDemandGenerationMethod);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::BookingRequestPtr_T DemandManager::
+  generateNextRequest (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
+                       const DemandStreamRegistry& iDemandStreamRegistry,
+                       const DemandStreamHandle_T& iHandle,
+                       const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
+    // Retrieve the DemandStream which corresponds to the given handle.
     DemandStream& lDemandStream =
-      ioSEVMGR_ServicePtr->getEventGenerator<DemandStream,stdair::DemandStreamKeyStr_T>(iKey);
+      iDemandStreamRegistry.getDemandStream (iHandle);
+
+    return generateNextRequest (ioSEVMGR_ServicePtr, lDemandStream,
+                                iDemandGenerationMethod);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::BookingRequestPtr_T DemandManager::
+  generateNextRequest (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
+                       DemandStream& ioDemandStream,
+                       const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
+    // Sanity check
+    assert (ioSEVMGR_ServicePtr != NULL);
 
     // Generate the next booking request
+    BookingRequestRecord lBookingRequestRecord;
+    ioDemandStream.generateNextRequest (iDemandGenerationMethod,
+                                        lBookingRequestRecord);
     stdair::BookingRequestPtr_T lBookingRequest =
-      lDemandStream.generateNextRequest (ioGenerator,
-                                         iDemandGenerationMethod);
-
-    const stdair::DateTime_T& lBookingRequestDateTime =
-      lBookingRequest->getRequestDateTime();
-    const stdair::Date_T& lBookingRequestDate =
-      lBookingRequestDateTime.date();
-    const stdair::Duration_T& lBookingRequestTime =
-      lBookingRequestDateTime.time_of_day();
-    const stdair::Date_T& lPreferedDepartureDate =
-      lBookingRequest->getPreferedDepartureDate();
-    const stdair::Duration_T& lPreferedDepartureTime =
-      lBookingRequest->getPreferredDepartureTime(); 
-
-    if ((lPreferedDepartureDate > lBookingRequestDate) ||
-        (lPreferedDepartureDate == lBookingRequestDate &&
-         lPreferedDepartureTime > lBookingRequestTime)) {
+      ioDemandStream.createBookingRequest (lBookingRequestRecord);
+
+    if (ioDemandStream.
+        isBeforePreferredDepartureDateTime (lBookingRequestRecord) == true) {
 
       // Create an event structure
       stdair::EventStruct lEventStruct (stdair::EventType::BKG_REQ,
@@ -396,22 +484,218 @@ namespace TRADEMGEN {
     return lBookingRequest;
   }
 
+  // ////////////////////////////////////////////////////////////////////
+  void DemandManager::
+  generateNextRequest (const DemandStreamRegistry& iDemandStreamRegistry,
+                       const DemandStreamHandle_T& iHandle,
+                       BookingRequestRecord& ioBookingRequestRecord,
+                       const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
+    // Retrieve the DemandStream which corresponds to the given handle.
+    DemandStream& lDemandStream =
+      iDemandStreamRegistry.getDemandStream (iHandle);
+
+    lDemandStream.generateNextRequest (iDemandGenerationMethod,
+                                       ioBookingRequestRecord);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::BookingRequestPtr_T DemandManager::
+  createBookingRequest (const DemandStreamRegistry& iDemandStreamRegistry,
+                        const BookingRequestRecord& iBookingRequestRecord) {
+    // Retrieve the DemandStream having generated the request.
+    const DemandStream& lDemandStream = iDemandStreamRegistry.
+      getDemandStream (iBookingRequestRecord._demandStreamHandle);
+
+    return lDemandStream.createBookingRequest (iBookingRequestRecord);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  /** Hand over all the requests of the range to the consumer, the
+      range being advanced with the path specialised for its
+      generation method. */
+  template <typename GENERATION_METHOD>
+  static stdair::Count_T
+  consumeAll (BookingRequestRange& ioBookingRequestRange,
+              BookingRequestConsumer& ioBookingRequestConsumer) {
+    stdair::Count_T oNbOfRequests = 0;
+    for ( ; ioBookingRequestRange.empty() == false;
+         ioBookingRequestRange.nextWith<GENERATION_METHOD>()) {
+      ++oNbOfRequests;
+      const bool shouldGoOn =
+        ioBookingRequestConsumer.consume (ioBookingRequestRange.getDemandStream(),
+                                          ioBookingRequestRange.front());
+      if (shouldGoOn == false) {
+        break;
+      }
+    }
+
+    return oNbOfRequests;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T DemandManager::
+  generateAll (const DemandStreamRegistry& iDemandStreamRegistry,
+               const stdair::DemandGenerationMethod& iDemandGenerationMethod,
+               BookingRequestConsumer& ioBookingRequestConsumer) {
+    // The range generates the first request of each demand stream,
+    // then the next request of the same demand stream at each step
+    BookingRequestRange lBookingRequestRange (iDemandStreamRegistry,
+                                              iDemandGenerationMethod);
+
+    // The generation method is dispatched once for the whole run
+    const stdair::DemandGenerationMethod::EN_DemandGenerationMethod& lENDemandGenerationMethod =
+      iDemandGenerationMethod.getMethod();
+    switch (lENDemandGenerationMethod) {
+    case stdair::DemandGenerationMethod::POI_PRO:
+      return consumeAll<DemandStream::PoissonProcessMethod>
+        (lBookingRequestRange, ioBookingRequestConsumer);
+    case stdair::DemandGenerationMethod::STA_ORD:
+      return consumeAll<DemandStream::StatisticsOrderMethod>
+        (lBookingRequestRange, ioBookingRequestConsumer);
+    default: assert (false); break;
+    }
+    return 0;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T DemandManager::
+  generateAllConcurrently (const DemandStreamRegistry& iDemandStreamRegistry,
+                           const stdair::DemandGenerationMethod& iDemandGenerationMethod,
+                           BookingRequestConsumer& ioBookingRequestConsumer) {
+    // The generator thread starts right away
+    BookingRequestPipeline lBookingRequestPipeline (iDemandStreamRegistry,
+                                                    iDemandGenerationMethod);
+
+    stdair::Count_T oNbOfRequests = 0;
+    BookingRequestRecord lBookingRequestRecord;
+    while (lBookingRequestPipeline.pop (lBookingRequestRecord) == true) {
+      ++oNbOfRequests;
+      const bool shouldGoOn = ioBookingRequestConsumer.
+        consume (lBookingRequestPipeline.getDemandStream (lBookingRequestRecord),
+                 lBookingRequestRecord);
+      if (shouldGoOn == false) {
+        break;
+      }
+    }
+
+    // Wait for the generator thread
+    lBookingRequestPipeline.stop();
+
+    return oNbOfRequests;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T DemandManager::
+  generateAllInParallel (const DemandStreamRegistry& iDemandStreamRegistry,
+                         const stdair::DemandGenerationMethod& iDemandGenerationMethod,
+                         const unsigned int iNbOfThreads,
+                         BookingRequestConsumer& ioBookingRequestConsumer) {
+    typedef boost::shared_ptr<BookingRequestPipeline> BookingRequestPipelinePtr_T;
+    typedef std::vector<BookingRequestPipelinePtr_T> BookingRequestPipelineList_T;
+
+    // Number of generator threads, none of them being left without
+    // any demand stream
+    DemandStreamHandle_T lNbOfThreads = iNbOfThreads;
+    if (lNbOfThreads == 0) {
+      lNbOfThreads = std::max (std::thread::hardware_concurrency(), 1U);
+    }
+    lNbOfThreads = std::min (lNbOfThreads,
+                             iDemandStreamRegistry.getNbOfDemandStreams());
+    lNbOfThreads = std::max (lNbOfThreads, static_cast<DemandStreamHandle_T> (1));
+
+    // The trace sinks are called by the generator threads; none of the
+    // shipped ones may be called from several threads at once
+    if (lNbOfThreads > 1) {
+      const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+        iDemandStreamRegistry.getDemandStreamList();
+      for (DemandStreamRegistry::DemandStreamList_T::const_iterator itDS =
+             lDemandStreamList.begin(); itDS != lDemandStreamList.end(); ++itDS) {
+        const DemandStream* lCurrentDS_ptr = *itDS;
+        assert (lCurrentDS_ptr != NULL);
+
+        if (&lCurrentDS_ptr->getTraceSink() != &NullTraceSink::instance()) {
+          std::ostringstream oStr;
+          oStr << "The demand stream '" << lCurrentDS_ptr->describeKey()
+               << "' has a trace sink, which would be called from "
+               << lNbOfThreads << " generator threads at once. Either unset "
+               << "the trace sink, or generate with a single thread";
+          STDAIR_LOG_ERROR (oStr.str());
+          throw UnsafeTraceSinkException (oStr.str());
+        }
+      }
+    }
+
+    // Start the generator threads, each one with its share of the
+    // demand streams
+    BookingRequestPipelineList_T lBookingRequestPipelineList;
+    lBookingRequestPipelineList.reserve (lNbOfThreads);
+    for (DemandStreamHandle_T idx = 0; idx != lNbOfThreads; ++idx) {
+      lBookingRequestPipelineList.
+        push_back (boost::make_shared<BookingRequestPipeline>
+                   (iDemandStreamRegistry, iDemandGenerationMethod,
+                    BookingRequestPipeline::DEFAULT_CAPACITY, idx, lNbOfThreads));
+    }
+
+    /**
+     * K-way merge: the queue holds (at most) one pending request per
+     * generator thread, which is replaced, once handed over to the
+     * consumer, by the next request of the same generator thread.
+     */
+    CalendarQueue::BookingRequestRecordList_T lRequestList;
+    lRequestList.reserve (lNbOfThreads);
+    BookingRequestRecord lBookingRequestRecord;
+    for (BookingRequestPipelineList_T::const_iterator itPipeline =
+           lBookingRequestPipelineList.begin();
+         itPipeline != lBookingRequestPipelineList.end(); ++itPipeline) {
+      if ((*itPipeline)->pop (lBookingRequestRecord) == true) {
+        lRequestList.push_back (lBookingRequestRecord);
+      }
+    }
+    CalendarQueue lRequestQueue;
+    lRequestQueue.push (lRequestList);
+
+    stdair::Count_T oNbOfRequests = 0;
+    while (lRequestQueue.empty() == false) {
+      const BookingRequestRecord lEarliestRequestRecord = lRequestQueue.pop();
+      BookingRequestPipeline& lBookingRequestPipeline =
+        *lBookingRequestPipelineList[lEarliestRequestRecord._demandStreamHandle
+                                     % lNbOfThreads];
+
+      ++oNbOfRequests;
+      const bool shouldGoOn = ioBookingRequestConsumer.
+        consume (lBookingRequestPipeline.getDemandStream (lEarliestRequestRecord),
+                 lEarliestRequestRecord);
+      if (shouldGoOn == false) {
+        break;
+      }
+
+      if (lBookingRequestPipeline.pop (lBookingRequestRecord) == true) {
+        lRequestQueue.push (lBookingRequestRecord);
+      }
+    }
+
+    // Wait for the generator threads
+    for (BookingRequestPipelineList_T::const_iterator itPipeline =
+           lBookingRequestPipelineList.begin();
+         itPipeline != lBookingRequestPipelineList.end(); ++itPipeline) {
+      (*itPipeline)->stop();
+    }
+
+    return oNbOfRequests;
+  }
+
   // ////////////////////////////////////////////////////////////////////
   stdair::Count_T DemandManager::
   generateFirstRequests (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                         stdair::RandomGeneration& ioGenerator,
+                         const DemandStreamRegistry& iDemandStreamRegistry,
                          const stdair::DemandGenerationMethod& iDemandGenerationMethod) {
     // Sanity check
     assert (ioSEVMGR_ServicePtr != NULL);
 
-    // Actual total number of events to be generated
-    stdair::NbOfRequests_T lActualTotalNbOfEvents = 0.0;
-
-    // Retrieve the DemandStream list
-    const DemandStreamList_T& lDemandStreamList =
-      ioSEVMGR_ServicePtr->getEventGeneratorList<DemandStream>();
-
-    for (DemandStreamList_T::const_iterator itDemandStream =
+    // Browse the registered demand streams
+    const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+      iDemandStreamRegistry.getDemandStreamList();
+    for (DemandStreamRegistry::DemandStreamList_T::const_iterator itDemandStream =
            lDemandStreamList.begin();
          itDemandStream != lDemandStreamList.end(); ++itDemandStream) {
       DemandStream* lDemandStream_ptr = *itDemandStream;
@@ -419,15 +703,6 @@ namespace TRADEMGEN {
 
       lDemandStream_ptr->setBoolFirstDateTimeRequest(true);
 
-      // Calculate the expected total number of events for the current
-      // demand stream
-      const stdair::NbOfRequests_T& lActualNbOfEvents =
-        lDemandStream_ptr->getTotalNumberOfRequestsToBeGenerated();
-      lActualTotalNbOfEvents += lActualNbOfEvents;
-
-      // Retrieve the key of the demand stream
-      const DemandStreamKey& lKey = lDemandStream_ptr->getKey();
-
       // Check whether there are still booking requests to be generated
       const bool stillHavingRequestsToBeGenerated =
         lDemandStream_ptr->stillHavingRequestsToBeGenerated (iDemandGenerationMethod);
@@ -435,12 +710,43 @@ namespace TRADEMGEN {
       if (stillHavingRequestsToBeGenerated) {
         // Generate the next event (booking request), and insert it
         // into the event queue
-        generateNextRequest (ioSEVMGR_ServicePtr, ioGenerator,
-                             lKey.toString(),
+        generateNextRequest (ioSEVMGR_ServicePtr, *lDemandStream_ptr,
                              iDemandGenerationMethod);
       }
     }
     
+    // Update the progress status for the given event type (i.e.,
+    // booking request), and retrieve the actual total number of events
+    // to be generated
+    return updateActualTotalNumberOfRequests (ioSEVMGR_ServicePtr,
+                                              iDemandStreamRegistry);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T DemandManager::
+  updateActualTotalNumberOfRequests (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
+                                     const DemandStreamRegistry& iDemandStreamRegistry) {
+    // Sanity check
+    assert (ioSEVMGR_ServicePtr != NULL);
+
+    // Actual total number of events to be generated
+    stdair::NbOfRequests_T lActualTotalNbOfEvents = 0.0;
+
+    // Browse the registered demand streams
+    const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+      iDemandStreamRegistry.getDemandStreamList();
+    for (DemandStreamRegistry::DemandStreamList_T::const_iterator itDemandStream =
+           lDemandStreamList.begin();
+         itDemandStream != lDemandStreamList.end(); ++itDemandStream) {
+      const DemandStream* lDemandStream_ptr = *itDemandStream;
+      assert (lDemandStream_ptr != NULL);
+
+      // Add the actual total number of events for the current demand
+      // stream
+      lActualTotalNbOfEvents +=
+        lDemandStream_ptr->getTotalNumberOfRequestsToBeGenerated();
+    }
+
     // Update the progress status for the given event type (i.e.,
     // booking request)
     ioSEVMGR_ServicePtr->updateStatus (stdair::EventType::BKG_REQ,
@@ -453,9 +759,37 @@ namespace TRADEMGEN {
     return oTotalNbOfEvents;
   }
   
+  // ////////////////////////////////////////////////////////////////////
+  void DemandManager::
+  registerDemandStreams (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
+                         DemandStreamRegistry& ioDemandStreamRegistry) {
+    // Sanity check
+    assert (ioSEVMGR_ServicePtr != NULL);
+
+    // The handles follow the order in which the families (demand rows)
+    // have been added to the BOM tree, then the dates within each
+    // family; hence, they do not change when new demand rows are added.
+    ioDemandStreamRegistry.clear();
+    const DemandStreamFamilyList_T& lDemandStreamFamilyList =
+      ioSEVMGR_ServicePtr->getEventGeneratorList<DemandStreamFamily>();
+    for (DemandStreamFamilyList_T::const_iterator itFamily =
+           lDemandStreamFamilyList.begin();
+         itFamily != lDemandStreamFamilyList.end(); ++itFamily) {
+      DemandStreamFamily* lCurrentFamily_ptr = *itFamily;
+      assert (lCurrentFamily_ptr != NULL);
+
+      DemandStreamFamily::DemandStreamList_T& lDemandStreamList =
+        lCurrentFamily_ptr->getDemandStreamList();
+      for (DemandStreamFamily::DemandStreamList_T::iterator itDS =
+             lDemandStreamList.begin(); itDS != lDemandStreamList.end(); ++itDS) {
+        ioDemandStreamRegistry.registerDemandStream (*itDS);
+      }
+    }
+  }
+
   // ////////////////////////////////////////////////////////////////////
   void DemandManager::reset (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                             stdair::BaseGenerator_T& ioShareGenerator) {
+                             const DemandStreamRegistry& iDemandStreamRegistry) {
     // Sanity check
     assert (ioSEVMGR_ServicePtr != NULL);
 
@@ -464,14 +798,15 @@ namespace TRADEMGEN {
     // destroy any BOM object.
 
     // Reset all the DemandStream objects
-    const DemandStreamList_T& lDemandStreamList =
-      ioSEVMGR_ServicePtr->getEventGeneratorList<DemandStream>();
-    for (DemandStreamList_T::const_iterator itDS = lDemandStreamList.begin();
+    const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+      iDemandStreamRegistry.getDemandStreamList();
+    for (DemandStreamRegistry::DemandStreamList_T::const_iterator itDS =
+           lDemandStreamList.begin();
          itDS != lDemandStreamList.end(); ++itDS) {
       DemandStream* lCurrentDS_ptr = *itDS;
       assert (lCurrentDS_ptr != NULL);
       
-      lCurrentDS_ptr->reset (ioShareGenerator);
+      lCurrentDS_ptr->reset();
     }
 
     /**
@@ -483,6 +818,74 @@ namespace TRADEMGEN {
      */
     ioSEVMGR_ServicePtr->reset();
   }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T DemandManager::
+  setJointCharacteristicsSampling (const DemandStreamRegistry& iDemandStreamRegistry,
+                                   const bool iIsJointSampled) {
+    // The demand characteristics are shared (and immutable): the
+    // switched ones are derived only once for all the demand streams
+    // sharing the same original ones.
+    typedef std::map<DemandCharacteristicsPtr_T,
+                     DemandCharacteristicsPtr_T> DemandCharacteristicsMap_T;
+    DemandCharacteristicsMap_T lSwitchedDemandCharacteristicsMap;
+
+    stdair::Count_T oNbOfJointSampledStreams = 0;
+    const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+      iDemandStreamRegistry.getDemandStreamList();
+    for (DemandStreamRegistry::DemandStreamList_T::const_iterator itDS =
+           lDemandStreamList.begin(); itDS != lDemandStreamList.end(); ++itDS) {
+      DemandStream* lCurrentDS_ptr = *itDS;
+      assert (lCurrentDS_ptr != NULL);
+
+      const DemandCharacteristicsPtr_T& lDemandCharacteristics_ptr =
+        lCurrentDS_ptr->getDemandCharacteristicsPtr();
+      DemandCharacteristicsMap_T::const_iterator itDC =
+        lSwitchedDemandCharacteristicsMap.find (lDemandCharacteristics_ptr);
+      if (itDC == lSwitchedDemandCharacteristicsMap.end()) {
+        DemandCharacteristics lDemandCharacteristics (*lDemandCharacteristics_ptr);
+        lDemandCharacteristics.setJointCharacteristicsSampling (iIsJointSampled);
+        const DemandCharacteristicsPtr_T lSwitchedDemandCharacteristics_ptr =
+          DemandCharacteristicsPool::instance().intern (lDemandCharacteristics);
+        itDC = lSwitchedDemandCharacteristicsMap.
+          insert (DemandCharacteristicsMap_T::
+                  value_type (lDemandCharacteristics_ptr,
+                              lSwitchedDemandCharacteristics_ptr)).first;
+      }
+      // For the whole family, so that it remains shared
+      lCurrentDS_ptr->getFamily().setDemandCharacteristics (itDC->second);
+
+      const bool isJointSampled =
+        lCurrentDS_ptr->getDemandCharacteristics().isJointCharacteristicsSampled();
+      if (isJointSampled == true) {
+        ++oNbOfJointSampledStreams;
+
+      } else if (iIsJointSampled == true) {
+        // DEBUG
+        STDAIR_LOG_DEBUG ("The joint table of the demand characteristics "
+                          << "would be too large for the demand stream "
+                          << lCurrentDS_ptr->describeKey()
+                          << "; the characteristics are drawn one by one.");
+      }
+    }
+
+    return oNbOfJointSampledStreams;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void DemandManager::
+  setTraceSink (const DemandStreamRegistry& iDemandStreamRegistry,
+                TraceSink& ioTraceSink) {
+    const DemandStreamRegistry::DemandStreamList_T& lDemandStreamList =
+      iDemandStreamRegistry.getDemandStreamList();
+    for (DemandStreamRegistry::DemandStreamList_T::const_iterator itDS =
+           lDemandStreamList.begin(); itDS != lDemandStreamList.end(); ++itDS) {
+      DemandStream* lCurrentDS_ptr = *itDS;
+      assert (lCurrentDS_ptr != NULL);
+
+      lCurrentDS_ptr->getFamily().setTraceSink (ioTraceSink);
+    }
+  }
   
   // ////////////////////////////////////////////////////////////////////
   bool DemandManager::
@@ -584,7 +987,7 @@ namespace TRADEMGEN {
   // //////////////////////////////////////////////////////////////////////
   void DemandManager::
   buildSampleBom (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                  stdair::RandomGeneration& ioSharedGenerator,
+                  const stdair::RandomSeed_T& iMasterSeed,
                   const POSProbabilityMass_T& iPOSProbMass) {
     // Sanity check
     assert (ioSEVMGR_ServicePtr != NULL);
@@ -689,11 +1092,6 @@ namespace TRADEMGEN {
     const stdair::StdDevValue_T lSINBKKDemandStdDev (4.0);
     const DemandDistribution lSINBKKDemandDistribution (lSINBKKDemandMean, lSINBKKDemandStdDev);
     
-    // Seed
-    const stdair::RandomSeed_T& lSINBKKRequestDateTimeSeed =
-      generateSeed (ioSharedGenerator);
-    const stdair::RandomSeed_T& lSINBKKDemandCharacteristicsSeed =
-      generateSeed (ioSharedGenerator);
 
     
     //
@@ -736,9 +1134,7 @@ namespace TRADEMGEN {
                           lSINPrefDepTimeProbDist,
                           lSINBKKWTP, lTimeValueProbDist,
                           lSINBKKDemandDistribution,
-                          ioSharedGenerator.getBaseGenerator(),
-                          lSINBKKRequestDateTimeSeed,
-                          lSINBKKDemandCharacteristicsSeed, iPOSProbMass);
+                          iMasterSeed, iPOSProbMass);
 
     // Calculate the expected total number of events for the current
     // demand stream
@@ -763,11 +1159,6 @@ namespace TRADEMGEN {
     const stdair::StdDevValue_T lBKKHKGDemandStdDev (4.0);
     const DemandDistribution lBKKHKGDemandDistribution (lBKKHKGDemandMean, lBKKHKGDemandStdDev);
     
-    // Seed
-    const stdair::RandomSeed_T& lBKKHKGRequestDateTimeSeed =
-      generateSeed (ioSharedGenerator);
-    const stdair::RandomSeed_T& lBKKHKGDemandCharacteristicsSeed =
-      generateSeed (ioSharedGenerator);
 
     
     //
@@ -806,9 +1197,7 @@ namespace TRADEMGEN {
                           lBKKPrefDepTimeProbDist,
                           lBKKHKGWTP, lTimeValueProbDist,
                           lBKKHKGDemandDistribution,
-                          ioSharedGenerator.getBaseGenerator(),
-                          lBKKHKGRequestDateTimeSeed,
-                          lBKKHKGDemandCharacteristicsSeed, iPOSProbMass);
+                          iMasterSeed, iPOSProbMass);
 
     // Calculate the expected total number of events for the current
     // demand stream
@@ -831,11 +1220,6 @@ namespace TRADEMGEN {
     const stdair::StdDevValue_T lSINHKGDemandStdDev (4.0);
     const DemandDistribution lSINHKGDemandDistribution (lSINHKGDemandMean, lSINHKGDemandStdDev);
     
-    // Seed
-    const stdair::RandomSeed_T& lSINHKGRequestDateTimeSeed =
-      generateSeed (ioSharedGenerator);
-    const stdair::RandomSeed_T& lSINHKGDemandCharacteristicsSeed =
-      generateSeed (ioSharedGenerator);
 
     
     //
@@ -856,9 +1240,7 @@ namespace TRADEMGEN {
                           lNonRefundable, lNonRefundableDisutility,
                           lSINPrefDepTimeProbDist,
                           lSINHKGWTP, lTimeValueProbDist, lSINHKGDemandDistribution,
-                          ioSharedGenerator.getBaseGenerator(),
-                          lSINHKGRequestDateTimeSeed,
-                          lSINHKGDemandCharacteristicsSeed, iPOSProbMass);
+                          iMasterSeed, iPOSProbMass);
 
     // Calculate the expected total number of events for the current
     // demand stream
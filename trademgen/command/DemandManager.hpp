@@ -16,6 +16,7 @@
 #include <trademgen/TRADEMGEN_Types.hpp>
 #include <trademgen/basic/DemandCharacteristicsTypes.hpp>
 #include <trademgen/bom/DemandStreamKey.hpp>
+#include <trademgen/bom/DemandStreamTypes.hpp>
 
 // Forward declarations
 namespace stdair {
@@ -30,6 +31,11 @@ namespace TRADEMGEN {
   struct DemandDistribution;
   struct DemandStruct;
   class DemandStream;
+  class DemandStreamFamily;
+  class DemandStreamRegistry;
+  struct BookingRequestRecord;
+  class TraceSink;
+  class BookingRequestConsumer;
   namespace DemandParserHelper {
     struct doEndDemand;
   }
@@ -123,12 +129,12 @@ namespace TRADEMGEN {
      * </ul>
      */
     static void buildSampleBomStd (SEVMGR::SEVMGR_ServicePtr_T,
-                                   stdair::RandomGeneration&,
+                                   const stdair::RandomSeed_T&,
                                    const POSProbabilityMass_T&);
 
     // Demand sample bom for partnerships study.
     static void buildSampleBom (SEVMGR::SEVMGR_ServicePtr_T,
-                                stdair::RandomGeneration&,
+                                const stdair::RandomSeed_T&,
                                 const POSProbabilityMass_T&);
 
     /**
@@ -138,24 +144,17 @@ namespace TRADEMGEN {
      *
      * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
      * handler.
-     * @param stdair::RandomGeneration& Boost uniform generator.
+     * @param const stdair::RandomSeed_T& Master seed of the random
+     *   generators of the demand streams.
      */
     static void createDemandCharacteristics (SEVMGR::SEVMGR_ServicePtr_T,
-                                             stdair::RandomGeneration&,
+                                             const stdair::RandomSeed_T&,
                                              const POSProbabilityMass_T&,
                                              const DemandStruct&);
 
     /**
-     * Generate the random seed for the demand characteristic
-     * distributions.
-     *
-     * @param stdair::RandomGeneration& Boost uniform generator.
-     * @return stdair::RandomSeed_T The generated seed.
-     */
-    static stdair::RandomSeed_T generateSeed (stdair::RandomGeneration&);
-
-    /**
-     * Create a demand stream object and add it into the BOM tree.
+     * Create a demand stream object, within a family of its own (see
+     * createDemandStreamFamily()), and add it into the BOM tree.
      *
      * <br>That method returns the expected number of events to be
      * generated by that demand stream. That number is expected, not
@@ -172,6 +171,8 @@ namespace TRADEMGEN {
      * @param const DemandDistribution& Parameters (mean, standard
      *   deviation) of the probability distribution for the demand
      *   generation.
+     * @param const stdair::RandomSeed_T& Master seed of the random
+     *   generators of the demand stream.
      * @return DemandStream& The newly created DemandStream object.
      */
     static DemandStream&
@@ -190,17 +191,63 @@ namespace TRADEMGEN {
                         const PreferredDepartureTimeContinuousDistribution_T&,
                         const stdair::WTP_T&,
                         const ValueOfTimeContinuousDistribution_T&,
-                        const DemandDistribution&, stdair::BaseGenerator_T&,
+                        const DemandDistribution&,
                         const stdair::RandomSeed_T&,
+                        const POSProbabilityMass_T&);
+
+    /**
+     * Create a demand stream object, with the given (shared) demand
+     * characteristics, within a family of its own (see
+     * createDemandStreamFamily()), and add it into the BOM tree.
+     *
+     * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
+     * handler in order to add the demand stream object to the BOM tree.
+     * @param const DemandStreamKey& A string identifying uniquely the
+     *   demand stream (e.g., "SIN-HND 2010-Feb-08 Y").
+     * @param const DemandCharacteristicsPtr_T& Demand characteristics,
+     *   as handed out by the DemandCharacteristicsPool.
+     * @param const stdair::RandomSeed_T& Master seed of the random
+     *   generators of the demand stream.
+     * @return DemandStream& The newly created DemandStream object.
+     */
+    static DemandStream&
+    createDemandStream (SEVMGR::SEVMGR_ServicePtr_T,
+                        const DemandStreamKey&,
+                        const DemandCharacteristicsPtr_T&,
+                        const DemandDistribution&,
                         const stdair::RandomSeed_T&,
                         const POSProbabilityMass_T&);
 
+    /**
+     * Create a family of demand streams (i.e., the event generator of a
+     * demand row), without any demand stream yet, and add it into the
+     * BOM tree. The demand streams (one per date) are then added with
+     * DemandStreamFamily::addDemandStream().
+     *
+     * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
+     * handler in order to add the family object to the BOM tree.
+     * @param const DemandStreamKey& Key of the first demand stream of
+     *   the family (e.g., "SIN-HND 2010-Feb-08 Y").
+     * @param const DemandCharacteristicsPtr_T& Demand characteristics,
+     *   as handed out by the DemandCharacteristicsPool.
+     * @param const stdair::RandomSeed_T& Master seed of the random
+     *   generators of the demand streams.
+     * @return DemandStreamFamily& The newly created family.
+     */
+    static DemandStreamFamily&
+    createDemandStreamFamily (SEVMGR::SEVMGR_ServicePtr_T,
+                              const DemandStreamKey&,
+                              const DemandCharacteristicsPtr_T&,
+                              const DemandDistribution&,
+                              const stdair::RandomSeed_T&,
+                              const POSProbabilityMass_T&);
+
     /**
      * State whether there are still events to be generated for
      * the demand stream, for which the key is given as parameter.
      *
-     * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
-     * handler.
+     * @param const DemandStreamRegistry& Registry of the demand streams
+     *   (SEvMgr knows only the families of the demand streams).
      * @param const DemandStreamKey& A string identifying uniquely the
      *   demand stream (e.g., "SIN-HND 2010-Feb-08 Y").
      * @param stdair::ProgressStatusSet
@@ -213,18 +260,123 @@ namespace TRADEMGEN {
      *   generated.
      */
     static const bool
-    stillHavingRequestsToBeGenerated (SEVMGR::SEVMGR_ServicePtr_T,
+    stillHavingRequestsToBeGenerated (const DemandStreamRegistry&,
                                       const stdair::DemandStreamKeyStr_T&,
                                       stdair::ProgressStatusSet&,
                                       const stdair::DemandGenerationMethod&);
 
+    /**
+     * State whether there are still events to be generated for
+     * the demand stream, for which the handle is given as parameter.
+     *
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     * @param const DemandStreamHandle_T& Handle of the demand stream.
+     * @param stdair::ProgressStatusSet
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     * @return bool Whether or not there are still some events to be
+     *   generated.
+     */
+    static const bool
+    stillHavingRequestsToBeGenerated (const DemandStreamRegistry&,
+                                      const DemandStreamHandle_T&,
+                                      stdair::ProgressStatusSet&,
+                                      const stdair::DemandGenerationMethod&);
+
+    /**
+     * State whether there are still events to be generated for the
+     * given demand stream, and report its progress status.
+     */
+    static const bool
+    stillHavingRequestsToBeGenerated (const DemandStream&,
+                                      const stdair::DemandStreamKeyStr_T&,
+                                      stdair::ProgressStatusSet&,
+                                      const stdair::DemandGenerationMethod&);
+
+    /**
+     * Generate all the booking requests of all the demand streams, and
+     * hand them over to the consumer in the order of their date-times
+     * (the ties being broken by the handles of the demand streams).
+     *
+     * The whole loop (pick the earliest request, then generate the
+     * next one of the same demand stream) is performed here, without
+     * the event queue of SEvMgr, by iterating over a
+     * BookingRequestRange: the pending requests are held by a calendar
+     * queue, and are neither turned into events, nor given altered
+     * date-times when they happen to collide.
+     *
+     * \note When the consumer stops the generation, the demand streams
+     *       are left as they are; reset() must be called before any
+     *       other generation.
+     *
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     * @param const stdair::DemandGenerationMethod& Method used to
+     *        generate the date-times of the requests.
+     * @param BookingRequestConsumer& Consumer of the requests.
+     * @return stdair::Count_T The number of requests handed over to
+     *   the consumer.
+     */
+    static stdair::Count_T generateAll (const DemandStreamRegistry&,
+                                        const stdair::DemandGenerationMethod&,
+                                        BookingRequestConsumer&);
+
+    /**
+     * Same as generateAll(), the requests being generated by a
+     * dedicated generator thread (see BookingRequestPipeline), while
+     * the consumer is called from the calling thread.
+     *
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     * @param const stdair::DemandGenerationMethod& Method used to
+     *        generate the date-times of the requests.
+     * @param BookingRequestConsumer& Consumer of the requests.
+     * @return stdair::Count_T The number of requests handed over to
+     *   the consumer.
+     */
+    static stdair::Count_T
+    generateAllConcurrently (const DemandStreamRegistry&,
+                             const stdair::DemandGenerationMethod&,
+                             BookingRequestConsumer&);
+
+    /**
+     * Same as generateAll(), the demand streams being shared among
+     * several generator threads (the one of handle h going to the
+     * thread h modulo the number of threads). Each generator thread
+     * fills its own ring with its requests, in the order of their
+     * date-times, and the rings are merged, on the calling thread,
+     * into a single sequence ordered by date-time and demand stream
+     * handle.
+     *
+     * As every demand stream draws from its own random generators, the
+     * requests, and their order, are exactly the same as with
+     * generateAll(), whatever the number of threads.
+     *
+     * \note An UnsafeTraceSinkException is thrown when some demand
+     *       stream has a trace sink (other than the NullTraceSink) and
+     *       more than one generator thread is to be started.
+     *
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     * @param const stdair::DemandGenerationMethod& Method used to
+     *        generate the date-times of the requests.
+     * @param const unsigned int Number of generator threads (0 for as
+     *        many as the hardware supports).
+     * @param BookingRequestConsumer& Consumer of the requests.
+     * @return stdair::Count_T The number of requests handed over to
+     *   the consumer.
+     */
+    static stdair::Count_T
+    generateAllInParallel (const DemandStreamRegistry&,
+                           const stdair::DemandGenerationMethod&,
+                           const unsigned int iNbOfThreads,
+                           BookingRequestConsumer&);
+
     /**
      * Generate the first event/booking request for every demand
      * stream.
      *
      * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
      * handler.
-     * @param stdair::RandomGeneration& Random generator.
+     * @param const DemandStreamRegistry& Registry of the demand streams.
      * @param const stdair::DemandGenerationMethod&
      *        States whether the demand generation must be performed
      *        following the method based on statistic orders.
@@ -234,9 +386,28 @@ namespace TRADEMGEN {
      *         be generated, for all the demand stream.
      */
     static stdair::Count_T generateFirstRequests (SEVMGR::SEVMGR_ServicePtr_T,
-                                                  stdair::RandomGeneration&,
+                                                  const DemandStreamRegistry&,
                                                   const stdair::DemandGenerationMethod&);
 
+    /**
+     * Update the progress status of the booking requests with the
+     * actual total number of requests to be generated, i.e., with the
+     * sum of the numbers drawn for every demand stream.
+     *
+     * That is done by generateFirstRequests(), as well as by the
+     * generation of all the requests at once (generateAll() and the
+     * like), which does not go through the event queue.
+     *
+     * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
+     * handler.
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     * @return stdair::Count_T The actual total number of events to
+     *         be generated, for all the demand stream.
+     */
+    static stdair::Count_T
+    updateActualTotalNumberOfRequests (SEVMGR::SEVMGR_ServicePtr_T,
+                                       const DemandStreamRegistry&);
+
     /**
      * Generate a request with the demand stream, for which the key is
      * given as parameter.
@@ -254,7 +425,8 @@ namespace TRADEMGEN {
      *
      * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
      * handler.
-     * @param stdair::RandomGeneration& Random generator.
+     * @param const DemandStreamRegistry& Registry of the demand streams
+     *   (SEvMgr knows only the families of the demand streams).
      * @param const DemandStreamKey& A string identifying uniquely the
      *   demand stream (e.g., "SIN-HND 2010-Feb-08 Y").
      * @param const stdair::DemandGenerationMethod&
@@ -266,20 +438,99 @@ namespace TRADEMGEN {
      *   the booking request structure, which has just been created.
      */
     static stdair::BookingRequestPtr_T
-    generateNextRequest (SEVMGR::SEVMGR_ServicePtr_T, stdair::RandomGeneration&,
+    generateNextRequest (SEVMGR::SEVMGR_ServicePtr_T,
+                         const DemandStreamRegistry&,
                          const stdair::DemandStreamKeyStr_T&,
                          const stdair::DemandGenerationMethod&);
 
+    /**
+     * Generate a request with the demand stream, for which the handle
+     * is given as parameter.
+     *
+     * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
+     * handler.
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     * @param const DemandStreamHandle_T& Handle of the demand stream.
+     * @param const stdair::DemandGenerationMethod&
+     *        States whether the demand generation must be performed
+     *        following the method based on statistic orders.
+     * @return stdair::BookingRequestPtr_T (Boost) shared pointer on
+     *   the booking request structure, which has just been created.
+     */
+    static stdair::BookingRequestPtr_T
+    generateNextRequest (SEVMGR::SEVMGR_ServicePtr_T,
+                         const DemandStreamRegistry&,
+                         const DemandStreamHandle_T&,
+                         const stdair::DemandGenerationMethod&);
+
+    /**
+     * Generate a request with the given demand stream, and add it
+     * to the event queue.
+     */
+    static stdair::BookingRequestPtr_T
+    generateNextRequest (SEVMGR::SEVMGR_ServicePtr_T, DemandStream&,
+                         const stdair::DemandGenerationMethod&);
+
+    /**
+     * Generate a request, as a compact record, with the demand stream
+     * for which the handle is given as parameter. No event is added to
+     * the event queue.
+     */
+    static void generateNextRequest (const DemandStreamRegistry&,
+                                     const DemandStreamHandle_T&,
+                                     BookingRequestRecord&,
+                                     const stdair::DemandGenerationMethod&);
+
+    /**
+     * Create the booking request structure corresponding to the given
+     * record, with the demand stream having generated it.
+     */
+    static stdair::BookingRequestPtr_T
+    createBookingRequest (const DemandStreamRegistry&,
+                          const BookingRequestRecord&);
+
+    /**
+     * Register, within the given registry, all the demand streams of
+     * the BOM tree, thus giving them their (dense) handles.
+     *
+     * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
+     * handler.
+     * @param DemandStreamRegistry& Registry of the demand streams,
+     *   which is emptied beforehand.
+     */
+    static void registerDemandStreams (SEVMGR::SEVMGR_ServicePtr_T,
+                                       DemandStreamRegistry&);
+
     /**
      * Reset the context of the demand streams for another demand
      * generation without having to reparse the demand input file.
      *
      * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service
      * handler.
-     * @param stdair::BaseGenerator_T& The shared generator for the number
-     *   of requests generation.
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     */
+    static void reset (SEVMGR::SEVMGR_ServicePtr_T, const DemandStreamRegistry&);
+
+    /**
+     * Switch on or off, for all the demand streams, the joint sampling
+     * of the categorical demand characteristics.
+     *
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     * @param const bool Whether the joint sampling must be switched on.
+     * @return stdair::Count_T The number of demand streams for which
+     *   the joint sampling is on.
+     */
+    static stdair::Count_T
+    setJointCharacteristicsSampling (const DemandStreamRegistry&, const bool);
+
+    /**
+     * Set the trace sink of all the demand streams.
+     *
+     * @param const DemandStreamRegistry& Registry of the demand streams.
+     * @param TraceSink& Trace sink, receiving the records of the
+     *   generated requests.
      */
-    static void reset (SEVMGR::SEVMGR_ServicePtr_T, stdair::BaseGenerator_T&);
+    static void setTraceSink (const DemandStreamRegistry&, TraceSink&);
 
     /**
      * Generate the potential cancellation event.
@@ -5,7 +5,6 @@
 #include <cassert>
 // StdAir
 #include <stdair/basic/BasFileMgr.hpp>
-#include <stdair/basic/RandomGeneration.hpp>
 #include <stdair/bom/Inventory.hpp>
 // TraDemGen
 #include <trademgen/command/DemandParserHelper.hpp>
@@ -17,7 +16,7 @@ namespace TRADEMGEN {
   void DemandParser::
   generateDemand (const DemandFilePath& iDemandFilename,
                   SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                  stdair::RandomGeneration& ioSharedGenerator,
+                  const stdair::RandomSeed_T& iMasterSeed,
                   const POSProbabilityMass_T& iDefaultPOSProbablityMass) {
 
     const stdair::Filename_T lFilename = iDemandFilename.name();
@@ -35,7 +34,7 @@ namespace TRADEMGEN {
     }
 
     // Initialise the demand file parser.
-    DemandFileParser lDemandParser (ioSEVMGR_ServicePtr, ioSharedGenerator,
+    DemandFileParser lDemandParser (ioSEVMGR_ServicePtr, iMasterSeed,
                                     iDefaultPOSProbablityMass, lFilename);
 
     // Parse the CSV-formatted demand input file, and generate the
@@ -8,6 +8,7 @@
 #include <string>
 // StdAir
 #include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_maths_types.hpp>
 #include <stdair/command/CmdAbstract.hpp>
 // SEvMgr
 #include <sevmgr/SEVMGR_Types.hpp>
@@ -15,11 +16,6 @@
 #include <trademgen/TRADEMGEN_Types.hpp>
 #include <trademgen/basic/DemandCharacteristicsTypes.hpp>
 
-/// Forward declarations
-namespace stdair {
-  struct RandomGeneration;
-}
-
 namespace TRADEMGEN {
   
   /**
@@ -31,18 +27,16 @@ namespace TRADEMGEN {
      * Parse the CSV file describing travel demand, for instance for
      * generating simulated booking request in a simulator.
      *
-     * The state of the random generator, given as parameter, evolves
-     * each time a demand request is generated.
-     *
      * @param const DemandFilePath& The file-name of the
               CSV-formatted demand input file.
      * @param SEVMGR::SEVMGR_ServicePtr_T Pointer on the SEvMgr service handler
      * to update the queue with the parsed information.
-     * @param stdair::RandomGeneration& Random generator.
+     * @param const stdair::RandomSeed_T& Master seed of the random
+     *   generators of the demand streams.
      */
     static void generateDemand (const DemandFilePath&,
                                 SEVMGR::SEVMGR_ServicePtr_T,
-                                stdair::RandomGeneration&,
+                                const stdair::RandomSeed_T&,
                                 const POSProbabilityMass_T&);
   };
 }
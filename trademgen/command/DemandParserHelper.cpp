@@ -455,12 +455,11 @@ namespace TRADEMGEN {
 
     // //////////////////////////////////////////////////////////////////
     doEndDemand::doEndDemand (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                              stdair::RandomGeneration& ioSharedGenerator,
+                              const stdair::RandomSeed_T& iMasterSeed,
                               const POSProbabilityMass_T& iPOSProbMass,
                               DemandStruct& ioDemand)
       : ParserSemanticAction (ioDemand),
-        _sevmgrServicePtr (ioSEVMGR_ServicePtr),
-        _uniformGenerator (ioSharedGenerator),
+        _sevmgrServicePtr (ioSEVMGR_ServicePtr), _masterSeed (iMasterSeed),
         _posProbabilityMass (iPOSProbMass) {
     }
     
@@ -473,7 +472,7 @@ namespace TRADEMGEN {
 
       // Create the Demand BOM objects
       DemandManager::createDemandCharacteristics (_sevmgrServicePtr,
-                                                  _uniformGenerator,
+                                                  _masterSeed,
                                                   _posProbabilityMass, _demand);
                                  
       // Clean the lists
@@ -566,11 +565,10 @@ namespace TRADEMGEN {
 
     // //////////////////////////////////////////////////////////////////
     DemandParser::DemandParser (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                                stdair::RandomGeneration& ioSharedGenerator,
+                                const stdair::RandomSeed_T& iMasterSeed,
                                 const POSProbabilityMass_T& iPOSProbMass,
                                 DemandStruct& ioDemand) 
-      : _sevmgrServicePtr (ioSEVMGR_ServicePtr),
-        _uniformGenerator (ioSharedGenerator),
+      : _sevmgrServicePtr (ioSEVMGR_ServicePtr), _masterSeed (iMasterSeed),
         _posProbabilityMass (iPOSProbMass), _demand (ioDemand) {
     }
 
@@ -606,7 +604,7 @@ namespace TRADEMGEN {
         >> ';' >> dtd_dist
         >> ';' >> demand_params
         >> demand_end[doEndDemand (self._sevmgrServicePtr,
-                                   self._uniformGenerator,
+                                   self._masterSeed,
                                    self._posProbabilityMass, self._demand)]
         ;
 
@@ -852,12 +850,11 @@ namespace TRADEMGEN {
   // //////////////////////////////////////////////////////////////////////
   DemandFileParser::
   DemandFileParser (SEVMGR::SEVMGR_ServicePtr_T ioSEVMGR_ServicePtr,
-                    stdair::RandomGeneration& ioSharedGenerator,
+                    const stdair::RandomSeed_T& iMasterSeed,
                     const POSProbabilityMass_T& iPOSProbMass,
                     const std::string& iFilename)
     : _filename (iFilename),
-      _sevmgrServicePtr (ioSEVMGR_ServicePtr),
-      _uniformGenerator (ioSharedGenerator),
+      _sevmgrServicePtr (ioSEVMGR_ServicePtr), _masterSeed (iMasterSeed),
       _posProbabilityMass (iPOSProbMass) {
     init();
   }
@@ -901,7 +898,7 @@ namespace TRADEMGEN {
 
     // Initialise the parser (grammar) with the helper/staging structure.
     DemandParserHelper::DemandParser lDemandParser (_sevmgrServicePtr,
-                                                    _uniformGenerator,
+                                                    _masterSeed,
                                                     _posProbabilityMass,
                                                     _demand);
       
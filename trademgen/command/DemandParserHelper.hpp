@@ -15,11 +15,6 @@
 #include <trademgen/basic/BasParserTypes.hpp>
 #include <trademgen/bom/DemandStruct.hpp>
 
-// Forward declarations
-namespace stdair {
-  struct RandomGeneration;
-}
-
 namespace TRADEMGEN {
 
   namespace DemandParserHelper {
@@ -274,13 +269,13 @@ namespace TRADEMGEN {
     /** Mark the end of the demand parsing. */
     struct doEndDemand : public ParserSemanticAction {
       /** Actor Constructor. */
-      doEndDemand (SEVMGR::SEVMGR_ServicePtr_T, stdair::RandomGeneration&,
+      doEndDemand (SEVMGR::SEVMGR_ServicePtr_T, const stdair::RandomSeed_T&,
                    const POSProbabilityMass_T&, DemandStruct&);
       /** Actor Function (functor). */
       void operator() (iterator_t iStr, iterator_t iStrEnd) const;
       /** Actor Specific Context. */
       SEVMGR::SEVMGR_ServicePtr_T _sevmgrServicePtr;
-      stdair::RandomGeneration& _uniformGenerator;
+      const stdair::RandomSeed_T _masterSeed;
       const POSProbabilityMass_T& _posProbabilityMass;
     };
   
@@ -384,7 +379,7 @@ namespace TRADEMGEN {
     struct DemandParser : 
       public boost::spirit::classic::grammar<DemandParser> {
 
-      DemandParser (SEVMGR::SEVMGR_ServicePtr_T, stdair::RandomGeneration&,
+      DemandParser (SEVMGR::SEVMGR_ServicePtr_T, const stdair::RandomSeed_T&,
                     const POSProbabilityMass_T&, DemandStruct&);
 
       template <typename ScannerT>
@@ -413,7 +408,7 @@ namespace TRADEMGEN {
 
       // Parser Context
       SEVMGR::SEVMGR_ServicePtr_T _sevmgrServicePtr;
-      stdair::RandomGeneration& _uniformGenerator;
+      const stdair::RandomSeed_T _masterSeed;
       const POSProbabilityMass_T& _posProbabilityMass;
       DemandStruct& _demand;
     };
@@ -434,7 +429,7 @@ namespace TRADEMGEN {
   class DemandFileParser : public stdair::CmdAbstract {
   public:
     /** Constructor. */
-    DemandFileParser (SEVMGR::SEVMGR_ServicePtr_T, stdair::RandomGeneration&,
+    DemandFileParser (SEVMGR::SEVMGR_ServicePtr_T, const stdair::RandomSeed_T&,
                       const POSProbabilityMass_T&,
                       const stdair::Filename_T& iDemandInputFilename);
 
@@ -459,8 +454,8 @@ namespace TRADEMGEN {
     /** Pointer on the SEvMgr service handler. */
     SEVMGR::SEVMGR_ServicePtr_T _sevmgrServicePtr;
 
-    /** Shared uniform generator. */
-    stdair::RandomGeneration& _uniformGenerator;
+    /** Master seed of the random generators of the demand streams. */
+    const stdair::RandomSeed_T _masterSeed;
 
     /** Default POS distribution. */
     const POSProbabilityMass_T& _posProbabilityMass;
@@ -6,6 +6,8 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+// Boost Shared Pointer
+#include <boost/make_shared.hpp>
 // Boost Accumulators
 #include <boost/accumulators/accumulators.hpp>
 #include <boost/accumulators/statistics/stats.hpp>
@@ -30,6 +32,8 @@
 #include <stdair/service/Logger.hpp>
 // TraDemGen
 #include <trademgen/TRADEMGEN_Service.hpp>
+#include <trademgen/bom/BookingRequestConsumer.hpp>
+#include <trademgen/bom/LogTraceSink.hpp>
 #include <trademgen/config/trademgen-paths.hpp>
 
 // Aliases for namespaces
@@ -47,8 +51,36 @@ typedef ba::accumulator_set<double,
                                       ba::tag::sum,
                                       ba::tag::variance> > stat_acc_type;
 
+/**
+ * Type definition for the (Boost) progress display.
+ */
+#if BOOST_VERSION_MACRO >= 107200
+typedef boost::timer::progress_display progress_display_type;
+#else  // BOOST_VERSION_MACRO >= 107200
+typedef boost::progress_display progress_display_type;
+#endif // BOOST_VERSION_MACRO >= 107200
+
 namespace TRADEMGEN {
 
+  /**
+   * Consumer of the generated booking requests, which just updates the
+   * progress display (the requests are traced in the log by TraDemGen).
+   */
+  class ProgressDisplayConsumer : public BookingRequestConsumer {
+  public:
+    ProgressDisplayConsumer (progress_display_type& ioProgressDisplay)
+      : _progressDisplay (ioProgressDisplay) {
+    }
+
+    bool consume (const DemandStream&, const BookingRequestRecord&) {
+      ++_progressDisplay;
+      return true;
+    }
+
+  private:
+    progress_display_type& _progressDisplay;
+  };
+
   /**
    * Display the statistics held by the dedicated accumulator.
    */
@@ -123,115 +155,33 @@ namespace TRADEMGEN {
           _trademgenService->getExpectedTotalNumberOfRequestsToBeGenerated();
 
         // Initialise the (Boost) progress display object
-#if BOOST_VERSION_MACRO >= 107200
-        boost::timer::progress_display
-#else  // BOOST_VERSION_MACRO >= 107200
-        boost::progress_display
-#endif // BOOST_VERSION_MACRO >= 107200
+        progress_display_type
           lProgressDisplay (lExpectedNbOfEventsToBeGenerated * iNbOfRuns);
+        ProgressDisplayConsumer lProgressDisplayConsumer (lProgressDisplay);
 
         for (NbOfRuns_T runIdx = 1; runIdx <= iNbOfRuns; ++runIdx) {
           // /////////////////////////////////////////////////////
           *_logOutputStream << "Run number: " << runIdx << std::endl;
 
           /**
-             Initialisation step.
-             <br>Generate the first event for each demand stream.
+             Generate all the requests of all the demand streams, in
+             the order of their date-times.
           */
+          const stdair::Count_T lNbOfGeneratedEvents =
+            _trademgenService->generateAll (lProgressDisplayConsumer,
+                                            iDemandGenerationMethod);
+
+          // Retrieve the actual number of events to be generated, as drawn
+          // for all the demand streams (some of them may fall after the
+          // preferred departure date-times, and not be generated)
           const stdair::Count_T& lActualNbOfEventsToBeGenerated =
-            _trademgenService->generateFirstRequests (iDemandGenerationMethod);
+            _trademgenService->getActualTotalNumberOfRequestsToBeGenerated();
 
           // DEBUG
           *_logOutputStream << "[" << runIdx << "] Expected: "
                             << lExpectedNbOfEventsToBeGenerated << ", actual: "
-                            << lActualNbOfEventsToBeGenerated << std::endl;
-
-          /**
-             Main loop.
-             <ul>
-             <li>Pop a request and get its associated type/demand stream.</li>
-             <li>Generate the next request for the same type/demand stream.</li>
-             </ul>
-          */
-          while (_trademgenService->isQueueDone() == false) {
-
-            // Extract the next event from the event queue
-            stdair::EventStruct lEventStruct;
-            stdair::ProgressStatusSet lProgressStatusSet =
-              _trademgenService->popEvent (lEventStruct);
-
-            // DEBUG
-            // STDAIR_LOG_DEBUG ("[" << runIdx << "] Poped event: '"
-            //                   << lEventStruct.describe() << "'.");
-
-            // Extract the corresponding demand/booking request
-            const stdair::BookingRequestStruct& lPoppedRequest =
-              lEventStruct.getBookingRequest();
-
-            // DEBUG
-            *_logOutputStream << "[" << runIdx << "] Poped booking request: '"
-                              << lPoppedRequest.describe() << "'." << std::endl;
-
-            // Dump the request into the dedicated CSV file
-            // stdair::BomDisplay::csvDisplay (output, lPoppedRequest);
-
-            // Retrieve the corresponding demand stream key
-            const stdair::DemandGeneratorKey_T& lDemandStreamKey =
-              lPoppedRequest.getDemandGeneratorKey();
-
-            // Assess whether more events should be generated for that
-            // demand stream
-            const bool stillHavingRequestsToBeGenerated = _trademgenService->
-              stillHavingRequestsToBeGenerated (lDemandStreamKey,
-                                                lProgressStatusSet,
-                                                iDemandGenerationMethod);
-
-            // DEBUG
-            *_logOutputStream << lProgressStatusSet.describe() << std::endl;
-            *_logOutputStream << "=> [" << lDemandStreamKey
-                              << "] is now processed. Still generate events "
-                              << "for that demand stream? "
-                              << stillHavingRequestsToBeGenerated << std::endl;
-    
-            // If there are still events to be generated for that demand
-            // stream, generate and add them to the event queue
-            if (stillHavingRequestsToBeGenerated == true) {
-
-              stdair::BookingRequestPtr_T lNextRequest_ptr =
-                _trademgenService->generateNextRequest(lDemandStreamKey,
-                                                       iDemandGenerationMethod);
-        
-              assert (lNextRequest_ptr != NULL);
-
-              // Sanity check
-              const stdair::Duration_T lDuration =
-                lNextRequest_ptr->getRequestDateTime()
-                - lPoppedRequest.getRequestDateTime();
-              if (lDuration.total_milliseconds() < 0) {
-                *_logOutputStream << "[" << lDemandStreamKey
-                                  << "] The date-time of the generated event ("
-                                  << lNextRequest_ptr->getRequestDateTime()
-                                  << ") is lower than the date-time "
-                                  << "of the current event ("
-                                  << lPoppedRequest.getRequestDateTime()
-                                  << ")" << std::endl;
-                assert (false);
-              }
-
-              // DEBUG
-              *_logOutputStream << "[" << lDemandStreamKey
-                                << "] Added request: '"
-                                << lNextRequest_ptr->describe()
-                                << "'. Is queue done? "
-                                << _trademgenService->isQueueDone()
-                                << std::endl;
-            }
-            // DEBUG
-            *_logOutputStream << std::endl;
-      
-            // Update the progress display
-            ++lProgressDisplay;
-          }
+                            << lActualNbOfEventsToBeGenerated << ", generated: "
+                            << lNbOfGeneratedEvents << std::endl;
 
           // Add the number of events to the statistics accumulator
           lStatAccumulator (lActualNbOfEventsToBeGenerated);
@@ -325,6 +275,9 @@ namespace TRADEMGEN {
         _trademgenService = new TRADEMGEN_Service (lLogParams, iRandomSeed);
         assert (_trademgenService != NULL);
 
+        // Notify the log of the generated booking requests ("[BKG]" lines)
+        _trademgenService->setTraceSink (boost::make_shared<LogTraceSink>());
+
         // Check wether or not a (CSV) input file should be read
         if (isBuiltin == true) {
           // Create a sample DemandStream object, and insert it within
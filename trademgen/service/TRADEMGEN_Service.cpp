@@ -29,7 +29,9 @@
 // TraDemGen
 #include <trademgen/basic/BasConst_TRADEMGEN_Service.hpp>
 #include <trademgen/bom/BomDisplay.hpp>
+#include <trademgen/bom/BookingRequestRange.hpp>
 #include <trademgen/bom/DemandStream.hpp>
+#include <trademgen/bom/DemandStreamFamily.hpp>
 #include <trademgen/bom/DemandStreamTypes.hpp>
 #include <trademgen/factory/FacTRADEMGENServiceContext.hpp>
 #include <trademgen/command/DemandParser.hpp>
@@ -265,10 +267,6 @@ namespace TRADEMGEN {
     // Retrieve the pointer on the SEvMgr service handler.
     SEVMGR::SEVMGR_ServicePtr_T lSEVMGR_Service_ptr =
       lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr();
-    
-    // Retrieve the shared generator
-    stdair::RandomGeneration& lSharedGenerator =
-      lTRADEMGEN_ServiceContext.getUniformGenerator();
 
     // Retrieve the default POS distribution
     const POSProbabilityMass_T& lDefaultPOSProbabilityMass =
@@ -279,14 +277,17 @@ namespace TRADEMGEN {
      */
     stdair::BasChronometer lDemandGeneration; lDemandGeneration.start();
     DemandParser::generateDemand (iDemandFilePath, lSEVMGR_Service_ptr,
-                                  lSharedGenerator, lDefaultPOSProbabilityMass);
+                                  lTRADEMGEN_ServiceContext.getMasterSeed(),
+                                  lDefaultPOSProbabilityMass);
     const double lGenerationMeasure = lDemandGeneration.elapsed();  
 
     /**
-     * 2. Delegate the complementary building of objects and links by the
-     *    appropriate levels/components
-     * \note Nothing to do for now.
-     */  
+     * 2. Give the demand streams their handles
+     */
+    DemandManager::registerDemandStreams (lSEVMGR_Service_ptr,
+                                          lTRADEMGEN_ServiceContext.getDemandStreamRegistry());
+    DemandManager::setTraceSink (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                                 lTRADEMGEN_ServiceContext.getTraceSink());
 
     /**
      * 3. Build the complementary links
@@ -350,10 +351,6 @@ namespace TRADEMGEN {
      * 3. Build the complementary objects/links for the current component (here,
      *    TraDemGen)
      */
-    // Retrieve the shared generator
-    stdair::RandomGeneration& lSharedGenerator =
-      lTRADEMGEN_ServiceContext.getUniformGenerator();
-
     // Retrieve the default POS distribution
     const POSProbabilityMass_T& lDefaultPOSProbabilityMass =
       lTRADEMGEN_ServiceContext.getPOSProbabilityMass();
@@ -363,8 +360,16 @@ namespace TRADEMGEN {
       lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr();
 
     // Delegate the BOM building to the dedicated service
-    DemandManager::buildSampleBom (lSEVMGR_Service_ptr, lSharedGenerator,
+    DemandManager::buildSampleBom (lSEVMGR_Service_ptr,
+                                   lTRADEMGEN_ServiceContext.getMasterSeed(),
                                    lDefaultPOSProbabilityMass);
+
+    // Give the demand streams their handles
+    DemandManager::registerDemandStreams (lSEVMGR_Service_ptr,
+                                          lTRADEMGEN_ServiceContext.getDemandStreamRegistry());
+    DemandManager::setTraceSink (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                                 lTRADEMGEN_ServiceContext.getTraceSink());
+
     // Build the complementary links
     buildComplementaryLinks (lPersistentBomRoot);
 
@@ -644,20 +649,133 @@ namespace TRADEMGEN {
     TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
       *_trademgenServiceContext;
 
-    // Retrieve the pointer on the SEvMgr service handler.
-    SEVMGR::SEVMGR_ServicePtr_T lSEVMGR_Service_ptr =
-      lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr();
-    
     // Delegate the call to the dedicated command
-    const bool oStillHavingRequestsToBeGenerated =
-      DemandManager::stillHavingRequestsToBeGenerated (lSEVMGR_Service_ptr,
-                                                       iKey, ioPSS,
-                                                       iDemandGenerationMethod);
+    const bool oStillHavingRequestsToBeGenerated = DemandManager::
+      stillHavingRequestsToBeGenerated (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                                        iKey, ioPSS, iDemandGenerationMethod);
 
     //
     return oStillHavingRequestsToBeGenerated;
   }
 
+  // ////////////////////////////////////////////////////////////////////
+  const bool TRADEMGEN_Service::
+  stillHavingRequestsToBeGenerated (const DemandStreamHandle_T& iHandle,
+                                    stdair::ProgressStatusSet& ioPSS,
+                                    const stdair::DemandGenerationMethod& iDemandGenerationMethod) const {
+    
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Delegate the call to the dedicated command
+    return DemandManager::
+      stillHavingRequestsToBeGenerated (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                                        iHandle, ioPSS, iDemandGenerationMethod);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T TRADEMGEN_Service::
+  generateAll (BookingRequestConsumer& ioBookingRequestConsumer,
+               const stdair::DemandGenerationMethod& iDemandGenerationMethod) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Record the actual total number of requests to be generated, as
+    // generateFirstRequests() does
+    DemandManager::
+      updateActualTotalNumberOfRequests (lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr(),
+                                         lTRADEMGEN_ServiceContext.getDemandStreamRegistry());
+
+    // Delegate the call to the dedicated command
+    return DemandManager::
+      generateAll (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                   iDemandGenerationMethod, ioBookingRequestConsumer);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T TRADEMGEN_Service::
+  generateAllConcurrently (BookingRequestConsumer& ioBookingRequestConsumer,
+                           const stdair::DemandGenerationMethod& iDemandGenerationMethod) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Record the actual total number of requests to be generated, as
+    // generateFirstRequests() does
+    DemandManager::
+      updateActualTotalNumberOfRequests (lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr(),
+                                         lTRADEMGEN_ServiceContext.getDemandStreamRegistry());
+
+    // Delegate the call to the dedicated command
+    return DemandManager::
+      generateAllConcurrently (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                               iDemandGenerationMethod,
+                               ioBookingRequestConsumer);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T TRADEMGEN_Service::
+  generateAllInParallel (BookingRequestConsumer& ioBookingRequestConsumer,
+                         const stdair::DemandGenerationMethod& iDemandGenerationMethod,
+                         const unsigned int iNbOfThreads) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Record the actual total number of requests to be generated, as
+    // generateFirstRequests() does
+    DemandManager::
+      updateActualTotalNumberOfRequests (lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr(),
+                                         lTRADEMGEN_ServiceContext.getDemandStreamRegistry());
+
+    // Delegate the call to the dedicated command
+    return DemandManager::
+      generateAllInParallel (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                             iDemandGenerationMethod, iNbOfThreads,
+                             ioBookingRequestConsumer);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  BookingRequestRange TRADEMGEN_Service::
+  getBookingRequestRange (const stdair::DemandGenerationMethod& iDemandGenerationMethod) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    return BookingRequestRange (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                                iDemandGenerationMethod);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  BookingRequestRange TRADEMGEN_Service::
+  getBookingRequestRange (const DemandStreamHandle_T& iHandle,
+                          const stdair::DemandGenerationMethod& iDemandGenerationMethod) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Retrieve the demand stream (an IndexOutOfRangeException is
+    // thrown when the handle is unknown)
+    const DemandStreamRegistry& lDemandStreamRegistry =
+      lTRADEMGEN_ServiceContext.getDemandStreamRegistry();
+    DemandStream& lDemandStream = lDemandStreamRegistry.getDemandStream (iHandle);
+
+    return BookingRequestRange (lDemandStream, iDemandGenerationMethod);
+  }
+
   // ////////////////////////////////////////////////////////////////////
   stdair::Count_T TRADEMGEN_Service::
   generateFirstRequests (const stdair::DemandGenerationMethod& iDemandGenerationMethod) const {
@@ -671,13 +789,10 @@ namespace TRADEMGEN {
     SEVMGR::SEVMGR_ServicePtr_T lSEVMGR_Service_ptr =
       lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr();
 
-    // Retrieve the random generator
-    stdair::RandomGeneration& lGenerator =
-      lTRADEMGEN_ServiceContext.getUniformGenerator();
-
     // Delegate the call to the dedicated command
     const stdair::Count_T& oActualTotalNbOfEvents =
-      DemandManager::generateFirstRequests (lSEVMGR_Service_ptr, lGenerator,
+      DemandManager::generateFirstRequests (lSEVMGR_Service_ptr,
+                                            lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
                                             iDemandGenerationMethod);
 
     //
@@ -697,15 +812,97 @@ namespace TRADEMGEN {
     // Retrieve the pointer on the SEvMgr service handler.
     SEVMGR::SEVMGR_ServicePtr_T lSEVMGR_Service_ptr =
       lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr();
-    
-    // Retrieve the random generator
-    stdair::RandomGeneration& lGenerator =
-      lTRADEMGEN_ServiceContext.getUniformGenerator();
 
     // Delegate the call to the dedicated command
-    return DemandManager::generateNextRequest (lSEVMGR_Service_ptr,
-                                               lGenerator, iKey,
-                                               iDemandGenerationMethod);
+    return DemandManager::
+      generateNextRequest (lSEVMGR_Service_ptr,
+                           lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                           iKey, iDemandGenerationMethod);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::BookingRequestPtr_T TRADEMGEN_Service::
+  generateNextRequest (const DemandStreamHandle_T& iHandle,
+                       const stdair::DemandGenerationMethod& iDemandGenerationMethod) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Retrieve the pointer on the SEvMgr service handler.
+    SEVMGR::SEVMGR_ServicePtr_T lSEVMGR_Service_ptr =
+      lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr();
+
+    // Delegate the call to the dedicated command
+    return DemandManager::
+      generateNextRequest (lSEVMGR_Service_ptr,
+                           lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                           iHandle, iDemandGenerationMethod);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void TRADEMGEN_Service::
+  generateNextRequest (const DemandStreamHandle_T& iHandle,
+                       BookingRequestRecord& ioBookingRequestRecord,
+                       const stdair::DemandGenerationMethod& iDemandGenerationMethod) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Delegate the call to the dedicated command
+    DemandManager::
+      generateNextRequest (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                           iHandle, ioBookingRequestRecord,
+                           iDemandGenerationMethod);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::BookingRequestPtr_T TRADEMGEN_Service::
+  createBookingRequest (const BookingRequestRecord& iBookingRequestRecord) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Delegate the call to the dedicated command
+    return DemandManager::
+      createBookingRequest (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                            iBookingRequestRecord);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const DemandStreamHandle_T& TRADEMGEN_Service::
+  getDemandStreamHandle (const stdair::DemandStreamKeyStr_T& iKey) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Retrieve the registry of the demand streams
+    const DemandStreamRegistry& lDemandStreamRegistry =
+      lTRADEMGEN_ServiceContext.getDemandStreamRegistry();
+
+    return lDemandStreamRegistry.getDemandStreamHandle (iKey);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  DemandStreamHandle_T TRADEMGEN_Service::getNbOfDemandStreams() const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Retrieve the registry of the demand streams
+    const DemandStreamRegistry& lDemandStreamRegistry =
+      lTRADEMGEN_ServiceContext.getDemandStreamRegistry();
+
+    return lDemandStreamRegistry.getNbOfDemandStreams();
   }
 
   // ////////////////////////////////////////////////////////////////////
@@ -819,15 +1016,42 @@ namespace TRADEMGEN {
     SEVMGR::SEVMGR_ServicePtr_T lSEVMGR_Service_ptr =
       lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr();
 
-    // Retrieve the shared generator
-    stdair::RandomGeneration& lSharedGenerator =
-      lTRADEMGEN_ServiceContext.getUniformGenerator();
-    
     // Delegate the call to the dedicated command
     DemandManager::reset (lSEVMGR_Service_ptr,
-                          lSharedGenerator.getBaseGenerator());
+                          lTRADEMGEN_ServiceContext.getDemandStreamRegistry());
   }  
 
+  //////////////////////////////////////////////////////////////////////
+  stdair::Count_T TRADEMGEN_Service::
+  setJointCharacteristicsSampling (const bool iIsJointSampled) const {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Delegate the call to the dedicated command
+    return DemandManager::
+      setJointCharacteristicsSampling (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                                       iIsJointSampled);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  void TRADEMGEN_Service::setTraceSink (TraceSinkPtr_T ioTraceSink_ptr) {
+
+    // Retrieve the TraDemGen service context
+    assert (_trademgenServiceContext != NULL);
+    TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
+      *_trademgenServiceContext;
+
+    // Keep the trace sink alive, as long as the demand streams use it
+    lTRADEMGEN_ServiceContext.setTraceSink (ioTraceSink_ptr);
+
+    // Delegate the call to the dedicated command
+    DemandManager::setTraceSink (lTRADEMGEN_ServiceContext.getDemandStreamRegistry(),
+                                 lTRADEMGEN_ServiceContext.getTraceSink());
+  }
+
   //////////////////////////////////////////////////////////////////////
   const stdair::ProgressStatus& TRADEMGEN_Service::getProgressStatus() const {    
 
@@ -872,13 +1096,11 @@ namespace TRADEMGEN {
     TRADEMGEN_ServiceContext& lTRADEMGEN_ServiceContext =
       *_trademgenServiceContext;
 
-    // Retrieve the pointer on the SEvMgr service handler.
-    SEVMGR::SEVMGR_ServicePtr_T lSEVMGR_Service_ptr =
-      lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr();
-
-    // Delegate the call to the dedicated service
-    return lSEVMGR_Service_ptr->hasEventGenerator<DemandStream,
-                                                  stdair::DemandStreamKeyStr_T>(iDemandStreamKey);
+    // The demand streams are known by SEvMgr through their families
+    // only: delegate the call to the registry
+    const DemandStreamRegistry& lDemandStreamRegistry =
+      lTRADEMGEN_ServiceContext.getDemandStreamRegistry();
+    return lDemandStreamRegistry.hasDemandStream (iDemandStreamKey);
   }
 
   //////////////////////////////////////////////////////////////////////
@@ -894,19 +1116,25 @@ namespace TRADEMGEN {
       lTRADEMGEN_ServiceContext.getSEVMGR_ServicePtr();
 
     // Delegate the call to the dedicated service
-    const DemandStreamList_T lDemandStreamList =
-      lSEVMGR_Service_ptr->getEventGeneratorList<DemandStream>();
+    const DemandStreamFamilyList_T lDemandStreamFamilyList =
+      lSEVMGR_Service_ptr->getEventGeneratorList<DemandStreamFamily>();
 
     // Output stream to store the display of demand streams.
     std::ostringstream  oStream;
 
-    for (DemandStreamList_T::const_iterator itDemandStream =
-           lDemandStreamList.begin(); itDemandStream !=
-           lDemandStreamList.end(); itDemandStream++) {
-      DemandStream* lDemandStream_ptr = *itDemandStream;
-      assert (lDemandStream_ptr != NULL);
-      oStream << lDemandStream_ptr->describeKey() << std::endl; 
-      
+    for (DemandStreamFamilyList_T::const_iterator itFamily =
+           lDemandStreamFamilyList.begin(); itFamily !=
+           lDemandStreamFamilyList.end(); itFamily++) {
+      const DemandStreamFamily* lDemandStreamFamily_ptr = *itFamily;
+      assert (lDemandStreamFamily_ptr != NULL);
+
+      const DemandStreamFamily::DemandStreamList_T& lDemandStreamList =
+        lDemandStreamFamily_ptr->getDemandStreamList();
+      for (DemandStreamFamily::DemandStreamList_T::const_iterator itDemandStream =
+             lDemandStreamList.begin(); itDemandStream !=
+             lDemandStreamList.end(); itDemandStream++) {
+        oStream << itDemandStream->describeKey() << std::endl; 
+      }
     }
     return oStream.str();
   }
@@ -917,7 +1145,7 @@ namespace SEVMGR {
 
   /**
    * Implementation of the SEvMgr service template methods for TraDemGen own
-   * EventGenerator type: DemandStream.
+   * EventGenerator type: DemandStreamFamily.
    *
    * \note The declaration of these methods can be found in the SEvMgr service
    * header file.
@@ -934,10 +1162,10 @@ namespace SEVMGR {
     stdair::BomRoot& lPersistentBomRoot = 
       lSTDAIR_Service.getPersistentBomRoot();
 
-    // Link the DemandStream to its parent (EventQueue)
+    // Link the DemandStreamFamily to its parent (EventQueue)
     stdair::FacBomManager::linkWithParent (lPersistentBomRoot, iEventGenerator);
     
-    // Add the DemandStream to the dedicated list and map
+    // Add the DemandStreamFamily to the dedicated list and map
     stdair::FacBomManager::addToListAndMap (lPersistentBomRoot, 
 					    iEventGenerator);
     
@@ -955,7 +1183,7 @@ namespace SEVMGR {
     stdair::BomRoot& lPersistentBomRoot = 
       lSTDAIR_Service.getPersistentBomRoot();
 
-    // Retrieve the DemandStream which corresponds to the given key.
+    // Retrieve the DemandStreamFamily which corresponds to the given key.
     EventGenerator& lEventGenerator = 
       stdair::BomManager::getObject<EventGenerator> (lPersistentBomRoot, 
 						     iKey);
@@ -978,7 +1206,7 @@ namespace SEVMGR {
     stdair::BomRoot& lPersistentBomRoot = 
       lSTDAIR_Service.getPersistentBomRoot();
 
-    // Retrieve the DemandStream which corresponds to the given key.
+    // Retrieve the DemandStreamFamily which corresponds to the given key.
     EventGenerator* lEventGenerator_ptr = 
       stdair::BomManager::getObjectPtr<EventGenerator> (lPersistentBomRoot, 
 							iKey);
@@ -1002,7 +1230,7 @@ namespace SEVMGR {
     stdair::BomRoot& lPersistentBomRoot = 
       lSTDAIR_Service.getPersistentBomRoot();
     
-    // Retrieve the DemandStream list
+    // Retrieve the DemandStreamFamily list
     const std::list<EventGenerator*> lEventGeneratorList =
       stdair::BomManager::getList<EventGenerator> (lPersistentBomRoot);
 
@@ -1030,21 +1258,21 @@ namespace SEVMGR {
   // ////////////////////////////////////////////////////////////////////  
   /**
    * Explicit template instantiations with the TraDemGen own EventGenerator
-   * type: DemandStream.
+   * type: DemandStreamFamily.
    */
   template void SEVMGR_Service::
-  addEventGenerator<TRADEMGEN::DemandStream> (TRADEMGEN::DemandStream&) const;
+  addEventGenerator<TRADEMGEN::DemandStreamFamily> (TRADEMGEN::DemandStreamFamily&) const;
 
-  template TRADEMGEN::DemandStream& SEVMGR_Service::
-  getEventGenerator<TRADEMGEN::DemandStream, stdair::DemandStreamKeyStr_T> (const stdair::DemandStreamKeyStr_T&) const;
+  template TRADEMGEN::DemandStreamFamily& SEVMGR_Service::
+  getEventGenerator<TRADEMGEN::DemandStreamFamily, stdair::DemandStreamKeyStr_T> (const stdair::DemandStreamKeyStr_T&) const;
 
   template bool SEVMGR_Service::
-  hasEventGenerator<TRADEMGEN::DemandStream, stdair::DemandStreamKeyStr_T> (const stdair::DemandStreamKeyStr_T&) const;
+  hasEventGenerator<TRADEMGEN::DemandStreamFamily, stdair::DemandStreamKeyStr_T> (const stdair::DemandStreamKeyStr_T&) const;
 
-  template const TRADEMGEN::DemandStreamList_T SEVMGR_Service::
-  getEventGeneratorList<TRADEMGEN::DemandStream> () const;
+  template const TRADEMGEN::DemandStreamFamilyList_T SEVMGR_Service::
+  getEventGeneratorList<TRADEMGEN::DemandStreamFamily> () const;
 
-  template bool SEVMGR_Service::hasEventGeneratorList<TRADEMGEN::DemandStream>() const;
+  template bool SEVMGR_Service::hasEventGeneratorList<TRADEMGEN::DemandStreamFamily>() const;
   // ////////////////////////////////////////////////////////////////////
 
 }
@@ -16,6 +16,7 @@ namespace TRADEMGEN {
   // //////////////////////////////////////////////////////////////////////
   TRADEMGEN_ServiceContext::TRADEMGEN_ServiceContext ()
     : _ownStdairService (false), _uniformGenerator (stdair::DEFAULT_RANDOM_SEED),
+      _masterSeed (stdair::DEFAULT_RANDOM_SEED),
       _posProbabilityMass (DEFAULT_POS_PROBALILITY_MASS) {
   }
 
@@ -23,6 +24,7 @@ namespace TRADEMGEN {
   TRADEMGEN_ServiceContext::
   TRADEMGEN_ServiceContext (const TRADEMGEN_ServiceContext& iServiceContext)
     : _ownStdairService (false), _uniformGenerator (stdair::DEFAULT_RANDOM_SEED),
+      _masterSeed (stdair::DEFAULT_RANDOM_SEED),
       _posProbabilityMass (DEFAULT_POS_PROBALILITY_MASS) {
   }
 
@@ -30,6 +32,7 @@ namespace TRADEMGEN {
   TRADEMGEN_ServiceContext::
   TRADEMGEN_ServiceContext (const stdair::RandomSeed_T& iRandomSeed)
     : _ownStdairService (false), _uniformGenerator (iRandomSeed),
+      _masterSeed (iRandomSeed),
       _posProbabilityMass (DEFAULT_POS_PROBALILITY_MASS) {
   }
 
@@ -69,6 +72,9 @@ namespace TRADEMGEN {
 
     // Reset the sevmgr shared pointer
     _sevmgrService.reset();
+
+    // The demand streams belong to the (StdAir) BOM tree
+    _demandStreamRegistry.clear();
   }
 
 }
@@ -19,6 +19,8 @@
 // TraDemGen
 #include <trademgen/TRADEMGEN_Types.hpp>
 #include <trademgen/basic/DemandCharacteristicsTypes.hpp>
+#include <trademgen/bom/DemandStreamRegistry.hpp>
+#include <trademgen/bom/TraceSink.hpp>
 
 // Forward declarations
 namespace stdair {
@@ -71,6 +73,14 @@ namespace TRADEMGEN {
       return _uniformGenerator;
     }
 
+    /**
+     * Get the master seed of the random generators of the demand
+     * streams.
+     */
+    const stdair::RandomSeed_T& getMasterSeed() const {
+      return _masterSeed;
+    }
+
     /**
      * Get the default POS distribution.
      */
@@ -78,6 +88,24 @@ namespace TRADEMGEN {
       return _posProbabilityMass;
     }
 
+    /**
+     * Get the registry of the demand streams.
+     */
+    DemandStreamRegistry& getDemandStreamRegistry() {
+      return _demandStreamRegistry;
+    }
+
+    /**
+     * Get the trace sink of the demand streams (the NullTraceSink
+     * when none has been set).
+     */
+    TraceSink& getTraceSink() const {
+      if (_traceSink == NULL) {
+        return NullTraceSink::instance();
+      }
+      return *_traceSink;
+    }
+
     /**
      * Get the pointer on the SEvMgr service handler.
      */
@@ -112,6 +140,13 @@ namespace TRADEMGEN {
       _sevmgrService = ioSEVMGR_ServicePtr;
     }
 
+    /**
+     * Set the (shared) trace sink of the demand streams.
+     */
+    void setTraceSink (TraceSinkPtr_T ioTraceSink_ptr) {
+      _traceSink = ioTraceSink_ptr;
+    }
+
     
   private:
     // ///////// Display Methods //////////
@@ -185,10 +220,27 @@ namespace TRADEMGEN {
      */
     stdair::RandomGeneration _uniformGenerator;
 
+    /**
+     * Master seed of the (counter-based) random generators of the
+     * demand streams.
+     */
+    const stdair::RandomSeed_T _masterSeed;
+
     /**
      * POS probability mass, used when the POS is 'RoW'.
      */
     const POSProbabilityMass_T _posProbabilityMass;
+
+    /**
+     * Registry of the demand streams, indexed by their handles.
+     */
+    DemandStreamRegistry _demandStreamRegistry;
+
+    /**
+     * Trace sink of the demand streams (none by default, i.e., the
+     * NullTraceSink is used).
+     */
+    TraceSinkPtr_T _traceSink;
   };
 
 }
@@ -13,6 +13,7 @@
 #include <boost/tokenizer.hpp>
 #include <boost/regex.hpp>
 #include <boost/swap.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/algorithm/string/case_conv.hpp>
 // GNU Readline Wrapper
 #include <stdair/ui/cmdline/SReadline.hpp>
@@ -28,6 +29,7 @@
 #include <stdair/service/Logger.hpp>
 // TraDemGen
 #include <trademgen/TRADEMGEN_Service.hpp>
+#include <trademgen/bom/LogTraceSink.hpp>
 #include <trademgen/config/trademgen-paths.hpp>
 
 
@@ -434,6 +436,10 @@ int main (int argc, char* argv[]) {
   // Initialise the TraDemGen service object
   TRADEMGEN::TRADEMGEN_Service trademgenService (lLogParams, lRandomSeed);
 
+  // Notify the log of the generated booking requests, as it used to be
+  // the case before the trace sinks were introduced
+  trademgenService.setTraceSink (boost::make_shared<TRADEMGEN::LogTraceSink>());
+
   // Check wether or not a (CSV) input file should be read
   if (isBuiltin == true) {
     // Create a sample DemandStream object, and insert it within the BOM tree
@@ -657,10 +663,14 @@ int main (int argc, char* argv[]) {
         break;
       }
       assert (hasDemandStream == true);
+
+      // Retrieve the handle of the demand stream, once for all
+      const TRADEMGEN::DemandStreamHandle_T& lDemandStreamHandle =
+        trademgenService.getDemandStreamHandle (lDemandStreamKey);
       
       stdair::ProgressStatusSet lProgressStatusSet (stdair::EventType::BKG_REQ);
       bool stillHavingRequestsToBeGenerated =
-        trademgenService.stillHavingRequestsToBeGenerated (lDemandStreamKey,
+        trademgenService.stillHavingRequestsToBeGenerated (lDemandStreamHandle,
                                                            lProgressStatusSet,
                                                            lDemandGenerationMethod);
       
@@ -676,12 +686,17 @@ int main (int argc, char* argv[]) {
       }
       assert (stillHavingRequestsToBeGenerated == true);
 
+      // The requests are inserted into the event queue, from which they
+      // are then popped out by the 'next' command: hence, that loop does
+      // not rely on TRADEMGEN_Service::generateAll(), which bypasses the
+      // event queue, but on the handle of the demand stream.
       stdair::Count_T lNumberOfRequests = 0;
       while (stillHavingRequestsToBeGenerated == true) {
         lNumberOfRequests++;
-        trademgenService.generateNextRequest (lDemandStreamKey, lDemandGenerationMethod);
+        trademgenService.generateNextRequest (lDemandStreamHandle,
+                                              lDemandGenerationMethod);
         stillHavingRequestsToBeGenerated =
-          trademgenService.stillHavingRequestsToBeGenerated (lDemandStreamKey,
+          trademgenService.stillHavingRequestsToBeGenerated (lDemandStreamHandle,
                                                              lProgressStatusSet,
                                                              lDemandGenerationMethod);
 